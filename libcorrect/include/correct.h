@@ -48,6 +48,20 @@ extern "C" {
 correct_convolutional *correct_convolutional_create(size_t inv_rate, size_t order,
                                                     const correct_convolutional_polynomial_t *poly);
 
+/* correct_convolutional_create_table allocates and initializes an
+ * encoder/decoder for a trellis code given by its output table instead
+ * of polynomials, which lets codes that are not linear, such as the
+ * constrained line codes used in magnetic recording, use the same Viterbi
+ * decoder. table has 2**order rows, one per shift register state with the
+ * newest bit in the least significant position; row bit j is the output
+ * for the jth of the inv_rate symbols. order must be at least 4, smaller
+ * codes can simply ignore the oldest bits. The table is copied.
+ *
+ * If this call is successful, it returns a non-NULL pointer.
+ */
+correct_convolutional *correct_convolutional_create_table(size_t inv_rate, size_t order,
+                                                          const unsigned int *table);
+
 /* correct_convolutional_destroy releases all resources associated
  * with conv. This pointer should not be used for further calls
  * after calling destroy.
@@ -204,6 +218,28 @@ correct_reed_solomon *correct_reed_solomon_create(uint16_t primitive_polynomial,
                                                   uint8_t generator_root_gap,
                                                   size_t num_roots);
 
+/* correct_reed_solomon_ccsds_255_223 returns a statically
+ * allocated (255, 223) encoder/decoder with the CCSDS primitive
+ * polynomial, first consecutive root 1 and generator root gap 1,
+ * i.e. the same code as
+ *
+ *   correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds, 1, 1, 32)
+ *
+ * Its tables are constant and precomputed, so it costs nothing
+ * to get and never allocates, not even on the first decode.
+ * Encoding and decoding use separate scratch space: one thread
+ * may encode while another decodes, but not two of either.
+ * Passing it to correct_reed_solomon_destroy does nothing.
+ */
+correct_reed_solomon *correct_reed_solomon_ccsds_255_223(void);
+
+/* the same with 16 and 64 roots: (255, 239) and (255, 191) codes,
+ * as correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds,
+ * 1, 1, 16) and (..., 64). Each instance has its own scratch.
+ */
+correct_reed_solomon *correct_reed_solomon_ccsds_255_239(void);
+correct_reed_solomon *correct_reed_solomon_ccsds_255_191(void);
+
 /* correct_reed_solomon_encode uses the rs instance to encode
  * parity information onto a block of data. msg_length should be
  * no more than the payload size for one block e.g. no more
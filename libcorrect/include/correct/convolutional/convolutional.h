@@ -26,6 +26,9 @@ struct correct_convolutional {
 correct_convolutional *_correct_convolutional_init(correct_convolutional *conv,
                                                    size_t rate, size_t order,
                                                    const polynomial_t *poly);
+correct_convolutional *_correct_convolutional_init_table(correct_convolutional *conv,
+                                                         size_t rate, size_t order,
+                                                         const unsigned int *table);
 void _correct_convolutional_teardown(correct_convolutional *conv);
 
 // portable versions
@@ -70,7 +70,15 @@ struct correct_reed_solomon {
     polynomial_t error_evaluator;
     polynomial_t error_locator_derivative;
     polynomial_t init_from_roots_scratch[2];
+
+    // used during erasure decoding
+    field_element_t *syndrome_copy;
+    polynomial_t full_error_locator;
+
     bool has_init_decode;
 
+    // tables and scratch live in static storage, see static.c
+    bool is_static;
+
 };
 #endif
@@ -1,10 +1,12 @@
 #include "correct/convolutional/convolutional.h"
+#include <string.h>
 
 // https://www.youtube.com/watch?v=b3_lVSrPB6w
 
-correct_convolutional *_correct_convolutional_init(correct_convolutional *conv,
-                                                   size_t rate, size_t order,
-                                                   const polynomial_t *poly) {
+static correct_convolutional *_correct_convolutional_init_common(correct_convolutional *conv,
+                                                                 size_t rate, size_t order,
+                                                                 const polynomial_t *poly,
+                                                                 const unsigned int *rows) {
     if (order > 8 * sizeof(shift_register_t)) {
         // XXX turn this into an error code
         // printf("order must be smaller than 8 * sizeof(shift_register_t)\n");
@@ -21,7 +23,11 @@ correct_convolutional *_correct_convolutional_init(correct_convolutional *conv,
     conv->numstates = 1 << order;
 
     unsigned int *table = malloc(sizeof(unsigned int) * (1 << order));
-    fill_table(conv->rate, conv->order, poly, table);
+    if (poly) {
+        fill_table(conv->rate, conv->order, poly, table);
+    } else {
+        memcpy(table, rows, sizeof(unsigned int) * (1 << order));
+    }
     *(unsigned int **)&conv->table = table;
 
     conv->bit_writer = bit_writer_create(NULL, 0);
@@ -31,6 +37,23 @@ correct_convolutional *_correct_convolutional_init(correct_convolutional *conv,
     return conv;
 }
 
+correct_convolutional *_correct_convolutional_init(correct_convolutional *conv,
+                                                   size_t rate, size_t order,
+                                                   const polynomial_t *poly) {
+    return _correct_convolutional_init_common(conv, rate, order, poly, NULL);
+}
+
+correct_convolutional *_correct_convolutional_init_table(correct_convolutional *conv,
+                                                         size_t rate, size_t order,
+                                                         const unsigned int *table) {
+    if (order < 4) {
+        // XXX turn this into an error code
+        // printf("order must be 4 or greater, the decoder walks 8 states at a time\n");
+        return NULL;
+    }
+    return _correct_convolutional_init_common(conv, rate, order, NULL, table);
+}
+
 correct_convolutional *correct_convolutional_create(size_t rate, size_t order,
                                                     const polynomial_t *poly) {
     correct_convolutional *conv = malloc(sizeof(correct_convolutional));
@@ -41,6 +64,16 @@ correct_convolutional *correct_convolutional_create(size_t rate, size_t order,
     return init_conv;
 }
 
+correct_convolutional *correct_convolutional_create_table(size_t rate, size_t order,
+                                                          const unsigned int *table) {
+    correct_convolutional *conv = malloc(sizeof(correct_convolutional));
+    correct_convolutional *init_conv = _correct_convolutional_init_table(conv, rate, order, table);
+    if (!init_conv) {
+        free(conv);
+    }
+    return init_conv;
+}
+
 void _correct_convolutional_teardown(correct_convolutional *conv) {
     free(*(unsigned int **)&conv->table);
     bit_writer_destroy(conv->bit_writer);
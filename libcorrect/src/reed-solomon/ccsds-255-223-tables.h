@@ -0,0 +1,1968 @@
+// generated by tools/gen_rs_static_tables.c, do not edit
+// (255, 223) reed-solomon, ccsds primitive polynomial 0x187, first consecutive root 1, root gap 1
+
+static const field_element_t ccsds_255_223_exp[512] = {
+      1,   2,   4,   8,  16,  32,  64, 128, 135, 137, 149, 173, 221,  61, 122, 244,
+    111, 222,  59, 118, 236,  95, 190, 251, 113, 226,  67, 134, 139, 145, 165, 205,
+     29,  58, 116, 232,  87, 174, 219,  49,  98, 196,  15,  30,  60, 120, 240, 103,
+    206,  27,  54, 108, 216,  55, 110, 220,  63, 126, 252, 127, 254, 123, 246, 107,
+    214,  43,  86, 172, 223,  57, 114, 228,  79, 158, 187, 241, 101, 202,  19,  38,
+     76, 152, 183, 233,  85, 170, 211,  33,  66, 132, 143, 153, 181, 237,  93, 186,
+    243,  97, 194,   3,   6,  12,  24,  48,  96, 192,   7,  14,  28,  56, 112, 224,
+     71, 142, 155, 177, 229,  77, 154, 179, 225,  69, 138, 147, 161, 197,  13,  26,
+     52, 104, 208,  39,  78, 156, 191, 249, 117, 234,  83, 166, 203,  17,  34,  68,
+    136, 151, 169, 213,  45,  90, 180, 239,  89, 178, 227,  65, 130, 131, 129, 133,
+    141, 157, 189, 253, 125, 250, 115, 230,  75, 150, 171, 209,  37,  74, 148, 175,
+    217,  53, 106, 212,  47,  94, 188, 255, 121, 242,  99, 198,  11,  22,  44,  88,
+    176, 231,  73, 146, 163, 193,   5,  10,  20,  40,  80, 160, 199,   9,  18,  36,
+     72, 144, 167, 201,  21,  42,  84, 168, 215,  41,  82, 164, 207,  25,  50, 100,
+    200,  23,  46,  92, 184, 247, 105, 210,  35,  70, 140, 159, 185, 245, 109, 218,
+     51, 102, 204,  31,  62, 124, 248, 119, 238,  91, 182, 235,  81, 162, 195,   1,
+      2,   4,   8,  16,  32,  64, 128, 135, 137, 149, 173, 221,  61, 122, 244, 111,
+    222,  59, 118, 236,  95, 190, 251, 113, 226,  67, 134, 139, 145, 165, 205,  29,
+     58, 116, 232,  87, 174, 219,  49,  98, 196,  15,  30,  60, 120, 240, 103, 206,
+     27,  54, 108, 216,  55, 110, 220,  63, 126, 252, 127, 254, 123, 246, 107, 214,
+     43,  86, 172, 223,  57, 114, 228,  79, 158, 187, 241, 101, 202,  19,  38,  76,
+    152, 183, 233,  85, 170, 211,  33,  66, 132, 143, 153, 181, 237,  93, 186, 243,
+     97, 194,   3,   6,  12,  24,  48,  96, 192,   7,  14,  28,  56, 112, 224,  71,
+    142, 155, 177, 229,  77, 154, 179, 225,  69, 138, 147, 161, 197,  13,  26,  52,
+    104, 208,  39,  78, 156, 191, 249, 117, 234,  83, 166, 203,  17,  34,  68, 136,
+    151, 169, 213,  45,  90, 180, 239,  89, 178, 227,  65, 130, 131, 129, 133, 141,
+    157, 189, 253, 125, 250, 115, 230,  75, 150, 171, 209,  37,  74, 148, 175, 217,
+     53, 106, 212,  47,  94, 188, 255, 121, 242,  99, 198,  11,  22,  44,  88, 176,
+    231,  73, 146, 163, 193,   5,  10,  20,  40,  80, 160, 199,   9,  18,  36,  72,
+    144, 167, 201,  21,  42,  84, 168, 215,  41,  82, 164, 207,  25,  50, 100, 200,
+     23,  46,  92, 184, 247, 105, 210,  35,  70, 140, 159, 185, 245, 109, 218,  51,
+    102, 204,  31,  62, 124, 248, 119, 238,  91, 182, 235,  81, 162, 195,   1,   2,
+};
+
+static const field_logarithm_t ccsds_255_223_log[256] = {
+      0, 255,   1,  99,   2, 198, 100, 106,   3, 205, 199, 188, 101, 126, 107,  42,
+      4, 141, 206,  78, 200, 212, 189, 225, 102, 221, 127,  49, 108,  32,  43, 243,
+      5,  87, 142, 232, 207, 172,  79, 131, 201, 217, 213,  65, 190, 148, 226, 180,
+    103,  39, 222, 240, 128, 177,  50,  53, 109,  69,  33,  18,  44,  13, 244,  56,
+      6, 155,  88,  26, 143, 121, 233, 112, 208, 194, 173, 168,  80, 117, 132,  72,
+    202, 252, 218, 138, 214,  84,  66,  36, 191, 152, 149, 249, 227,  94, 181,  21,
+    104,  97,  40, 186, 223,  76, 241,  47, 129, 230, 178,  63,  51, 238,  54,  16,
+    110,  24,  70, 166,  34, 136,  19, 247,  45, 184,  14,  61, 245, 164,  57,  59,
+      7, 158, 156, 157,  89, 159,  27,   8, 144,   9, 122,  28, 234, 160, 113,  90,
+    209,  29, 195, 123, 174,  10, 169, 145,  81,  91, 118, 114, 133, 161,  73, 235,
+    203, 124, 253, 196, 219,  30, 139, 210, 215, 146,  85, 170,  67,  11,  37, 175,
+    192, 115, 153, 119, 150,  92, 250,  82, 228, 236,  95,  74, 182, 162,  22, 134,
+    105, 197,  98, 254,  41, 125, 187, 204, 224, 211,  77, 140, 242,  31,  48, 220,
+    130, 171, 231,  86, 179, 147,  64, 216,  52, 176, 239,  38,  55,  12,  17,  68,
+    111, 120,  25, 154,  71, 116, 167, 193,  35,  83, 137, 251,  20,  93, 248, 151,
+     46,  75, 185,  96,  15, 237,  62, 229, 246, 135, 165,  23,  58, 163,  60, 183,
+};
+
+static const field_element_t ccsds_255_223_generator[33] = {
+     59, 182, 135, 119, 205, 219, 179, 251, 197, 172, 232,  76, 242,  84,  13, 133,
+    130,  13, 254, 177,  55, 171, 181, 153, 229, 185,  60, 242, 151, 158,  63, 149,
+      1,
+};
+
+static const field_element_t ccsds_255_223_generator_roots[32] = {
+      2,   4,   8,  16,  32,  64, 128, 135, 137, 149, 173, 221,  61, 122, 244, 111,
+    222,  59, 118, 236,  95, 190, 251, 113, 226,  67, 134, 139, 145, 165, 205,  29,
+};
+
+static const field_logarithm_t ccsds_255_223_generator_root_exp[32][255] = {
+    {
+        255,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+         16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+         32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+         48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+         64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+         80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,
+         96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+        112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+        128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+        144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+        160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+        176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+        192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+        208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+        224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+        240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+    },
+    {
+        255,   2,   4,   6,   8,  10,  12,  14,  16,  18,  20,  22,  24,  26,  28,  30,
+         32,  34,  36,  38,  40,  42,  44,  46,  48,  50,  52,  54,  56,  58,  60,  62,
+         64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,  94,
+         96,  98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+        128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158,
+        160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190,
+        192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222,
+        224, 226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254,
+          1,   3,   5,   7,   9,  11,  13,  15,  17,  19,  21,  23,  25,  27,  29,  31,
+         33,  35,  37,  39,  41,  43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,
+         65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,  93,  95,
+         97,  99, 101, 103, 105, 107, 109, 111, 113, 115, 117, 119, 121, 123, 125, 127,
+        129, 131, 133, 135, 137, 139, 141, 143, 145, 147, 149, 151, 153, 155, 157, 159,
+        161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183, 185, 187, 189, 191,
+        193, 195, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221, 223,
+        225, 227, 229, 231, 233, 235, 237, 239, 241, 243, 245, 247, 249, 251, 253,
+    },
+    {
+        255,   3,   6,   9,  12,  15,  18,  21,  24,  27,  30,  33,  36,  39,  42,  45,
+         48,  51,  54,  57,  60,  63,  66,  69,  72,  75,  78,  81,  84,  87,  90,  93,
+         96,  99, 102, 105, 108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+        144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177, 180, 183, 186, 189,
+        192, 195, 198, 201, 204, 207, 210, 213, 216, 219, 222, 225, 228, 231, 234, 237,
+        240, 243, 246, 249, 252, 255,   3,   6,   9,  12,  15,  18,  21,  24,  27,  30,
+         33,  36,  39,  42,  45,  48,  51,  54,  57,  60,  63,  66,  69,  72,  75,  78,
+         81,  84,  87,  90,  93,  96,  99, 102, 105, 108, 111, 114, 117, 120, 123, 126,
+        129, 132, 135, 138, 141, 144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174,
+        177, 180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213, 216, 219, 222,
+        225, 228, 231, 234, 237, 240, 243, 246, 249, 252, 255,   3,   6,   9,  12,  15,
+         18,  21,  24,  27,  30,  33,  36,  39,  42,  45,  48,  51,  54,  57,  60,  63,
+         66,  69,  72,  75,  78,  81,  84,  87,  90,  93,  96,  99, 102, 105, 108, 111,
+        114, 117, 120, 123, 126, 129, 132, 135, 138, 141, 144, 147, 150, 153, 156, 159,
+        162, 165, 168, 171, 174, 177, 180, 183, 186, 189, 192, 195, 198, 201, 204, 207,
+        210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249, 252,
+    },
+    {
+        255,   4,   8,  12,  16,  20,  24,  28,  32,  36,  40,  44,  48,  52,  56,  60,
+         64,  68,  72,  76,  80,  84,  88,  92,  96, 100, 104, 108, 112, 116, 120, 124,
+        128, 132, 136, 140, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188,
+        192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 248, 252,
+          1,   5,   9,  13,  17,  21,  25,  29,  33,  37,  41,  45,  49,  53,  57,  61,
+         65,  69,  73,  77,  81,  85,  89,  93,  97, 101, 105, 109, 113, 117, 121, 125,
+        129, 133, 137, 141, 145, 149, 153, 157, 161, 165, 169, 173, 177, 181, 185, 189,
+        193, 197, 201, 205, 209, 213, 217, 221, 225, 229, 233, 237, 241, 245, 249, 253,
+          2,   6,  10,  14,  18,  22,  26,  30,  34,  38,  42,  46,  50,  54,  58,  62,
+         66,  70,  74,  78,  82,  86,  90,  94,  98, 102, 106, 110, 114, 118, 122, 126,
+        130, 134, 138, 142, 146, 150, 154, 158, 162, 166, 170, 174, 178, 182, 186, 190,
+        194, 198, 202, 206, 210, 214, 218, 222, 226, 230, 234, 238, 242, 246, 250, 254,
+          3,   7,  11,  15,  19,  23,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,
+         67,  71,  75,  79,  83,  87,  91,  95,  99, 103, 107, 111, 115, 119, 123, 127,
+        131, 135, 139, 143, 147, 151, 155, 159, 163, 167, 171, 175, 179, 183, 187, 191,
+        195, 199, 203, 207, 211, 215, 219, 223, 227, 231, 235, 239, 243, 247, 251,
+    },
+    {
+        255,   5,  10,  15,  20,  25,  30,  35,  40,  45,  50,  55,  60,  65,  70,  75,
+         80,  85,  90,  95, 100, 105, 110, 115, 120, 125, 130, 135, 140, 145, 150, 155,
+        160, 165, 170, 175, 180, 185, 190, 195, 200, 205, 210, 215, 220, 225, 230, 235,
+        240, 245, 250, 255,   5,  10,  15,  20,  25,  30,  35,  40,  45,  50,  55,  60,
+         65,  70,  75,  80,  85,  90,  95, 100, 105, 110, 115, 120, 125, 130, 135, 140,
+        145, 150, 155, 160, 165, 170, 175, 180, 185, 190, 195, 200, 205, 210, 215, 220,
+        225, 230, 235, 240, 245, 250, 255,   5,  10,  15,  20,  25,  30,  35,  40,  45,
+         50,  55,  60,  65,  70,  75,  80,  85,  90,  95, 100, 105, 110, 115, 120, 125,
+        130, 135, 140, 145, 150, 155, 160, 165, 170, 175, 180, 185, 190, 195, 200, 205,
+        210, 215, 220, 225, 230, 235, 240, 245, 250, 255,   5,  10,  15,  20,  25,  30,
+         35,  40,  45,  50,  55,  60,  65,  70,  75,  80,  85,  90,  95, 100, 105, 110,
+        115, 120, 125, 130, 135, 140, 145, 150, 155, 160, 165, 170, 175, 180, 185, 190,
+        195, 200, 205, 210, 215, 220, 225, 230, 235, 240, 245, 250, 255,   5,  10,  15,
+         20,  25,  30,  35,  40,  45,  50,  55,  60,  65,  70,  75,  80,  85,  90,  95,
+        100, 105, 110, 115, 120, 125, 130, 135, 140, 145, 150, 155, 160, 165, 170, 175,
+        180, 185, 190, 195, 200, 205, 210, 215, 220, 225, 230, 235, 240, 245, 250,
+    },
+    {
+        255,   6,  12,  18,  24,  30,  36,  42,  48,  54,  60,  66,  72,  78,  84,  90,
+         96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156, 162, 168, 174, 180, 186,
+        192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252,   3,   9,  15,  21,  27,
+         33,  39,  45,  51,  57,  63,  69,  75,  81,  87,  93,  99, 105, 111, 117, 123,
+        129, 135, 141, 147, 153, 159, 165, 171, 177, 183, 189, 195, 201, 207, 213, 219,
+        225, 231, 237, 243, 249, 255,   6,  12,  18,  24,  30,  36,  42,  48,  54,  60,
+         66,  72,  78,  84,  90,  96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156,
+        162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252,
+          3,   9,  15,  21,  27,  33,  39,  45,  51,  57,  63,  69,  75,  81,  87,  93,
+         99, 105, 111, 117, 123, 129, 135, 141, 147, 153, 159, 165, 171, 177, 183, 189,
+        195, 201, 207, 213, 219, 225, 231, 237, 243, 249, 255,   6,  12,  18,  24,  30,
+         36,  42,  48,  54,  60,  66,  72,  78,  84,  90,  96, 102, 108, 114, 120, 126,
+        132, 138, 144, 150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222,
+        228, 234, 240, 246, 252,   3,   9,  15,  21,  27,  33,  39,  45,  51,  57,  63,
+         69,  75,  81,  87,  93,  99, 105, 111, 117, 123, 129, 135, 141, 147, 153, 159,
+        165, 171, 177, 183, 189, 195, 201, 207, 213, 219, 225, 231, 237, 243, 249,
+    },
+    {
+        255,   7,  14,  21,  28,  35,  42,  49,  56,  63,  70,  77,  84,  91,  98, 105,
+        112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+        224, 231, 238, 245, 252,   4,  11,  18,  25,  32,  39,  46,  53,  60,  67,  74,
+         81,  88,  95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186,
+        193, 200, 207, 214, 221, 228, 235, 242, 249,   1,   8,  15,  22,  29,  36,  43,
+         50,  57,  64,  71,  78,  85,  92,  99, 106, 113, 120, 127, 134, 141, 148, 155,
+        162, 169, 176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253,   5,  12,
+         19,  26,  33,  40,  47,  54,  61,  68,  75,  82,  89,  96, 103, 110, 117, 124,
+        131, 138, 145, 152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236,
+        243, 250,   2,   9,  16,  23,  30,  37,  44,  51,  58,  65,  72,  79,  86,  93,
+        100, 107, 114, 121, 128, 135, 142, 149, 156, 163, 170, 177, 184, 191, 198, 205,
+        212, 219, 226, 233, 240, 247, 254,   6,  13,  20,  27,  34,  41,  48,  55,  62,
+         69,  76,  83,  90,  97, 104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174,
+        181, 188, 195, 202, 209, 216, 223, 230, 237, 244, 251,   3,  10,  17,  24,  31,
+         38,  45,  52,  59,  66,  73,  80,  87,  94, 101, 108, 115, 122, 129, 136, 143,
+        150, 157, 164, 171, 178, 185, 192, 199, 206, 213, 220, 227, 234, 241, 248,
+    },
+    {
+        255,   8,  16,  24,  32,  40,  48,  56,  64,  72,  80,  88,  96, 104, 112, 120,
+        128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248,
+          1,   9,  17,  25,  33,  41,  49,  57,  65,  73,  81,  89,  97, 105, 113, 121,
+        129, 137, 145, 153, 161, 169, 177, 185, 193, 201, 209, 217, 225, 233, 241, 249,
+          2,  10,  18,  26,  34,  42,  50,  58,  66,  74,  82,  90,  98, 106, 114, 122,
+        130, 138, 146, 154, 162, 170, 178, 186, 194, 202, 210, 218, 226, 234, 242, 250,
+          3,  11,  19,  27,  35,  43,  51,  59,  67,  75,  83,  91,  99, 107, 115, 123,
+        131, 139, 147, 155, 163, 171, 179, 187, 195, 203, 211, 219, 227, 235, 243, 251,
+          4,  12,  20,  28,  36,  44,  52,  60,  68,  76,  84,  92, 100, 108, 116, 124,
+        132, 140, 148, 156, 164, 172, 180, 188, 196, 204, 212, 220, 228, 236, 244, 252,
+          5,  13,  21,  29,  37,  45,  53,  61,  69,  77,  85,  93, 101, 109, 117, 125,
+        133, 141, 149, 157, 165, 173, 181, 189, 197, 205, 213, 221, 229, 237, 245, 253,
+          6,  14,  22,  30,  38,  46,  54,  62,  70,  78,  86,  94, 102, 110, 118, 126,
+        134, 142, 150, 158, 166, 174, 182, 190, 198, 206, 214, 222, 230, 238, 246, 254,
+          7,  15,  23,  31,  39,  47,  55,  63,  71,  79,  87,  95, 103, 111, 119, 127,
+        135, 143, 151, 159, 167, 175, 183, 191, 199, 207, 215, 223, 231, 239, 247,
+    },
+    {
+        255,   9,  18,  27,  36,  45,  54,  63,  72,  81,  90,  99, 108, 117, 126, 135,
+        144, 153, 162, 171, 180, 189, 198, 207, 216, 225, 234, 243, 252,   6,  15,  24,
+         33,  42,  51,  60,  69,  78,  87,  96, 105, 114, 123, 132, 141, 150, 159, 168,
+        177, 186, 195, 204, 213, 222, 231, 240, 249,   3,  12,  21,  30,  39,  48,  57,
+         66,  75,  84,  93, 102, 111, 120, 129, 138, 147, 156, 165, 174, 183, 192, 201,
+        210, 219, 228, 237, 246, 255,   9,  18,  27,  36,  45,  54,  63,  72,  81,  90,
+         99, 108, 117, 126, 135, 144, 153, 162, 171, 180, 189, 198, 207, 216, 225, 234,
+        243, 252,   6,  15,  24,  33,  42,  51,  60,  69,  78,  87,  96, 105, 114, 123,
+        132, 141, 150, 159, 168, 177, 186, 195, 204, 213, 222, 231, 240, 249,   3,  12,
+         21,  30,  39,  48,  57,  66,  75,  84,  93, 102, 111, 120, 129, 138, 147, 156,
+        165, 174, 183, 192, 201, 210, 219, 228, 237, 246, 255,   9,  18,  27,  36,  45,
+         54,  63,  72,  81,  90,  99, 108, 117, 126, 135, 144, 153, 162, 171, 180, 189,
+        198, 207, 216, 225, 234, 243, 252,   6,  15,  24,  33,  42,  51,  60,  69,  78,
+         87,  96, 105, 114, 123, 132, 141, 150, 159, 168, 177, 186, 195, 204, 213, 222,
+        231, 240, 249,   3,  12,  21,  30,  39,  48,  57,  66,  75,  84,  93, 102, 111,
+        120, 129, 138, 147, 156, 165, 174, 183, 192, 201, 210, 219, 228, 237, 246,
+    },
+    {
+        255,  10,  20,  30,  40,  50,  60,  70,  80,  90, 100, 110, 120, 130, 140, 150,
+        160, 170, 180, 190, 200, 210, 220, 230, 240, 250,   5,  15,  25,  35,  45,  55,
+         65,  75,  85,  95, 105, 115, 125, 135, 145, 155, 165, 175, 185, 195, 205, 215,
+        225, 235, 245, 255,  10,  20,  30,  40,  50,  60,  70,  80,  90, 100, 110, 120,
+        130, 140, 150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250,   5,  15,  25,
+         35,  45,  55,  65,  75,  85,  95, 105, 115, 125, 135, 145, 155, 165, 175, 185,
+        195, 205, 215, 225, 235, 245, 255,  10,  20,  30,  40,  50,  60,  70,  80,  90,
+        100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250,
+          5,  15,  25,  35,  45,  55,  65,  75,  85,  95, 105, 115, 125, 135, 145, 155,
+        165, 175, 185, 195, 205, 215, 225, 235, 245, 255,  10,  20,  30,  40,  50,  60,
+         70,  80,  90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 220,
+        230, 240, 250,   5,  15,  25,  35,  45,  55,  65,  75,  85,  95, 105, 115, 125,
+        135, 145, 155, 165, 175, 185, 195, 205, 215, 225, 235, 245, 255,  10,  20,  30,
+         40,  50,  60,  70,  80,  90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190,
+        200, 210, 220, 230, 240, 250,   5,  15,  25,  35,  45,  55,  65,  75,  85,  95,
+        105, 115, 125, 135, 145, 155, 165, 175, 185, 195, 205, 215, 225, 235, 245,
+    },
+    {
+        255,  11,  22,  33,  44,  55,  66,  77,  88,  99, 110, 121, 132, 143, 154, 165,
+        176, 187, 198, 209, 220, 231, 242, 253,   9,  20,  31,  42,  53,  64,  75,  86,
+         97, 108, 119, 130, 141, 152, 163, 174, 185, 196, 207, 218, 229, 240, 251,   7,
+         18,  29,  40,  51,  62,  73,  84,  95, 106, 117, 128, 139, 150, 161, 172, 183,
+        194, 205, 216, 227, 238, 249,   5,  16,  27,  38,  49,  60,  71,  82,  93, 104,
+        115, 126, 137, 148, 159, 170, 181, 192, 203, 214, 225, 236, 247,   3,  14,  25,
+         36,  47,  58,  69,  80,  91, 102, 113, 124, 135, 146, 157, 168, 179, 190, 201,
+        212, 223, 234, 245,   1,  12,  23,  34,  45,  56,  67,  78,  89, 100, 111, 122,
+        133, 144, 155, 166, 177, 188, 199, 210, 221, 232, 243, 254,  10,  21,  32,  43,
+         54,  65,  76,  87,  98, 109, 120, 131, 142, 153, 164, 175, 186, 197, 208, 219,
+        230, 241, 252,   8,  19,  30,  41,  52,  63,  74,  85,  96, 107, 118, 129, 140,
+        151, 162, 173, 184, 195, 206, 217, 228, 239, 250,   6,  17,  28,  39,  50,  61,
+         72,  83,  94, 105, 116, 127, 138, 149, 160, 171, 182, 193, 204, 215, 226, 237,
+        248,   4,  15,  26,  37,  48,  59,  70,  81,  92, 103, 114, 125, 136, 147, 158,
+        169, 180, 191, 202, 213, 224, 235, 246,   2,  13,  24,  35,  46,  57,  68,  79,
+         90, 101, 112, 123, 134, 145, 156, 167, 178, 189, 200, 211, 222, 233, 244,
+    },
+    {
+        255,  12,  24,  36,  48,  60,  72,  84,  96, 108, 120, 132, 144, 156, 168, 180,
+        192, 204, 216, 228, 240, 252,   9,  21,  33,  45,  57,  69,  81,  93, 105, 117,
+        129, 141, 153, 165, 177, 189, 201, 213, 225, 237, 249,   6,  18,  30,  42,  54,
+         66,  78,  90, 102, 114, 126, 138, 150, 162, 174, 186, 198, 210, 222, 234, 246,
+          3,  15,  27,  39,  51,  63,  75,  87,  99, 111, 123, 135, 147, 159, 171, 183,
+        195, 207, 219, 231, 243, 255,  12,  24,  36,  48,  60,  72,  84,  96, 108, 120,
+        132, 144, 156, 168, 180, 192, 204, 216, 228, 240, 252,   9,  21,  33,  45,  57,
+         69,  81,  93, 105, 117, 129, 141, 153, 165, 177, 189, 201, 213, 225, 237, 249,
+          6,  18,  30,  42,  54,  66,  78,  90, 102, 114, 126, 138, 150, 162, 174, 186,
+        198, 210, 222, 234, 246,   3,  15,  27,  39,  51,  63,  75,  87,  99, 111, 123,
+        135, 147, 159, 171, 183, 195, 207, 219, 231, 243, 255,  12,  24,  36,  48,  60,
+         72,  84,  96, 108, 120, 132, 144, 156, 168, 180, 192, 204, 216, 228, 240, 252,
+          9,  21,  33,  45,  57,  69,  81,  93, 105, 117, 129, 141, 153, 165, 177, 189,
+        201, 213, 225, 237, 249,   6,  18,  30,  42,  54,  66,  78,  90, 102, 114, 126,
+        138, 150, 162, 174, 186, 198, 210, 222, 234, 246,   3,  15,  27,  39,  51,  63,
+         75,  87,  99, 111, 123, 135, 147, 159, 171, 183, 195, 207, 219, 231, 243,
+    },
+    {
+        255,  13,  26,  39,  52,  65,  78,  91, 104, 117, 130, 143, 156, 169, 182, 195,
+        208, 221, 234, 247,   5,  18,  31,  44,  57,  70,  83,  96, 109, 122, 135, 148,
+        161, 174, 187, 200, 213, 226, 239, 252,  10,  23,  36,  49,  62,  75,  88, 101,
+        114, 127, 140, 153, 166, 179, 192, 205, 218, 231, 244,   2,  15,  28,  41,  54,
+         67,  80,  93, 106, 119, 132, 145, 158, 171, 184, 197, 210, 223, 236, 249,   7,
+         20,  33,  46,  59,  72,  85,  98, 111, 124, 137, 150, 163, 176, 189, 202, 215,
+        228, 241, 254,  12,  25,  38,  51,  64,  77,  90, 103, 116, 129, 142, 155, 168,
+        181, 194, 207, 220, 233, 246,   4,  17,  30,  43,  56,  69,  82,  95, 108, 121,
+        134, 147, 160, 173, 186, 199, 212, 225, 238, 251,   9,  22,  35,  48,  61,  74,
+         87, 100, 113, 126, 139, 152, 165, 178, 191, 204, 217, 230, 243,   1,  14,  27,
+         40,  53,  66,  79,  92, 105, 118, 131, 144, 157, 170, 183, 196, 209, 222, 235,
+        248,   6,  19,  32,  45,  58,  71,  84,  97, 110, 123, 136, 149, 162, 175, 188,
+        201, 214, 227, 240, 253,  11,  24,  37,  50,  63,  76,  89, 102, 115, 128, 141,
+        154, 167, 180, 193, 206, 219, 232, 245,   3,  16,  29,  42,  55,  68,  81,  94,
+        107, 120, 133, 146, 159, 172, 185, 198, 211, 224, 237, 250,   8,  21,  34,  47,
+         60,  73,  86,  99, 112, 125, 138, 151, 164, 177, 190, 203, 216, 229, 242,
+    },
+    {
+        255,  14,  28,  42,  56,  70,  84,  98, 112, 126, 140, 154, 168, 182, 196, 210,
+        224, 238, 252,  11,  25,  39,  53,  67,  81,  95, 109, 123, 137, 151, 165, 179,
+        193, 207, 221, 235, 249,   8,  22,  36,  50,  64,  78,  92, 106, 120, 134, 148,
+        162, 176, 190, 204, 218, 232, 246,   5,  19,  33,  47,  61,  75,  89, 103, 117,
+        131, 145, 159, 173, 187, 201, 215, 229, 243,   2,  16,  30,  44,  58,  72,  86,
+        100, 114, 128, 142, 156, 170, 184, 198, 212, 226, 240, 254,  13,  27,  41,  55,
+         69,  83,  97, 111, 125, 139, 153, 167, 181, 195, 209, 223, 237, 251,  10,  24,
+         38,  52,  66,  80,  94, 108, 122, 136, 150, 164, 178, 192, 206, 220, 234, 248,
+          7,  21,  35,  49,  63,  77,  91, 105, 119, 133, 147, 161, 175, 189, 203, 217,
+        231, 245,   4,  18,  32,  46,  60,  74,  88, 102, 116, 130, 144, 158, 172, 186,
+        200, 214, 228, 242,   1,  15,  29,  43,  57,  71,  85,  99, 113, 127, 141, 155,
+        169, 183, 197, 211, 225, 239, 253,  12,  26,  40,  54,  68,  82,  96, 110, 124,
+        138, 152, 166, 180, 194, 208, 222, 236, 250,   9,  23,  37,  51,  65,  79,  93,
+        107, 121, 135, 149, 163, 177, 191, 205, 219, 233, 247,   6,  20,  34,  48,  62,
+         76,  90, 104, 118, 132, 146, 160, 174, 188, 202, 216, 230, 244,   3,  17,  31,
+         45,  59,  73,  87, 101, 115, 129, 143, 157, 171, 185, 199, 213, 227, 241,
+    },
+    {
+        255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225,
+        240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210,
+        225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195,
+        210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180,
+        195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165,
+        180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150,
+        165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135,
+        150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120,
+        135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105,
+        120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90,
+        105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,
+         90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,
+         75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,
+         60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,
+         45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,
+         30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240,
+    },
+    {
+        255,  16,  32,  48,  64,  80,  96, 112, 128, 144, 160, 176, 192, 208, 224, 240,
+          1,  17,  33,  49,  65,  81,  97, 113, 129, 145, 161, 177, 193, 209, 225, 241,
+          2,  18,  34,  50,  66,  82,  98, 114, 130, 146, 162, 178, 194, 210, 226, 242,
+          3,  19,  35,  51,  67,  83,  99, 115, 131, 147, 163, 179, 195, 211, 227, 243,
+          4,  20,  36,  52,  68,  84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244,
+          5,  21,  37,  53,  69,  85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245,
+          6,  22,  38,  54,  70,  86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246,
+          7,  23,  39,  55,  71,  87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247,
+          8,  24,  40,  56,  72,  88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248,
+          9,  25,  41,  57,  73,  89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249,
+         10,  26,  42,  58,  74,  90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250,
+         11,  27,  43,  59,  75,  91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251,
+         12,  28,  44,  60,  76,  92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252,
+         13,  29,  45,  61,  77,  93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253,
+         14,  30,  46,  62,  78,  94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254,
+         15,  31,  47,  63,  79,  95, 111, 127, 143, 159, 175, 191, 207, 223, 239,
+    },
+    {
+        255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,
+         17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,  17,
+         34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,  17,  34,
+         51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,  17,  34,  51,
+         68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,  17,  34,  51,  68,
+         85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,  17,  34,  51,  68,  85,
+        102, 119, 136, 153, 170, 187, 204, 221, 238, 255,  17,  34,  51,  68,  85, 102,
+        119, 136, 153, 170, 187, 204, 221, 238, 255,  17,  34,  51,  68,  85, 102, 119,
+        136, 153, 170, 187, 204, 221, 238, 255,  17,  34,  51,  68,  85, 102, 119, 136,
+        153, 170, 187, 204, 221, 238, 255,  17,  34,  51,  68,  85, 102, 119, 136, 153,
+        170, 187, 204, 221, 238, 255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170,
+        187, 204, 221, 238, 255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187,
+        204, 221, 238, 255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204,
+        221, 238, 255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221,
+        238, 255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238,
+        255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238,
+    },
+    {
+        255,  18,  36,  54,  72,  90, 108, 126, 144, 162, 180, 198, 216, 234, 252,  15,
+         33,  51,  69,  87, 105, 123, 141, 159, 177, 195, 213, 231, 249,  12,  30,  48,
+         66,  84, 102, 120, 138, 156, 174, 192, 210, 228, 246,   9,  27,  45,  63,  81,
+         99, 117, 135, 153, 171, 189, 207, 225, 243,   6,  24,  42,  60,  78,  96, 114,
+        132, 150, 168, 186, 204, 222, 240,   3,  21,  39,  57,  75,  93, 111, 129, 147,
+        165, 183, 201, 219, 237, 255,  18,  36,  54,  72,  90, 108, 126, 144, 162, 180,
+        198, 216, 234, 252,  15,  33,  51,  69,  87, 105, 123, 141, 159, 177, 195, 213,
+        231, 249,  12,  30,  48,  66,  84, 102, 120, 138, 156, 174, 192, 210, 228, 246,
+          9,  27,  45,  63,  81,  99, 117, 135, 153, 171, 189, 207, 225, 243,   6,  24,
+         42,  60,  78,  96, 114, 132, 150, 168, 186, 204, 222, 240,   3,  21,  39,  57,
+         75,  93, 111, 129, 147, 165, 183, 201, 219, 237, 255,  18,  36,  54,  72,  90,
+        108, 126, 144, 162, 180, 198, 216, 234, 252,  15,  33,  51,  69,  87, 105, 123,
+        141, 159, 177, 195, 213, 231, 249,  12,  30,  48,  66,  84, 102, 120, 138, 156,
+        174, 192, 210, 228, 246,   9,  27,  45,  63,  81,  99, 117, 135, 153, 171, 189,
+        207, 225, 243,   6,  24,  42,  60,  78,  96, 114, 132, 150, 168, 186, 204, 222,
+        240,   3,  21,  39,  57,  75,  93, 111, 129, 147, 165, 183, 201, 219, 237,
+    },
+    {
+        255,  19,  38,  57,  76,  95, 114, 133, 152, 171, 190, 209, 228, 247,  11,  30,
+         49,  68,  87, 106, 125, 144, 163, 182, 201, 220, 239,   3,  22,  41,  60,  79,
+         98, 117, 136, 155, 174, 193, 212, 231, 250,  14,  33,  52,  71,  90, 109, 128,
+        147, 166, 185, 204, 223, 242,   6,  25,  44,  63,  82, 101, 120, 139, 158, 177,
+        196, 215, 234, 253,  17,  36,  55,  74,  93, 112, 131, 150, 169, 188, 207, 226,
+        245,   9,  28,  47,  66,  85, 104, 123, 142, 161, 180, 199, 218, 237,   1,  20,
+         39,  58,  77,  96, 115, 134, 153, 172, 191, 210, 229, 248,  12,  31,  50,  69,
+         88, 107, 126, 145, 164, 183, 202, 221, 240,   4,  23,  42,  61,  80,  99, 118,
+        137, 156, 175, 194, 213, 232, 251,  15,  34,  53,  72,  91, 110, 129, 148, 167,
+        186, 205, 224, 243,   7,  26,  45,  64,  83, 102, 121, 140, 159, 178, 197, 216,
+        235, 254,  18,  37,  56,  75,  94, 113, 132, 151, 170, 189, 208, 227, 246,  10,
+         29,  48,  67,  86, 105, 124, 143, 162, 181, 200, 219, 238,   2,  21,  40,  59,
+         78,  97, 116, 135, 154, 173, 192, 211, 230, 249,  13,  32,  51,  70,  89, 108,
+        127, 146, 165, 184, 203, 222, 241,   5,  24,  43,  62,  81, 100, 119, 138, 157,
+        176, 195, 214, 233, 252,  16,  35,  54,  73,  92, 111, 130, 149, 168, 187, 206,
+        225, 244,   8,  27,  46,  65,  84, 103, 122, 141, 160, 179, 198, 217, 236,
+    },
+    {
+        255,  20,  40,  60,  80, 100, 120, 140, 160, 180, 200, 220, 240,   5,  25,  45,
+         65,  85, 105, 125, 145, 165, 185, 205, 225, 245,  10,  30,  50,  70,  90, 110,
+        130, 150, 170, 190, 210, 230, 250,  15,  35,  55,  75,  95, 115, 135, 155, 175,
+        195, 215, 235, 255,  20,  40,  60,  80, 100, 120, 140, 160, 180, 200, 220, 240,
+          5,  25,  45,  65,  85, 105, 125, 145, 165, 185, 205, 225, 245,  10,  30,  50,
+         70,  90, 110, 130, 150, 170, 190, 210, 230, 250,  15,  35,  55,  75,  95, 115,
+        135, 155, 175, 195, 215, 235, 255,  20,  40,  60,  80, 100, 120, 140, 160, 180,
+        200, 220, 240,   5,  25,  45,  65,  85, 105, 125, 145, 165, 185, 205, 225, 245,
+         10,  30,  50,  70,  90, 110, 130, 150, 170, 190, 210, 230, 250,  15,  35,  55,
+         75,  95, 115, 135, 155, 175, 195, 215, 235, 255,  20,  40,  60,  80, 100, 120,
+        140, 160, 180, 200, 220, 240,   5,  25,  45,  65,  85, 105, 125, 145, 165, 185,
+        205, 225, 245,  10,  30,  50,  70,  90, 110, 130, 150, 170, 190, 210, 230, 250,
+         15,  35,  55,  75,  95, 115, 135, 155, 175, 195, 215, 235, 255,  20,  40,  60,
+         80, 100, 120, 140, 160, 180, 200, 220, 240,   5,  25,  45,  65,  85, 105, 125,
+        145, 165, 185, 205, 225, 245,  10,  30,  50,  70,  90, 110, 130, 150, 170, 190,
+        210, 230, 250,  15,  35,  55,  75,  95, 115, 135, 155, 175, 195, 215, 235,
+    },
+    {
+        255,  21,  42,  63,  84, 105, 126, 147, 168, 189, 210, 231, 252,  18,  39,  60,
+         81, 102, 123, 144, 165, 186, 207, 228, 249,  15,  36,  57,  78,  99, 120, 141,
+        162, 183, 204, 225, 246,  12,  33,  54,  75,  96, 117, 138, 159, 180, 201, 222,
+        243,   9,  30,  51,  72,  93, 114, 135, 156, 177, 198, 219, 240,   6,  27,  48,
+         69,  90, 111, 132, 153, 174, 195, 216, 237,   3,  24,  45,  66,  87, 108, 129,
+        150, 171, 192, 213, 234, 255,  21,  42,  63,  84, 105, 126, 147, 168, 189, 210,
+        231, 252,  18,  39,  60,  81, 102, 123, 144, 165, 186, 207, 228, 249,  15,  36,
+         57,  78,  99, 120, 141, 162, 183, 204, 225, 246,  12,  33,  54,  75,  96, 117,
+        138, 159, 180, 201, 222, 243,   9,  30,  51,  72,  93, 114, 135, 156, 177, 198,
+        219, 240,   6,  27,  48,  69,  90, 111, 132, 153, 174, 195, 216, 237,   3,  24,
+         45,  66,  87, 108, 129, 150, 171, 192, 213, 234, 255,  21,  42,  63,  84, 105,
+        126, 147, 168, 189, 210, 231, 252,  18,  39,  60,  81, 102, 123, 144, 165, 186,
+        207, 228, 249,  15,  36,  57,  78,  99, 120, 141, 162, 183, 204, 225, 246,  12,
+         33,  54,  75,  96, 117, 138, 159, 180, 201, 222, 243,   9,  30,  51,  72,  93,
+        114, 135, 156, 177, 198, 219, 240,   6,  27,  48,  69,  90, 111, 132, 153, 174,
+        195, 216, 237,   3,  24,  45,  66,  87, 108, 129, 150, 171, 192, 213, 234,
+    },
+    {
+        255,  22,  44,  66,  88, 110, 132, 154, 176, 198, 220, 242,   9,  31,  53,  75,
+         97, 119, 141, 163, 185, 207, 229, 251,  18,  40,  62,  84, 106, 128, 150, 172,
+        194, 216, 238,   5,  27,  49,  71,  93, 115, 137, 159, 181, 203, 225, 247,  14,
+         36,  58,  80, 102, 124, 146, 168, 190, 212, 234,   1,  23,  45,  67,  89, 111,
+        133, 155, 177, 199, 221, 243,  10,  32,  54,  76,  98, 120, 142, 164, 186, 208,
+        230, 252,  19,  41,  63,  85, 107, 129, 151, 173, 195, 217, 239,   6,  28,  50,
+         72,  94, 116, 138, 160, 182, 204, 226, 248,  15,  37,  59,  81, 103, 125, 147,
+        169, 191, 213, 235,   2,  24,  46,  68,  90, 112, 134, 156, 178, 200, 222, 244,
+         11,  33,  55,  77,  99, 121, 143, 165, 187, 209, 231, 253,  20,  42,  64,  86,
+        108, 130, 152, 174, 196, 218, 240,   7,  29,  51,  73,  95, 117, 139, 161, 183,
+        205, 227, 249,  16,  38,  60,  82, 104, 126, 148, 170, 192, 214, 236,   3,  25,
+         47,  69,  91, 113, 135, 157, 179, 201, 223, 245,  12,  34,  56,  78, 100, 122,
+        144, 166, 188, 210, 232, 254,  21,  43,  65,  87, 109, 131, 153, 175, 197, 219,
+        241,   8,  30,  52,  74,  96, 118, 140, 162, 184, 206, 228, 250,  17,  39,  61,
+         83, 105, 127, 149, 171, 193, 215, 237,   4,  26,  48,  70,  92, 114, 136, 158,
+        180, 202, 224, 246,  13,  35,  57,  79, 101, 123, 145, 167, 189, 211, 233,
+    },
+    {
+        255,  23,  46,  69,  92, 115, 138, 161, 184, 207, 230, 253,  21,  44,  67,  90,
+        113, 136, 159, 182, 205, 228, 251,  19,  42,  65,  88, 111, 134, 157, 180, 203,
+        226, 249,  17,  40,  63,  86, 109, 132, 155, 178, 201, 224, 247,  15,  38,  61,
+         84, 107, 130, 153, 176, 199, 222, 245,  13,  36,  59,  82, 105, 128, 151, 174,
+        197, 220, 243,  11,  34,  57,  80, 103, 126, 149, 172, 195, 218, 241,   9,  32,
+         55,  78, 101, 124, 147, 170, 193, 216, 239,   7,  30,  53,  76,  99, 122, 145,
+        168, 191, 214, 237,   5,  28,  51,  74,  97, 120, 143, 166, 189, 212, 235,   3,
+         26,  49,  72,  95, 118, 141, 164, 187, 210, 233,   1,  24,  47,  70,  93, 116,
+        139, 162, 185, 208, 231, 254,  22,  45,  68,  91, 114, 137, 160, 183, 206, 229,
+        252,  20,  43,  66,  89, 112, 135, 158, 181, 204, 227, 250,  18,  41,  64,  87,
+        110, 133, 156, 179, 202, 225, 248,  16,  39,  62,  85, 108, 131, 154, 177, 200,
+        223, 246,  14,  37,  60,  83, 106, 129, 152, 175, 198, 221, 244,  12,  35,  58,
+         81, 104, 127, 150, 173, 196, 219, 242,  10,  33,  56,  79, 102, 125, 148, 171,
+        194, 217, 240,   8,  31,  54,  77, 100, 123, 146, 169, 192, 215, 238,   6,  29,
+         52,  75,  98, 121, 144, 167, 190, 213, 236,   4,  27,  50,  73,  96, 119, 142,
+        165, 188, 211, 234,   2,  25,  48,  71,  94, 117, 140, 163, 186, 209, 232,
+    },
+    {
+        255,  24,  48,  72,  96, 120, 144, 168, 192, 216, 240,   9,  33,  57,  81, 105,
+        129, 153, 177, 201, 225, 249,  18,  42,  66,  90, 114, 138, 162, 186, 210, 234,
+          3,  27,  51,  75,  99, 123, 147, 171, 195, 219, 243,  12,  36,  60,  84, 108,
+        132, 156, 180, 204, 228, 252,  21,  45,  69,  93, 117, 141, 165, 189, 213, 237,
+          6,  30,  54,  78, 102, 126, 150, 174, 198, 222, 246,  15,  39,  63,  87, 111,
+        135, 159, 183, 207, 231, 255,  24,  48,  72,  96, 120, 144, 168, 192, 216, 240,
+          9,  33,  57,  81, 105, 129, 153, 177, 201, 225, 249,  18,  42,  66,  90, 114,
+        138, 162, 186, 210, 234,   3,  27,  51,  75,  99, 123, 147, 171, 195, 219, 243,
+         12,  36,  60,  84, 108, 132, 156, 180, 204, 228, 252,  21,  45,  69,  93, 117,
+        141, 165, 189, 213, 237,   6,  30,  54,  78, 102, 126, 150, 174, 198, 222, 246,
+         15,  39,  63,  87, 111, 135, 159, 183, 207, 231, 255,  24,  48,  72,  96, 120,
+        144, 168, 192, 216, 240,   9,  33,  57,  81, 105, 129, 153, 177, 201, 225, 249,
+         18,  42,  66,  90, 114, 138, 162, 186, 210, 234,   3,  27,  51,  75,  99, 123,
+        147, 171, 195, 219, 243,  12,  36,  60,  84, 108, 132, 156, 180, 204, 228, 252,
+         21,  45,  69,  93, 117, 141, 165, 189, 213, 237,   6,  30,  54,  78, 102, 126,
+        150, 174, 198, 222, 246,  15,  39,  63,  87, 111, 135, 159, 183, 207, 231,
+    },
+    {
+        255,  25,  50,  75, 100, 125, 150, 175, 200, 225, 250,  20,  45,  70,  95, 120,
+        145, 170, 195, 220, 245,  15,  40,  65,  90, 115, 140, 165, 190, 215, 240,  10,
+         35,  60,  85, 110, 135, 160, 185, 210, 235,   5,  30,  55,  80, 105, 130, 155,
+        180, 205, 230, 255,  25,  50,  75, 100, 125, 150, 175, 200, 225, 250,  20,  45,
+         70,  95, 120, 145, 170, 195, 220, 245,  15,  40,  65,  90, 115, 140, 165, 190,
+        215, 240,  10,  35,  60,  85, 110, 135, 160, 185, 210, 235,   5,  30,  55,  80,
+        105, 130, 155, 180, 205, 230, 255,  25,  50,  75, 100, 125, 150, 175, 200, 225,
+        250,  20,  45,  70,  95, 120, 145, 170, 195, 220, 245,  15,  40,  65,  90, 115,
+        140, 165, 190, 215, 240,  10,  35,  60,  85, 110, 135, 160, 185, 210, 235,   5,
+         30,  55,  80, 105, 130, 155, 180, 205, 230, 255,  25,  50,  75, 100, 125, 150,
+        175, 200, 225, 250,  20,  45,  70,  95, 120, 145, 170, 195, 220, 245,  15,  40,
+         65,  90, 115, 140, 165, 190, 215, 240,  10,  35,  60,  85, 110, 135, 160, 185,
+        210, 235,   5,  30,  55,  80, 105, 130, 155, 180, 205, 230, 255,  25,  50,  75,
+        100, 125, 150, 175, 200, 225, 250,  20,  45,  70,  95, 120, 145, 170, 195, 220,
+        245,  15,  40,  65,  90, 115, 140, 165, 190, 215, 240,  10,  35,  60,  85, 110,
+        135, 160, 185, 210, 235,   5,  30,  55,  80, 105, 130, 155, 180, 205, 230,
+    },
+    {
+        255,  26,  52,  78, 104, 130, 156, 182, 208, 234,   5,  31,  57,  83, 109, 135,
+        161, 187, 213, 239,  10,  36,  62,  88, 114, 140, 166, 192, 218, 244,  15,  41,
+         67,  93, 119, 145, 171, 197, 223, 249,  20,  46,  72,  98, 124, 150, 176, 202,
+        228, 254,  25,  51,  77, 103, 129, 155, 181, 207, 233,   4,  30,  56,  82, 108,
+        134, 160, 186, 212, 238,   9,  35,  61,  87, 113, 139, 165, 191, 217, 243,  14,
+         40,  66,  92, 118, 144, 170, 196, 222, 248,  19,  45,  71,  97, 123, 149, 175,
+        201, 227, 253,  24,  50,  76, 102, 128, 154, 180, 206, 232,   3,  29,  55,  81,
+        107, 133, 159, 185, 211, 237,   8,  34,  60,  86, 112, 138, 164, 190, 216, 242,
+         13,  39,  65,  91, 117, 143, 169, 195, 221, 247,  18,  44,  70,  96, 122, 148,
+        174, 200, 226, 252,  23,  49,  75, 101, 127, 153, 179, 205, 231,   2,  28,  54,
+         80, 106, 132, 158, 184, 210, 236,   7,  33,  59,  85, 111, 137, 163, 189, 215,
+        241,  12,  38,  64,  90, 116, 142, 168, 194, 220, 246,  17,  43,  69,  95, 121,
+        147, 173, 199, 225, 251,  22,  48,  74, 100, 126, 152, 178, 204, 230,   1,  27,
+         53,  79, 105, 131, 157, 183, 209, 235,   6,  32,  58,  84, 110, 136, 162, 188,
+        214, 240,  11,  37,  63,  89, 115, 141, 167, 193, 219, 245,  16,  42,  68,  94,
+        120, 146, 172, 198, 224, 250,  21,  47,  73,  99, 125, 151, 177, 203, 229,
+    },
+    {
+        255,  27,  54,  81, 108, 135, 162, 189, 216, 243,  15,  42,  69,  96, 123, 150,
+        177, 204, 231,   3,  30,  57,  84, 111, 138, 165, 192, 219, 246,  18,  45,  72,
+         99, 126, 153, 180, 207, 234,   6,  33,  60,  87, 114, 141, 168, 195, 222, 249,
+         21,  48,  75, 102, 129, 156, 183, 210, 237,   9,  36,  63,  90, 117, 144, 171,
+        198, 225, 252,  24,  51,  78, 105, 132, 159, 186, 213, 240,  12,  39,  66,  93,
+        120, 147, 174, 201, 228, 255,  27,  54,  81, 108, 135, 162, 189, 216, 243,  15,
+         42,  69,  96, 123, 150, 177, 204, 231,   3,  30,  57,  84, 111, 138, 165, 192,
+        219, 246,  18,  45,  72,  99, 126, 153, 180, 207, 234,   6,  33,  60,  87, 114,
+        141, 168, 195, 222, 249,  21,  48,  75, 102, 129, 156, 183, 210, 237,   9,  36,
+         63,  90, 117, 144, 171, 198, 225, 252,  24,  51,  78, 105, 132, 159, 186, 213,
+        240,  12,  39,  66,  93, 120, 147, 174, 201, 228, 255,  27,  54,  81, 108, 135,
+        162, 189, 216, 243,  15,  42,  69,  96, 123, 150, 177, 204, 231,   3,  30,  57,
+         84, 111, 138, 165, 192, 219, 246,  18,  45,  72,  99, 126, 153, 180, 207, 234,
+          6,  33,  60,  87, 114, 141, 168, 195, 222, 249,  21,  48,  75, 102, 129, 156,
+        183, 210, 237,   9,  36,  63,  90, 117, 144, 171, 198, 225, 252,  24,  51,  78,
+        105, 132, 159, 186, 213, 240,  12,  39,  66,  93, 120, 147, 174, 201, 228,
+    },
+    {
+        255,  28,  56,  84, 112, 140, 168, 196, 224, 252,  25,  53,  81, 109, 137, 165,
+        193, 221, 249,  22,  50,  78, 106, 134, 162, 190, 218, 246,  19,  47,  75, 103,
+        131, 159, 187, 215, 243,  16,  44,  72, 100, 128, 156, 184, 212, 240,  13,  41,
+         69,  97, 125, 153, 181, 209, 237,  10,  38,  66,  94, 122, 150, 178, 206, 234,
+          7,  35,  63,  91, 119, 147, 175, 203, 231,   4,  32,  60,  88, 116, 144, 172,
+        200, 228,   1,  29,  57,  85, 113, 141, 169, 197, 225, 253,  26,  54,  82, 110,
+        138, 166, 194, 222, 250,  23,  51,  79, 107, 135, 163, 191, 219, 247,  20,  48,
+         76, 104, 132, 160, 188, 216, 244,  17,  45,  73, 101, 129, 157, 185, 213, 241,
+         14,  42,  70,  98, 126, 154, 182, 210, 238,  11,  39,  67,  95, 123, 151, 179,
+        207, 235,   8,  36,  64,  92, 120, 148, 176, 204, 232,   5,  33,  61,  89, 117,
+        145, 173, 201, 229,   2,  30,  58,  86, 114, 142, 170, 198, 226, 254,  27,  55,
+         83, 111, 139, 167, 195, 223, 251,  24,  52,  80, 108, 136, 164, 192, 220, 248,
+         21,  49,  77, 105, 133, 161, 189, 217, 245,  18,  46,  74, 102, 130, 158, 186,
+        214, 242,  15,  43,  71,  99, 127, 155, 183, 211, 239,  12,  40,  68,  96, 124,
+        152, 180, 208, 236,   9,  37,  65,  93, 121, 149, 177, 205, 233,   6,  34,  62,
+         90, 118, 146, 174, 202, 230,   3,  31,  59,  87, 115, 143, 171, 199, 227,
+    },
+    {
+        255,  29,  58,  87, 116, 145, 174, 203, 232,   6,  35,  64,  93, 122, 151, 180,
+        209, 238,  12,  41,  70,  99, 128, 157, 186, 215, 244,  18,  47,  76, 105, 134,
+        163, 192, 221, 250,  24,  53,  82, 111, 140, 169, 198, 227,   1,  30,  59,  88,
+        117, 146, 175, 204, 233,   7,  36,  65,  94, 123, 152, 181, 210, 239,  13,  42,
+         71, 100, 129, 158, 187, 216, 245,  19,  48,  77, 106, 135, 164, 193, 222, 251,
+         25,  54,  83, 112, 141, 170, 199, 228,   2,  31,  60,  89, 118, 147, 176, 205,
+        234,   8,  37,  66,  95, 124, 153, 182, 211, 240,  14,  43,  72, 101, 130, 159,
+        188, 217, 246,  20,  49,  78, 107, 136, 165, 194, 223, 252,  26,  55,  84, 113,
+        142, 171, 200, 229,   3,  32,  61,  90, 119, 148, 177, 206, 235,   9,  38,  67,
+         96, 125, 154, 183, 212, 241,  15,  44,  73, 102, 131, 160, 189, 218, 247,  21,
+         50,  79, 108, 137, 166, 195, 224, 253,  27,  56,  85, 114, 143, 172, 201, 230,
+          4,  33,  62,  91, 120, 149, 178, 207, 236,  10,  39,  68,  97, 126, 155, 184,
+        213, 242,  16,  45,  74, 103, 132, 161, 190, 219, 248,  22,  51,  80, 109, 138,
+        167, 196, 225, 254,  28,  57,  86, 115, 144, 173, 202, 231,   5,  34,  63,  92,
+        121, 150, 179, 208, 237,  11,  40,  69,  98, 127, 156, 185, 214, 243,  17,  46,
+         75, 104, 133, 162, 191, 220, 249,  23,  52,  81, 110, 139, 168, 197, 226,
+    },
+    {
+        255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,  75, 105, 135, 165, 195,
+        225, 255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,  75, 105, 135, 165,
+        195, 225, 255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,  75, 105, 135,
+        165, 195, 225, 255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,  75, 105,
+        135, 165, 195, 225, 255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,  75,
+        105, 135, 165, 195, 225, 255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,
+         75, 105, 135, 165, 195, 225, 255,  30,  60,  90, 120, 150, 180, 210, 240,  15,
+         45,  75, 105, 135, 165, 195, 225, 255,  30,  60,  90, 120, 150, 180, 210, 240,
+         15,  45,  75, 105, 135, 165, 195, 225, 255,  30,  60,  90, 120, 150, 180, 210,
+        240,  15,  45,  75, 105, 135, 165, 195, 225, 255,  30,  60,  90, 120, 150, 180,
+        210, 240,  15,  45,  75, 105, 135, 165, 195, 225, 255,  30,  60,  90, 120, 150,
+        180, 210, 240,  15,  45,  75, 105, 135, 165, 195, 225, 255,  30,  60,  90, 120,
+        150, 180, 210, 240,  15,  45,  75, 105, 135, 165, 195, 225, 255,  30,  60,  90,
+        120, 150, 180, 210, 240,  15,  45,  75, 105, 135, 165, 195, 225, 255,  30,  60,
+         90, 120, 150, 180, 210, 240,  15,  45,  75, 105, 135, 165, 195, 225, 255,  30,
+         60,  90, 120, 150, 180, 210, 240,  15,  45,  75, 105, 135, 165, 195, 225,
+    },
+    {
+        255,  31,  62,  93, 124, 155, 186, 217, 248,  24,  55,  86, 117, 148, 179, 210,
+        241,  17,  48,  79, 110, 141, 172, 203, 234,  10,  41,  72, 103, 134, 165, 196,
+        227,   3,  34,  65,  96, 127, 158, 189, 220, 251,  27,  58,  89, 120, 151, 182,
+        213, 244,  20,  51,  82, 113, 144, 175, 206, 237,  13,  44,  75, 106, 137, 168,
+        199, 230,   6,  37,  68,  99, 130, 161, 192, 223, 254,  30,  61,  92, 123, 154,
+        185, 216, 247,  23,  54,  85, 116, 147, 178, 209, 240,  16,  47,  78, 109, 140,
+        171, 202, 233,   9,  40,  71, 102, 133, 164, 195, 226,   2,  33,  64,  95, 126,
+        157, 188, 219, 250,  26,  57,  88, 119, 150, 181, 212, 243,  19,  50,  81, 112,
+        143, 174, 205, 236,  12,  43,  74, 105, 136, 167, 198, 229,   5,  36,  67,  98,
+        129, 160, 191, 222, 253,  29,  60,  91, 122, 153, 184, 215, 246,  22,  53,  84,
+        115, 146, 177, 208, 239,  15,  46,  77, 108, 139, 170, 201, 232,   8,  39,  70,
+        101, 132, 163, 194, 225,   1,  32,  63,  94, 125, 156, 187, 218, 249,  25,  56,
+         87, 118, 149, 180, 211, 242,  18,  49,  80, 111, 142, 173, 204, 235,  11,  42,
+         73, 104, 135, 166, 197, 228,   4,  35,  66,  97, 128, 159, 190, 221, 252,  28,
+         59,  90, 121, 152, 183, 214, 245,  21,  52,  83, 114, 145, 176, 207, 238,  14,
+         45,  76, 107, 138, 169, 200, 231,   7,  38,  69, 100, 131, 162, 193, 224,
+    },
+    {
+        255,  32,  64,  96, 128, 160, 192, 224,   1,  33,  65,  97, 129, 161, 193, 225,
+          2,  34,  66,  98, 130, 162, 194, 226,   3,  35,  67,  99, 131, 163, 195, 227,
+          4,  36,  68, 100, 132, 164, 196, 228,   5,  37,  69, 101, 133, 165, 197, 229,
+          6,  38,  70, 102, 134, 166, 198, 230,   7,  39,  71, 103, 135, 167, 199, 231,
+          8,  40,  72, 104, 136, 168, 200, 232,   9,  41,  73, 105, 137, 169, 201, 233,
+         10,  42,  74, 106, 138, 170, 202, 234,  11,  43,  75, 107, 139, 171, 203, 235,
+         12,  44,  76, 108, 140, 172, 204, 236,  13,  45,  77, 109, 141, 173, 205, 237,
+         14,  46,  78, 110, 142, 174, 206, 238,  15,  47,  79, 111, 143, 175, 207, 239,
+         16,  48,  80, 112, 144, 176, 208, 240,  17,  49,  81, 113, 145, 177, 209, 241,
+         18,  50,  82, 114, 146, 178, 210, 242,  19,  51,  83, 115, 147, 179, 211, 243,
+         20,  52,  84, 116, 148, 180, 212, 244,  21,  53,  85, 117, 149, 181, 213, 245,
+         22,  54,  86, 118, 150, 182, 214, 246,  23,  55,  87, 119, 151, 183, 215, 247,
+         24,  56,  88, 120, 152, 184, 216, 248,  25,  57,  89, 121, 153, 185, 217, 249,
+         26,  58,  90, 122, 154, 186, 218, 250,  27,  59,  91, 123, 155, 187, 219, 251,
+         28,  60,  92, 124, 156, 188, 220, 252,  29,  61,  93, 125, 157, 189, 221, 253,
+         30,  62,  94, 126, 158, 190, 222, 254,  31,  63,  95, 127, 159, 191, 223,
+    },
+};
+
+static field_logarithm_t *const ccsds_255_223_generator_root_exp_rows[32] = {
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[0],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[1],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[2],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[3],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[4],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[5],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[6],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[7],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[8],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[9],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[10],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[11],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[12],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[13],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[14],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[15],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[16],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[17],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[18],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[19],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[20],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[21],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[22],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[23],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[24],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[25],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[26],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[27],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[28],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[29],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[30],
+    (field_logarithm_t *)ccsds_255_223_generator_root_exp[31],
+};
+
+static const field_logarithm_t ccsds_255_223_element_exp[256][32] = {
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    },
+    {
+        255,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+         16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+    },
+    {
+        255,  99, 198,  42, 141, 240,  84, 183,  27, 126, 225,  69, 168,  12, 111, 210,
+         54, 153, 252,  96, 195,  39, 138, 237,  81, 180,  24, 123, 222,  66, 165,   9,
+    },
+    {
+        255,   2,   4,   6,   8,  10,  12,  14,  16,  18,  20,  22,  24,  26,  28,  30,
+         32,  34,  36,  38,  40,  42,  44,  46,  48,  50,  52,  54,  56,  58,  60,  62,
+    },
+    {
+        255, 198, 141,  84,  27, 225, 168, 111,  54, 252, 195, 138,  81,  24, 222, 165,
+        108,  51, 249, 192, 135,  78,  21, 219, 162, 105,  48, 246, 189, 132,  75,  18,
+    },
+    {
+        255, 100, 200,  45, 145, 245,  90, 190,  35, 135, 235,  80, 180,  25, 125, 225,
+         70, 170,  15, 115, 215,  60, 160,   5, 105, 205,  50, 150, 250,  95, 195,  40,
+    },
+    {
+        255, 106, 212,  63, 169,  20, 126, 232,  83, 189,  40, 146, 252, 103, 209,  60,
+        166,  17, 123, 229,  80, 186,  37, 143, 249, 100, 206,  57, 163,  14, 120, 226,
+    },
+    {
+        255,   3,   6,   9,  12,  15,  18,  21,  24,  27,  30,  33,  36,  39,  42,  45,
+         48,  51,  54,  57,  60,  63,  66,  69,  72,  75,  78,  81,  84,  87,  90,  93,
+    },
+    {
+        255, 205, 155, 105,  55,   5, 210, 160, 110,  60,  10, 215, 165, 115,  65,  15,
+        220, 170, 120,  70,  20, 225, 175, 125,  75,  25, 230, 180, 130,  80,  30, 235,
+    },
+    {
+        255, 199, 143,  87,  31, 230, 174, 118,  62,   6, 205, 149,  93,  37, 236, 180,
+        124,  68,  12, 211, 155,  99,  43, 242, 186, 130,  74,  18, 217, 161, 105,  49,
+    },
+    {
+        255, 188, 121,  54, 242, 175, 108,  41, 229, 162,  95,  28, 216, 149,  82,  15,
+        203, 136,  69,   2, 190, 123,  56, 244, 177, 110,  43, 231, 164,  97,  30, 218,
+    },
+    {
+        255, 101, 202,  48, 149, 250,  96, 197,  43, 144, 245,  91, 192,  38, 139, 240,
+         86, 187,  33, 134, 235,  81, 182,  28, 129, 230,  76, 177,  23, 124, 225,  71,
+    },
+    {
+        255, 126, 252, 123, 249, 120, 246, 117, 243, 114, 240, 111, 237, 108, 234, 105,
+        231, 102, 228,  99, 225,  96, 222,  93, 219,  90, 216,  87, 213,  84, 210,  81,
+    },
+    {
+        255, 107, 214,  66, 173,  25, 132, 239,  91, 198,  50, 157,   9, 116, 223,  75,
+        182,  34, 141, 248, 100, 207,  59, 166,  18, 125, 232,  84, 191,  43, 150,   2,
+    },
+    {
+        255,  42,  84, 126, 168, 210, 252,  39,  81, 123, 165, 207, 249,  36,  78, 120,
+        162, 204, 246,  33,  75, 117, 159, 201, 243,  30,  72, 114, 156, 198, 240,  27,
+    },
+    {
+        255,   4,   8,  12,  16,  20,  24,  28,  32,  36,  40,  44,  48,  52,  56,  60,
+         64,  68,  72,  76,  80,  84,  88,  92,  96, 100, 104, 108, 112, 116, 120, 124,
+    },
+    {
+        255, 141,  27, 168,  54, 195,  81, 222, 108, 249, 135,  21, 162,  48, 189,  75,
+        216, 102, 243, 129,  15, 156,  42, 183,  69, 210,  96, 237, 123,   9, 150,  36,
+    },
+    {
+        255, 206, 157, 108,  59,  10, 216, 167, 118,  69,  20, 226, 177, 128,  79,  30,
+        236, 187, 138,  89,  40, 246, 197, 148,  99,  50,   1, 207, 158, 109,  60,  11,
+    },
+    {
+        255,  78, 156, 234,  57, 135, 213,  36, 114, 192,  15,  93, 171, 249,  72, 150,
+        228,  51, 129, 207,  30, 108, 186,   9,  87, 165, 243,  66, 144, 222,  45, 123,
+    },
+    {
+        255, 200, 145,  90,  35, 235, 180, 125,  70,  15, 215, 160, 105,  50, 250, 195,
+        140,  85,  30, 230, 175, 120,  65,  10, 210, 155, 100,  45, 245, 190, 135,  80,
+    },
+    {
+        255, 212, 169, 126,  83,  40, 252, 209, 166, 123,  80,  37, 249, 206, 163, 120,
+         77,  34, 246, 203, 160, 117,  74,  31, 243, 200, 157, 114,  71,  28, 240, 197,
+    },
+    {
+        255, 189, 123,  57, 246, 180, 114,  48, 237, 171, 105,  39, 228, 162,  96,  30,
+        219, 153,  87,  21, 210, 144,  78,  12, 201, 135,  69,   3, 192, 126,  60, 249,
+    },
+    {
+        255, 225, 195, 165, 135, 105,  75,  45,  15, 240, 210, 180, 150, 120,  90,  60,
+         30, 255, 225, 195, 165, 135, 105,  75,  45,  15, 240, 210, 180, 150, 120,  90,
+    },
+    {
+        255, 102, 204,  51, 153, 255, 102, 204,  51, 153, 255, 102, 204,  51, 153, 255,
+        102, 204,  51, 153, 255, 102, 204,  51, 153, 255, 102, 204,  51, 153, 255, 102,
+    },
+    {
+        255, 221, 187, 153, 119,  85,  51,  17, 238, 204, 170, 136, 102,  68,  34, 255,
+        221, 187, 153, 119,  85,  51,  17, 238, 204, 170, 136, 102,  68,  34, 255, 221,
+    },
+    {
+        255, 127, 254, 126, 253, 125, 252, 124, 251, 123, 250, 122, 249, 121, 248, 120,
+        247, 119, 246, 118, 245, 117, 244, 116, 243, 115, 242, 114, 241, 113, 240, 112,
+    },
+    {
+        255,  49,  98, 147, 196, 245,  39,  88, 137, 186, 235,  29,  78, 127, 176, 225,
+         19,  68, 117, 166, 215,   9,  58, 107, 156, 205, 254,  48,  97, 146, 195, 244,
+    },
+    {
+        255, 108, 216,  69, 177,  30, 138, 246,  99, 207,  60, 168,  21, 129, 237,  90,
+        198,  51, 159,  12, 120, 228,  81, 189,  42, 150,   3, 111, 219,  72, 180,  33,
+    },
+    {
+        255,  32,  64,  96, 128, 160, 192, 224,   1,  33,  65,  97, 129, 161, 193, 225,
+          2,  34,  66,  98, 130, 162, 194, 226,   3,  35,  67,  99, 131, 163, 195, 227,
+    },
+    {
+        255,  43,  86, 129, 172, 215,   3,  46,  89, 132, 175, 218,   6,  49,  92, 135,
+        178, 221,   9,  52,  95, 138, 181, 224,  12,  55,  98, 141, 184, 227,  15,  58,
+    },
+    {
+        255, 243, 231, 219, 207, 195, 183, 171, 159, 147, 135, 123, 111,  99,  87,  75,
+         63,  51,  39,  27,  15,   3, 246, 234, 222, 210, 198, 186, 174, 162, 150, 138,
+    },
+    {
+        255,   5,  10,  15,  20,  25,  30,  35,  40,  45,  50,  55,  60,  65,  70,  75,
+         80,  85,  90,  95, 100, 105, 110, 115, 120, 125, 130, 135, 140, 145, 150, 155,
+    },
+    {
+        255,  87, 174,   6,  93, 180,  12,  99, 186,  18, 105, 192,  24, 111, 198,  30,
+        117, 204,  36, 123, 210,  42, 129, 216,  48, 135, 222,  54, 141, 228,  60, 147,
+    },
+    {
+        255, 142,  29, 171,  58, 200,  87, 229, 116,   3, 145,  32, 174,  61, 203,  90,
+        232, 119,   6, 148,  35, 177,  64, 206,  93, 235, 122,   9, 151,  38, 180,  67,
+    },
+    {
+        255, 232, 209, 186, 163, 140, 117,  94,  71,  48,  25,   2, 234, 211, 188, 165,
+        142, 119,  96,  73,  50,  27,   4, 236, 213, 190, 167, 144, 121,  98,  75,  52,
+    },
+    {
+        255, 207, 159, 111,  63,  15, 222, 174, 126,  78,  30, 237, 189, 141,  93,  45,
+        252, 204, 156, 108,  60,  12, 219, 171, 123,  75,  27, 234, 186, 138,  90,  42,
+    },
+    {
+        255, 172,  89,   6, 178,  95,  12, 184, 101,  18, 190, 107,  24, 196, 113,  30,
+        202, 119,  36, 208, 125,  42, 214, 131,  48, 220, 137,  54, 226, 143,  60, 232,
+    },
+    {
+        255,  79, 158, 237,  61, 140, 219,  43, 122, 201,  25, 104, 183,   7,  86, 165,
+        244,  68, 147, 226,  50, 129, 208,  32, 111, 190,  14,  93, 172, 251,  75, 154,
+    },
+    {
+        255, 131,   7, 138,  14, 145,  21, 152,  28, 159,  35, 166,  42, 173,  49, 180,
+         56, 187,  63, 194,  70, 201,  77, 208,  84, 215,  91, 222,  98, 229, 105, 236,
+    },
+    {
+        255, 201, 147,  93,  39, 240, 186, 132,  78,  24, 225, 171, 117,  63,   9, 210,
+        156, 102,  48, 249, 195, 141,  87,  33, 234, 180, 126,  72,  18, 219, 165, 111,
+    },
+    {
+        255, 217, 179, 141, 103,  65,  27, 244, 206, 168, 130,  92,  54,  16, 233, 195,
+        157, 119,  81,  43,   5, 222, 184, 146, 108,  70,  32, 249, 211, 173, 135,  97,
+    },
+    {
+        255, 213, 171, 129,  87,  45,   3, 216, 174, 132,  90,  48,   6, 219, 177, 135,
+         93,  51,   9, 222, 180, 138,  96,  54,  12, 225, 183, 141,  99,  57,  15, 228,
+    },
+    {
+        255,  65, 130, 195,   5,  70, 135, 200,  10,  75, 140, 205,  15,  80, 145, 210,
+         20,  85, 150, 215,  25,  90, 155, 220,  30,  95, 160, 225,  35, 100, 165, 230,
+    },
+    {
+        255, 190, 125,  60, 250, 185, 120,  55, 245, 180, 115,  50, 240, 175, 110,  45,
+        235, 170, 105,  40, 230, 165, 100,  35, 225, 160,  95,  30, 220, 155,  90,  25,
+    },
+    {
+        255, 148,  41, 189,  82, 230, 123,  16, 164,  57, 205,  98, 246, 139,  32, 180,
+         73, 221, 114,   7, 155,  48, 196,  89, 237, 130,  23, 171,  64, 212, 105, 253,
+    },
+    {
+        255, 226, 197, 168, 139, 110,  81,  52,  23, 249, 220, 191, 162, 133, 104,  75,
+         46,  17, 243, 214, 185, 156, 127,  98,  69,  40,  11, 237, 208, 179, 150, 121,
+    },
+    {
+        255, 180, 105,  30, 210, 135,  60, 240, 165,  90,  15, 195, 120,  45, 225, 150,
+         75, 255, 180, 105,  30, 210, 135,  60, 240, 165,  90,  15, 195, 120,  45, 225,
+    },
+    {
+        255, 103, 206,  54, 157,   5, 108, 211,  59, 162,  10, 113, 216,  64, 167,  15,
+        118, 221,  69, 172,  20, 123, 226,  74, 177,  25, 128, 231,  79, 182,  30, 133,
+    },
+    {
+        255,  39,  78, 117, 156, 195, 234,  18,  57,  96, 135, 174, 213, 252,  36,  75,
+        114, 153, 192, 231,  15,  54,  93, 132, 171, 210, 249,  33,  72, 111, 150, 189,
+    },
+    {
+        255, 222, 189, 156, 123,  90,  57,  24, 246, 213, 180, 147, 114,  81,  48,  15,
+        237, 204, 171, 138, 105,  72,  39,   6, 228, 195, 162, 129,  96,  63,  30, 252,
+    },
+    {
+        255, 240, 225, 210, 195, 180, 165, 150, 135, 120, 105,  90,  75,  60,  45,  30,
+         15, 255, 240, 225, 210, 195, 180, 165, 150, 135, 120, 105,  90,  75,  60,  45,
+    },
+    {
+        255, 128,   1, 129,   2, 130,   3, 131,   4, 132,   5, 133,   6, 134,   7, 135,
+          8, 136,   9, 137,  10, 138,  11, 139,  12, 140,  13, 141,  14, 142,  15, 143,
+    },
+    {
+        255, 177,  99,  21, 198, 120,  42, 219, 141,  63, 240, 162,  84,   6, 183, 105,
+         27, 204, 126,  48, 225, 147,  69, 246, 168,  90,  12, 189, 111,  33, 210, 132,
+    },
+    {
+        255,  50, 100, 150, 200, 250,  45,  95, 145, 195, 245,  40,  90, 140, 190, 240,
+         35,  85, 135, 185, 235,  30,  80, 130, 180, 230,  25,  75, 125, 175, 225,  20,
+    },
+    {
+        255,  53, 106, 159, 212,  10,  63, 116, 169, 222,  20,  73, 126, 179, 232,  30,
+         83, 136, 189, 242,  40,  93, 146, 199, 252,  50, 103, 156, 209,   7,  60, 113,
+    },
+    {
+        255, 109, 218,  72, 181,  35, 144, 253, 107, 216,  70, 179,  33, 142, 251, 105,
+        214,  68, 177,  31, 140, 249, 103, 212,  66, 175,  29, 138, 247, 101, 210,  64,
+    },
+    {
+        255,  69, 138, 207,  21,  90, 159, 228,  42, 111, 180, 249,  63, 132, 201,  15,
+         84, 153, 222,  36, 105, 174, 243,  57, 126, 195,   9,  78, 147, 216,  30,  99,
+    },
+    {
+        255,  33,  66,  99, 132, 165, 198, 231,   9,  42,  75, 108, 141, 174, 207, 240,
+         18,  51,  84, 117, 150, 183, 216, 249,  27,  60,  93, 126, 159, 192, 225,   3,
+    },
+    {
+        255,  18,  36,  54,  72,  90, 108, 126, 144, 162, 180, 198, 216, 234, 252,  15,
+         33,  51,  69,  87, 105, 123, 141, 159, 177, 195, 213, 231, 249,  12,  30,  48,
+    },
+    {
+        255,  44,  88, 132, 176, 220,   9,  53,  97, 141, 185, 229,  18,  62, 106, 150,
+        194, 238,  27,  71, 115, 159, 203, 247,  36,  80, 124, 168, 212,   1,  45,  89,
+    },
+    {
+        255,  13,  26,  39,  52,  65,  78,  91, 104, 117, 130, 143, 156, 169, 182, 195,
+        208, 221, 234, 247,   5,  18,  31,  44,  57,  70,  83,  96, 109, 122, 135, 148,
+    },
+    {
+        255, 244, 233, 222, 211, 200, 189, 178, 167, 156, 145, 134, 123, 112, 101,  90,
+         79,  68,  57,  46,  35,  24,  13,   2, 246, 235, 224, 213, 202, 191, 180, 169,
+    },
+    {
+        255,  56, 112, 168, 224,  25,  81, 137, 193, 249,  50, 106, 162, 218,  19,  75,
+        131, 187, 243,  44, 100, 156, 212,  13,  69, 125, 181, 237,  38,  94, 150, 206,
+    },
+    {
+        255,   6,  12,  18,  24,  30,  36,  42,  48,  54,  60,  66,  72,  78,  84,  90,
+         96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156, 162, 168, 174, 180, 186,
+    },
+    {
+        255, 155,  55, 210, 110,  10, 165,  65, 220, 120,  20, 175,  75, 230, 130,  30,
+        185,  85, 240, 140,  40, 195,  95, 250, 150,  50, 205, 105,   5, 160,  60, 215,
+    },
+    {
+        255,  88, 176,   9,  97, 185,  18, 106, 194,  27, 115, 203,  36, 124, 212,  45,
+        133, 221,  54, 142, 230,  63, 151, 239,  72, 160, 248,  81, 169,   2,  90, 178,
+    },
+    {
+        255,  26,  52,  78, 104, 130, 156, 182, 208, 234,   5,  31,  57,  83, 109, 135,
+        161, 187, 213, 239,  10,  36,  62,  88, 114, 140, 166, 192, 218, 244,  15,  41,
+    },
+    {
+        255, 143,  31, 174,  62, 205,  93, 236, 124,  12, 155,  43, 186,  74, 217, 105,
+        248, 136,  24, 167,  55, 198,  86, 229, 117,   5, 148,  36, 179,  67, 210,  98,
+    },
+    {
+        255, 121, 242, 108, 229,  95, 216,  82, 203,  69, 190,  56, 177,  43, 164,  30,
+        151,  17, 138,   4, 125, 246, 112, 233,  99, 220,  86, 207,  73, 194,  60, 181,
+    },
+    {
+        255, 233, 211, 189, 167, 145, 123, 101,  79,  57,  35,  13, 246, 224, 202, 180,
+        158, 136, 114,  92,  70,  48,  26,   4, 237, 215, 193, 171, 149, 127, 105,  83,
+    },
+    {
+        255, 112, 224,  81, 193,  50, 162,  19, 131, 243, 100, 212,  69, 181,  38, 150,
+          7, 119, 231,  88, 200,  57, 169,  26, 138, 250, 107, 219,  76, 188,  45, 157,
+    },
+    {
+        255, 208, 161, 114,  67,  20, 228, 181, 134,  87,  40, 248, 201, 154, 107,  60,
+         13, 221, 174, 127,  80,  33, 241, 194, 147, 100,  53,   6, 214, 167, 120,  73,
+    },
+    {
+        255, 194, 133,  72,  11, 205, 144,  83,  22, 216, 155,  94,  33, 227, 166, 105,
+         44, 238, 177, 116,  55, 249, 188, 127,  66,   5, 199, 138,  77,  16, 210, 149,
+    },
+    {
+        255, 173,  91,   9, 182, 100,  18, 191, 109,  27, 200, 118,  36, 209, 127,  45,
+        218, 136,  54, 227, 145,  63, 236, 154,  72, 245, 163,  81, 254, 172,  90,   8,
+    },
+    {
+        255, 168,  81, 249, 162,  75, 243, 156,  69, 237, 150,  63, 231, 144,  57, 225,
+        138,  51, 219, 132,  45, 213, 126,  39, 207, 120,  33, 201, 114,  27, 195, 108,
+    },
+    {
+        255,  80, 160, 240,  65, 145, 225,  50, 130, 210,  35, 115, 195,  20, 100, 180,
+          5,  85, 165, 245,  70, 150, 230,  55, 135, 215,  40, 120, 200,  25, 105, 185,
+    },
+    {
+        255, 117, 234,  96, 213,  75, 192,  54, 171,  33, 150,  12, 129, 246, 108, 225,
+         87, 204,  66, 183,  45, 162,  24, 141,   3, 120, 237,  99, 216,  78, 195,  57,
+    },
+    {
+        255, 132,   9, 141,  18, 150,  27, 159,  36, 168,  45, 177,  54, 186,  63, 195,
+         72, 204,  81, 213,  90, 222,  99, 231, 108, 240, 117, 249, 126,   3, 135,  12,
+    },
+    {
+        255,  72, 144, 216,  33, 105, 177, 249,  66, 138, 210,  27,  99, 171, 243,  60,
+        132, 204,  21,  93, 165, 237,  54, 126, 198,  15,  87, 159, 231,  48, 120, 192,
+    },
+    {
+        255, 202, 149,  96,  43, 245, 192, 139,  86,  33, 235, 182, 129,  76,  23, 225,
+        172, 119,  66,  13, 215, 162, 109,  56,   3, 205, 152,  99,  46, 248, 195, 142,
+    },
+    {
+        255, 252, 249, 246, 243, 240, 237, 234, 231, 228, 225, 222, 219, 216, 213, 210,
+        207, 204, 201, 198, 195, 192, 189, 186, 183, 180, 177, 174, 171, 168, 165, 162,
+    },
+    {
+        255, 218, 181, 144, 107,  70,  33, 251, 214, 177, 140, 103,  66,  29, 247, 210,
+        173, 136,  99,  62,  25, 243, 206, 169, 132,  95,  58,  21, 239, 202, 165, 128,
+    },
+    {
+        255, 138,  21, 159,  42, 180,  63, 201,  84, 222, 105, 243, 126,   9, 147,  30,
+        168,  51, 189,  72, 210,  93, 231, 114, 252, 135,  18, 156,  39, 177,  60, 198,
+    },
+    {
+        255, 214, 173, 132,  91,  50,   9, 223, 182, 141, 100,  59,  18, 232, 191, 150,
+        109,  68,  27, 241, 200, 159, 118,  77,  36, 250, 209, 168, 127,  86,  45,   4,
+    },
+    {
+        255,  84, 168, 252,  81, 165, 249,  78, 162, 246,  75, 159, 243,  72, 156, 240,
+         69, 153, 237,  66, 150, 234,  63, 147, 231,  60, 144, 228,  57, 141, 225,  54,
+    },
+    {
+        255,  66, 132, 198,   9,  75, 141, 207,  18,  84, 150, 216,  27,  93, 159, 225,
+         36, 102, 168, 234,  45, 111, 177, 243,  54, 120, 186, 252,  63, 129, 195,   6,
+    },
+    {
+        255,  36,  72, 108, 144, 180, 216, 252,  33,  69, 105, 141, 177, 213, 249,  30,
+         66, 102, 138, 174, 210, 246,  27,  63,  99, 135, 171, 207, 243,  24,  60,  96,
+    },
+    {
+        255, 191, 127,  63, 254, 190, 126,  62, 253, 189, 125,  61, 252, 188, 124,  60,
+        251, 187, 123,  59, 250, 186, 122,  58, 249, 185, 121,  57, 248, 184, 120,  56,
+    },
+    {
+        255, 152,  49, 201,  98, 250, 147,  44, 196,  93, 245, 142,  39, 191,  88, 240,
+        137,  34, 186,  83, 235, 132,  29, 181,  78, 230, 127,  24, 176,  73, 225, 122,
+    },
+    {
+        255, 149,  43, 192,  86, 235, 129,  23, 172,  66, 215, 109,   3, 152,  46, 195,
+         89, 238, 132,  26, 175,  69, 218, 112,   6, 155,  49, 198,  92, 241, 135,  29,
+    },
+    {
+        255, 249, 243, 237, 231, 225, 219, 213, 207, 201, 195, 189, 183, 177, 171, 165,
+        159, 153, 147, 141, 135, 129, 123, 117, 111, 105,  99,  93,  87,  81,  75,  69,
+    },
+    {
+        255, 227, 199, 171, 143, 115,  87,  59,  31,   3, 230, 202, 174, 146, 118,  90,
+         62,  34,   6, 233, 205, 177, 149, 121,  93,  65,  37,   9, 236, 208, 180, 152,
+    },
+    {
+        255,  94, 188,  27, 121, 215,  54, 148, 242,  81, 175,  14, 108, 202,  41, 135,
+        229,  68, 162,   1,  95, 189,  28, 122, 216,  55, 149, 243,  82, 176,  15, 109,
+    },
+    {
+        255, 181, 107,  33, 214, 140,  66, 247, 173,  99,  25, 206, 132,  58, 239, 165,
+         91,  17, 198, 124,  50, 231, 157,  83,   9, 190, 116,  42, 223, 149,  75,   1,
+    },
+    {
+        255,  21,  42,  63,  84, 105, 126, 147, 168, 189, 210, 231, 252,  18,  39,  60,
+         81, 102, 123, 144, 165, 186, 207, 228, 249,  15,  36,  57,  78,  99, 120, 141,
+    },
+    {
+        255, 104, 208,  57, 161,  10, 114, 218,  67, 171,  20, 124, 228,  77, 181,  30,
+        134, 238,  87, 191,  40, 144, 248,  97, 201,  50, 154,   3, 107, 211,  60, 164,
+    },
+    {
+        255,  97, 194,  36, 133, 230,  72, 169,  11, 108, 205,  47, 144, 241,  83, 180,
+         22, 119, 216,  58, 155, 252,  94, 191,  33, 130, 227,  69, 166,   8, 105, 202,
+    },
+    {
+        255,  40,  80, 120, 160, 200, 240,  25,  65, 105, 145, 185, 225,  10,  50,  90,
+        130, 170, 210, 250,  35,  75, 115, 155, 195, 235,  20,  60, 100, 140, 180, 220,
+    },
+    {
+        255, 186, 117,  48, 234, 165,  96,  27, 213, 144,  75,   6, 192, 123,  54, 240,
+        171, 102,  33, 219, 150,  81,  12, 198, 129,  60, 246, 177, 108,  39, 225, 156,
+    },
+    {
+        255, 223, 191, 159, 127,  95,  63,  31, 254, 222, 190, 158, 126,  94,  62,  30,
+        253, 221, 189, 157, 125,  93,  61,  29, 252, 220, 188, 156, 124,  92,  60,  28,
+    },
+    {
+        255,  76, 152, 228,  49, 125, 201,  22,  98, 174, 250,  71, 147, 223,  44, 120,
+        196,  17,  93, 169, 245,  66, 142, 218,  39, 115, 191,  12,  88, 164, 240,  61,
+    },
+    {
+        255, 241, 227, 213, 199, 185, 171, 157, 143, 129, 115, 101,  87,  73,  59,  45,
+         31,  17,   3, 244, 230, 216, 202, 188, 174, 160, 146, 132, 118, 104,  90,  76,
+    },
+    {
+        255,  47,  94, 141, 188, 235,  27,  74, 121, 168, 215,   7,  54, 101, 148, 195,
+        242,  34,  81, 128, 175, 222,  14,  61, 108, 155, 202, 249,  41,  88, 135, 182,
+    },
+    {
+        255, 129,   3, 132,   6, 135,   9, 138,  12, 141,  15, 144,  18, 147,  21, 150,
+         24, 153,  27, 156,  30, 159,  33, 162,  36, 165,  39, 168,  42, 171,  45, 174,
+    },
+    {
+        255, 230, 205, 180, 155, 130, 105,  80,  55,  30,   5, 235, 210, 185, 160, 135,
+        110,  85,  60,  35,  10, 240, 215, 190, 165, 140, 115,  90,  65,  40,  15, 245,
+    },
+    {
+        255, 178, 101,  24, 202, 125,  48, 226, 149,  72, 250, 173,  96,  19, 197, 120,
+         43, 221, 144,  67, 245, 168,  91,  14, 192, 115,  38, 216, 139,  62, 240, 163,
+    },
+    {
+        255,  63, 126, 189, 252,  60, 123, 186, 249,  57, 120, 183, 246,  54, 117, 180,
+        243,  51, 114, 177, 240,  48, 111, 174, 237,  45, 108, 171, 234,  42, 105, 168,
+    },
+    {
+        255,  51, 102, 153, 204, 255,  51, 102, 153, 204, 255,  51, 102, 153, 204, 255,
+         51, 102, 153, 204, 255,  51, 102, 153, 204, 255,  51, 102, 153, 204, 255,  51,
+    },
+    {
+        255, 238, 221, 204, 187, 170, 153, 136, 119, 102,  85,  68,  51,  34,  17, 255,
+        238, 221, 204, 187, 170, 153, 136, 119, 102,  85,  68,  51,  34,  17, 255, 238,
+    },
+    {
+        255,  54, 108, 162, 216,  15,  69, 123, 177, 231,  30,  84, 138, 192, 246,  45,
+         99, 153, 207,   6,  60, 114, 168, 222,  21,  75, 129, 183, 237,  36,  90, 144,
+    },
+    {
+        255,  16,  32,  48,  64,  80,  96, 112, 128, 144, 160, 176, 192, 208, 224, 240,
+          1,  17,  33,  49,  65,  81,  97, 113, 129, 145, 161, 177, 193, 209, 225, 241,
+    },
+    {
+        255, 110, 220,  75, 185,  40, 150,   5, 115, 225,  80, 190,  45, 155,  10, 120,
+        230,  85, 195,  50, 160,  15, 125, 235,  90, 200,  55, 165,  20, 130, 240,  95,
+    },
+    {
+        255,  24,  48,  72,  96, 120, 144, 168, 192, 216, 240,   9,  33,  57,  81, 105,
+        129, 153, 177, 201, 225, 249,  18,  42,  66,  90, 114, 138, 162, 186, 210, 234,
+    },
+    {
+        255,  70, 140, 210,  25,  95, 165, 235,  50, 120, 190,   5,  75, 145, 215,  30,
+        100, 170, 240,  55, 125, 195,  10,  80, 150, 220,  35, 105, 175, 245,  60, 130,
+    },
+    {
+        255, 166,  77, 243, 154,  65, 231, 142,  53, 219, 130,  41, 207, 118,  29, 195,
+        106,  17, 183,  94,   5, 171,  82, 248, 159,  70, 236, 147,  58, 224, 135,  46,
+    },
+    {
+        255,  34,  68, 102, 136, 170, 204, 238,  17,  51,  85, 119, 153, 187, 221, 255,
+         34,  68, 102, 136, 170, 204, 238,  17,  51,  85, 119, 153, 187, 221, 255,  34,
+    },
+    {
+        255, 136,  17, 153,  34, 170,  51, 187,  68, 204,  85, 221, 102, 238, 119, 255,
+        136,  17, 153,  34, 170,  51, 187,  68, 204,  85, 221, 102, 238, 119, 255, 136,
+    },
+    {
+        255,  19,  38,  57,  76,  95, 114, 133, 152, 171, 190, 209, 228, 247,  11,  30,
+         49,  68,  87, 106, 125, 144, 163, 182, 201, 220, 239,   3,  22,  41,  60,  79,
+    },
+    {
+        255, 247, 239, 231, 223, 215, 207, 199, 191, 183, 175, 167, 159, 151, 143, 135,
+        127, 119, 111, 103,  95,  87,  79,  71,  63,  55,  47,  39,  31,  23,  15,   7,
+    },
+    {
+        255,  45,  90, 135, 180, 225,  15,  60, 105, 150, 195, 240,  30,  75, 120, 165,
+        210, 255,  45,  90, 135, 180, 225,  15,  60, 105, 150, 195, 240,  30,  75, 120,
+    },
+    {
+        255, 184, 113,  42, 226, 155,  84,  13, 197, 126,  55, 239, 168,  97,  26, 210,
+        139,  68, 252, 181, 110,  39, 223, 152,  81,  10, 194, 123,  52, 236, 165,  94,
+    },
+    {
+        255,  14,  28,  42,  56,  70,  84,  98, 112, 126, 140, 154, 168, 182, 196, 210,
+        224, 238, 252,  11,  25,  39,  53,  67,  81,  95, 109, 123, 137, 151, 165, 179,
+    },
+    {
+        255,  61, 122, 183, 244,  50, 111, 172, 233,  39, 100, 161, 222,  28,  89, 150,
+        211,  17,  78, 139, 200,   6,  67, 128, 189, 250,  56, 117, 178, 239,  45, 106,
+    },
+    {
+        255, 245, 235, 225, 215, 205, 195, 185, 175, 165, 155, 145, 135, 125, 115, 105,
+         95,  85,  75,  65,  55,  45,  35,  25,  15,   5, 250, 240, 230, 220, 210, 200,
+    },
+    {
+        255, 164,  73, 237, 146,  55, 219, 128,  37, 201, 110,  19, 183,  92,   1, 165,
+         74, 238, 147,  56, 220, 129,  38, 202, 111,  20, 184,  93,   2, 166,  75, 239,
+    },
+    {
+        255,  57, 114, 171, 228,  30,  87, 144, 201,   3,  60, 117, 174, 231,  33,  90,
+        147, 204,   6,  63, 120, 177, 234,  36,  93, 150, 207,   9,  66, 123, 180, 237,
+    },
+    {
+        255,  59, 118, 177, 236,  40,  99, 158, 217,  21,  80, 139, 198,   2,  61, 120,
+        179, 238,  42, 101, 160, 219,  23,  82, 141, 200,   4,  63, 122, 181, 240,  44,
+    },
+    {
+        255,   7,  14,  21,  28,  35,  42,  49,  56,  63,  70,  77,  84,  91,  98, 105,
+        112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+    },
+    {
+        255, 158,  61, 219, 122,  25, 183,  86, 244, 147,  50, 208, 111,  14, 172,  75,
+        233, 136,  39, 197, 100,   3, 161,  64, 222, 125,  28, 186,  89, 247, 150,  53,
+    },
+    {
+        255, 156,  57, 213, 114,  15, 171,  72, 228, 129,  30, 186,  87, 243, 144,  45,
+        201, 102,   3, 159,  60, 216, 117,  18, 174,  75, 231, 132,  33, 189,  90, 246,
+    },
+    {
+        255, 157,  59, 216, 118,  20, 177,  79, 236, 138,  40, 197,  99,   1, 158,  60,
+        217, 119,  21, 178,  80, 237, 139,  41, 198, 100,   2, 159,  61, 218, 120,  22,
+    },
+    {
+        255,  89, 178,  12, 101, 190,  24, 113, 202,  36, 125, 214,  48, 137, 226,  60,
+        149, 238,  72, 161, 250,  84, 173,   7,  96, 185,  19, 108, 197,  31, 120, 209,
+    },
+    {
+        255, 159,  63, 222, 126,  30, 189,  93, 252, 156,  60, 219, 123,  27, 186,  90,
+        249, 153,  57, 216, 120,  24, 183,  87, 246, 150,  54, 213, 117,  21, 180,  84,
+    },
+    {
+        255,  27,  54,  81, 108, 135, 162, 189, 216, 243,  15,  42,  69,  96, 123, 150,
+        177, 204, 231,   3,  30,  57,  84, 111, 138, 165, 192, 219, 246,  18,  45,  72,
+    },
+    {
+        255,   8,  16,  24,  32,  40,  48,  56,  64,  72,  80,  88,  96, 104, 112, 120,
+        128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248,
+    },
+    {
+        255, 144,  33, 177,  66, 210,  99, 243, 132,  21, 165,  54, 198,  87, 231, 120,
+          9, 153,  42, 186,  75, 219, 108, 252, 141,  30, 174,  63, 207,  96, 240, 129,
+    },
+    {
+        255,   9,  18,  27,  36,  45,  54,  63,  72,  81,  90,  99, 108, 117, 126, 135,
+        144, 153, 162, 171, 180, 189, 198, 207, 216, 225, 234, 243, 252,   6,  15,  24,
+    },
+    {
+        255, 122, 244, 111, 233, 100, 222,  89, 211,  78, 200,  67, 189,  56, 178,  45,
+        167,  34, 156,  23, 145,  12, 134,   1, 123, 245, 112, 234, 101, 223,  90, 212,
+    },
+    {
+        255,  28,  56,  84, 112, 140, 168, 196, 224, 252,  25,  53,  81, 109, 137, 165,
+        193, 221, 249,  22,  50,  78, 106, 134, 162, 190, 218, 246,  19,  47,  75, 103,
+    },
+    {
+        255, 234, 213, 192, 171, 150, 129, 108,  87,  66,  45,  24,   3, 237, 216, 195,
+        174, 153, 132, 111,  90,  69,  48,  27,   6, 240, 219, 198, 177, 156, 135, 114,
+    },
+    {
+        255, 160,  65, 225, 130,  35, 195, 100,   5, 165,  70, 230, 135,  40, 200, 105,
+         10, 170,  75, 235, 140,  45, 205, 110,  15, 175,  80, 240, 145,  50, 210, 115,
+    },
+    {
+        255, 113, 226,  84, 197,  55, 168,  26, 139, 252, 110, 223,  81, 194,  52, 165,
+         23, 136, 249, 107, 220,  78, 191,  49, 162,  20, 133, 246, 104, 217,  75, 188,
+    },
+    {
+        255,  90, 180,  15, 105, 195,  30, 120, 210,  45, 135, 225,  60, 150, 240,  75,
+        165, 255,  90, 180,  15, 105, 195,  30, 120, 210,  45, 135, 225,  60, 150, 240,
+    },
+    {
+        255, 209, 163, 117,  71,  25, 234, 188, 142,  96,  50,   4, 213, 167, 121,  75,
+         29, 238, 192, 146, 100,  54,   8, 217, 171, 125,  79,  33, 242, 196, 150, 104,
+    },
+    {
+        255,  29,  58,  87, 116, 145, 174, 203, 232,   6,  35,  64,  93, 122, 151, 180,
+        209, 238,  12,  41,  70,  99, 128, 157, 186, 215, 244,  18,  47,  76, 105, 134,
+    },
+    {
+        255, 195, 135,  75,  15, 210, 150,  90,  30, 225, 165, 105,  45, 240, 180, 120,
+         60, 255, 195, 135,  75,  15, 210, 150,  90,  30, 225, 165, 105,  45, 240, 180,
+    },
+    {
+        255, 123, 246, 114, 237, 105, 228,  96, 219,  87, 210,  78, 201,  69, 192,  60,
+        183,  51, 174,  42, 165,  33, 156,  24, 147,  15, 138,   6, 129, 252, 120, 243,
+    },
+    {
+        255, 174,  93,  12, 186, 105,  24, 198, 117,  36, 210, 129,  48, 222, 141,  60,
+        234, 153,  72, 246, 165,  84,   3, 177,  96,  15, 189, 108,  27, 201, 120,  39,
+    },
+    {
+        255,  10,  20,  30,  40,  50,  60,  70,  80,  90, 100, 110, 120, 130, 140, 150,
+        160, 170, 180, 190, 200, 210, 220, 230, 240, 250,   5,  15,  25,  35,  45,  55,
+    },
+    {
+        255, 169,  83, 252, 166,  80, 249, 163,  77, 246, 160,  74, 243, 157,  71, 240,
+        154,  68, 237, 151,  65, 234, 148,  62, 231, 145,  59, 228, 142,  56, 225, 139,
+    },
+    {
+        255, 145,  35, 180,  70, 215, 105, 250, 140,  30, 175,  65, 210, 100, 245, 135,
+         25, 170,  60, 205,  95, 240, 130,  20, 165,  55, 200,  90, 235, 125,  15, 160,
+    },
+    {
+        255,  81, 162, 243,  69, 150, 231,  57, 138, 219,  45, 126, 207,  33, 114, 195,
+         21, 102, 183,   9,  90, 171, 252,  78, 159, 240,  66, 147, 228,  54, 135, 216,
+    },
+    {
+        255,  91, 182,  18, 109, 200,  36, 127, 218,  54, 145, 236,  72, 163, 254,  90,
+        181,  17, 108, 199,  35, 126, 217,  53, 144, 235,  71, 162, 253,  89, 180,  16,
+    },
+    {
+        255, 118, 236,  99, 217,  80, 198,  61, 179,  42, 160,  23, 141,   4, 122, 240,
+        103, 221,  84, 202,  65, 183,  46, 164,  27, 145,   8, 126, 244, 107, 225,  88,
+    },
+    {
+        255, 114, 228,  87, 201,  60, 174,  33, 147,   6, 120, 234,  93, 207,  66, 180,
+         39, 153,  12, 126, 240,  99, 213,  72, 186,  45, 159,  18, 132, 246, 105, 219,
+    },
+    {
+        255, 133,  11, 144,  22, 155,  33, 166,  44, 177,  55, 188,  66, 199,  77, 210,
+         88, 221,  99, 232, 110, 243, 121, 254, 132,  10, 143,  21, 154,  32, 165,  43,
+    },
+    {
+        255, 161,  67, 228, 134,  40, 201, 107,  13, 174,  80, 241, 147,  53, 214, 120,
+         26, 187,  93, 254, 160,  66, 227, 133,  39, 200, 106,  12, 173,  79, 240, 146,
+    },
+    {
+        255,  73, 146, 219,  37, 110, 183,   1,  74, 147, 220,  38, 111, 184,   2,  75,
+        148, 221,  39, 112, 185,   3,  76, 149, 222,  40, 113, 186,   4,  77, 150, 223,
+    },
+    {
+        255, 235, 215, 195, 175, 155, 135, 115,  95,  75,  55,  35,  15, 250, 230, 210,
+        190, 170, 150, 130, 110,  90,  70,  50,  30,  10, 245, 225, 205, 185, 165, 145,
+    },
+    {
+        255, 203, 151,  99,  47, 250, 198, 146,  94,  42, 245, 193, 141,  89,  37, 240,
+        188, 136,  84,  32, 235, 183, 131,  79,  27, 230, 178, 126,  74,  22, 225, 173,
+    },
+    {
+        255, 124, 248, 117, 241, 110, 234, 103, 227,  96, 220,  89, 213,  82, 206,  75,
+        199,  68, 192,  61, 185,  54, 178,  47, 171,  40, 164,  33, 157,  26, 150,  19,
+    },
+    {
+        255, 253, 251, 249, 247, 245, 243, 241, 239, 237, 235, 233, 231, 229, 227, 225,
+        223, 221, 219, 217, 215, 213, 211, 209, 207, 205, 203, 201, 199, 197, 195, 193,
+    },
+    {
+        255, 196, 137,  78,  19, 215, 156,  97,  38, 234, 175, 116,  57, 253, 194, 135,
+         76,  17, 213, 154,  95,  36, 232, 173, 114,  55, 251, 192, 133,  74,  15, 211,
+    },
+    {
+        255, 219, 183, 147, 111,  75,  39,   3, 222, 186, 150, 114,  78,  42,   6, 225,
+        189, 153, 117,  81,  45,   9, 228, 192, 156, 120,  84,  48,  12, 231, 195, 159,
+    },
+    {
+        255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,  75, 105, 135, 165, 195,
+        225, 255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,  75, 105, 135, 165,
+    },
+    {
+        255, 139,  23, 162,  46, 185,  69, 208,  92, 231, 115, 254, 138,  22, 161,  45,
+        184,  68, 207,  91, 230, 114, 253, 137,  21, 160,  44, 183,  67, 206,  90, 229,
+    },
+    {
+        255, 210, 165, 120,  75,  30, 240, 195, 150, 105,  60,  15, 225, 180, 135,  90,
+         45, 255, 210, 165, 120,  75,  30, 240, 195, 150, 105,  60,  15, 225, 180, 135,
+    },
+    {
+        255, 215, 175, 135,  95,  55,  15, 230, 190, 150, 110,  70,  30, 245, 205, 165,
+        125,  85,  45,   5, 220, 180, 140, 100,  60,  20, 235, 195, 155, 115,  75,  35,
+    },
+    {
+        255, 146,  37, 183,  74, 220, 111,   2, 148,  39, 185,  76, 222, 113,   4, 150,
+         41, 187,  78, 224, 115,   6, 152,  43, 189,  80, 226, 117,   8, 154,  45, 191,
+    },
+    {
+        255,  85, 170, 255,  85, 170, 255,  85, 170, 255,  85, 170, 255,  85, 170, 255,
+         85, 170, 255,  85, 170, 255,  85, 170, 255,  85, 170, 255,  85, 170, 255,  85,
+    },
+    {
+        255, 170,  85, 255, 170,  85, 255, 170,  85, 255, 170,  85, 255, 170,  85, 255,
+        170,  85, 255, 170,  85, 255, 170,  85, 255, 170,  85, 255, 170,  85, 255, 170,
+    },
+    {
+        255,  67, 134, 201,  13,  80, 147, 214,  26,  93, 160, 227,  39, 106, 173, 240,
+         52, 119, 186, 253,  65, 132, 199,  11,  78, 145, 212,  24,  91, 158, 225,  37,
+    },
+    {
+        255,  11,  22,  33,  44,  55,  66,  77,  88,  99, 110, 121, 132, 143, 154, 165,
+        176, 187, 198, 209, 220, 231, 242, 253,   9,  20,  31,  42,  53,  64,  75,  86,
+    },
+    {
+        255,  37,  74, 111, 148, 185, 222,   4,  41,  78, 115, 152, 189, 226,   8,  45,
+         82, 119, 156, 193, 230,  12,  49,  86, 123, 160, 197, 234,  16,  53,  90, 127,
+    },
+    {
+        255, 175,  95,  15, 190, 110,  30, 205, 125,  45, 220, 140,  60, 235, 155,  75,
+        250, 170,  90,  10, 185, 105,  25, 200, 120,  40, 215, 135,  55, 230, 150,  70,
+    },
+    {
+        255, 192, 129,  66,   3, 195, 132,  69,   6, 198, 135,  72,   9, 201, 138,  75,
+         12, 204, 141,  78,  15, 207, 144,  81,  18, 210, 147,  84,  21, 213, 150,  87,
+    },
+    {
+        255, 115, 230,  90, 205,  65, 180,  40, 155,  15, 130, 245, 105, 220,  80, 195,
+         55, 170,  30, 145,   5, 120, 235,  95, 210,  70, 185,  45, 160,  20, 135, 250,
+    },
+    {
+        255, 153,  51, 204, 102, 255, 153,  51, 204, 102, 255, 153,  51, 204, 102, 255,
+        153,  51, 204, 102, 255, 153,  51, 204, 102, 255, 153,  51, 204, 102, 255, 153,
+    },
+    {
+        255, 119, 238, 102, 221,  85, 204,  68, 187,  51, 170,  34, 153,  17, 136, 255,
+        119, 238, 102, 221,  85, 204,  68, 187,  51, 170,  34, 153,  17, 136, 255, 119,
+    },
+    {
+        255, 150,  45, 195,  90, 240, 135,  30, 180,  75, 225, 120,  15, 165,  60, 210,
+        105, 255, 150,  45, 195,  90, 240, 135,  30, 180,  75, 225, 120,  15, 165,  60,
+    },
+    {
+        255,  92, 184,  21, 113, 205,  42, 134, 226,  63, 155, 247,  84, 176,  13, 105,
+        197,  34, 126, 218,  55, 147, 239,  76, 168,   5,  97, 189,  26, 118, 210,  47,
+    },
+    {
+        255, 250, 245, 240, 235, 230, 225, 220, 215, 210, 205, 200, 195, 190, 185, 180,
+        175, 170, 165, 160, 155, 150, 145, 140, 135, 130, 125, 120, 115, 110, 105, 100,
+    },
+    {
+        255,  82, 164, 246,  73, 155, 237,  64, 146, 228,  55, 137, 219,  46, 128, 210,
+         37, 119, 201,  28, 110, 192,  19, 101, 183,  10,  92, 174,   1,  83, 165, 247,
+    },
+    {
+        255, 228, 201, 174, 147, 120,  93,  66,  39,  12, 240, 213, 186, 159, 132, 105,
+         78,  51,  24, 252, 225, 198, 171, 144, 117,  90,  63,  36,   9, 237, 210, 183,
+    },
+    {
+        255, 236, 217, 198, 179, 160, 141, 122, 103,  84,  65,  46,  27,   8, 244, 225,
+        206, 187, 168, 149, 130, 111,  92,  73,  54,  35,  16, 252, 233, 214, 195, 176,
+    },
+    {
+        255,  95, 190,  30, 125, 220,  60, 155, 250,  90, 185,  25, 120, 215,  55, 150,
+        245,  85, 180,  20, 115, 210,  50, 145, 240,  80, 175,  15, 110, 205,  45, 140,
+    },
+    {
+        255,  74, 148, 222,  41, 115, 189,   8,  82, 156, 230,  49, 123, 197,  16,  90,
+        164, 238,  57, 131, 205,  24,  98, 172, 246,  65, 139, 213,  32, 106, 180, 254,
+    },
+    {
+        255, 182, 109,  36, 218, 145,  72, 254, 181, 108,  35, 217, 144,  71, 253, 180,
+        107,  34, 216, 143,  70, 252, 179, 106,  33, 215, 142,  69, 251, 178, 105,  32,
+    },
+    {
+        255, 162,  69, 231, 138,  45, 207, 114,  21, 183,  90, 252, 159,  66, 228, 135,
+         42, 204, 111,  18, 180,  87, 249, 156,  63, 225, 132,  39, 201, 108,  15, 177,
+    },
+    {
+        255,  22,  44,  66,  88, 110, 132, 154, 176, 198, 220, 242,   9,  31,  53,  75,
+         97, 119, 141, 163, 185, 207, 229, 251,  18,  40,  62,  84, 106, 128, 150, 172,
+    },
+    {
+        255, 134,  13, 147,  26, 160,  39, 173,  52, 186,  65, 199,  78, 212,  91, 225,
+        104, 238, 117, 251, 130,   9, 143,  22, 156,  35, 169,  48, 182,  61, 195,  74,
+    },
+    {
+        255, 105, 210,  60, 165,  15, 120, 225,  75, 180,  30, 135, 240,  90, 195,  45,
+        150, 255, 105, 210,  60, 165,  15, 120, 225,  75, 180,  30, 135, 240,  90, 195,
+    },
+    {
+        255, 197, 139,  81,  23, 220, 162, 104,  46, 243, 185, 127,  69,  11, 208, 150,
+         92,  34, 231, 173, 115,  57, 254, 196, 138,  80,  22, 219, 161, 103,  45, 242,
+    },
+    {
+        255,  98, 196,  39, 137, 235,  78, 176,  19, 117, 215,  58, 156, 254,  97, 195,
+         38, 136, 234,  77, 175,  18, 116, 214,  57, 155, 253,  96, 194,  37, 135, 233,
+    },
+    {
+        255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240,
+        239, 238, 237, 236, 235, 234, 233, 232, 231, 230, 229, 228, 227, 226, 225, 224,
+    },
+    {
+        255,  41,  82, 123, 164, 205, 246,  32,  73, 114, 155, 196, 237,  23,  64, 105,
+        146, 187, 228,  14,  55,  96, 137, 178, 219,   5,  46,  87, 128, 169, 210, 251,
+    },
+    {
+        255, 125, 250, 120, 245, 115, 240, 110, 235, 105, 230, 100, 225,  95, 220,  90,
+        215,  85, 210,  80, 205,  75, 200,  70, 195,  65, 190,  60, 185,  55, 180,  50,
+    },
+    {
+        255, 187, 119,  51, 238, 170, 102,  34, 221, 153,  85,  17, 204, 136,  68, 255,
+        187, 119,  51, 238, 170, 102,  34, 221, 153,  85,  17, 204, 136,  68, 255, 187,
+    },
+    {
+        255, 204, 153, 102,  51, 255, 204, 153, 102,  51, 255, 204, 153, 102,  51, 255,
+        204, 153, 102,  51, 255, 204, 153, 102,  51, 255, 204, 153, 102,  51, 255, 204,
+    },
+    {
+        255, 224, 193, 162, 131, 100,  69,  38,   7, 231, 200, 169, 138, 107,  76,  45,
+         14, 238, 207, 176, 145, 114,  83,  52,  21, 245, 214, 183, 152, 121,  90,  59,
+    },
+    {
+        255, 211, 167, 123,  79,  35, 246, 202, 158, 114,  70,  26, 237, 193, 149, 105,
+         61,  17, 228, 184, 140,  96,  52,   8, 219, 175, 131,  87,  43, 254, 210, 166,
+    },
+    {
+        255,  77, 154, 231,  53, 130, 207,  29, 106, 183,   5,  82, 159, 236,  58, 135,
+        212,  34, 111, 188,  10,  87, 164, 241,  63, 140, 217,  39, 116, 193,  15,  92,
+    },
+    {
+        255, 140,  25, 165,  50, 190,  75, 215, 100, 240, 125,  10, 150,  35, 175,  60,
+        200,  85, 225, 110, 250, 135,  20, 160,  45, 185,  70, 210,  95, 235, 120,   5,
+    },
+    {
+        255, 242, 229, 216, 203, 190, 177, 164, 151, 138, 125, 112,  99,  86,  73,  60,
+         47,  34,  21,   8, 250, 237, 224, 211, 198, 185, 172, 159, 146, 133, 120, 107,
+    },
+    {
+        255,  31,  62,  93, 124, 155, 186, 217, 248,  24,  55,  86, 117, 148, 179, 210,
+        241,  17,  48,  79, 110, 141, 172, 203, 234,  10,  41,  72, 103, 134, 165, 196,
+    },
+    {
+        255,  48,  96, 144, 192, 240,  33,  81, 129, 177, 225,  18,  66, 114, 162, 210,
+          3,  51,  99, 147, 195, 243,  36,  84, 132, 180, 228,  21,  69, 117, 165, 213,
+    },
+    {
+        255, 220, 185, 150, 115,  80,  45,  10, 230, 195, 160, 125,  90,  55,  20, 240,
+        205, 170, 135, 100,  65,  30, 250, 215, 180, 145, 110,  75,  40,   5, 225, 190,
+    },
+    {
+        255, 130,   5, 135,  10, 140,  15, 145,  20, 150,  25, 155,  30, 160,  35, 165,
+         40, 170,  45, 175,  50, 180,  55, 185,  60, 190,  65, 195,  70, 200,  75, 205,
+    },
+    {
+        255, 171,  87,   3, 174,  90,   6, 177,  93,   9, 180,  96,  12, 183,  99,  15,
+        186, 102,  18, 189, 105,  21, 192, 108,  24, 195, 111,  27, 198, 114,  30, 201,
+    },
+    {
+        255, 231, 207, 183, 159, 135, 111,  87,  63,  39,  15, 246, 222, 198, 174, 150,
+        126, 102,  78,  54,  30,   6, 237, 213, 189, 165, 141, 117,  93,  69,  45,  21,
+    },
+    {
+        255,  86, 172,   3,  89, 175,   6,  92, 178,   9,  95, 181,  12,  98, 184,  15,
+        101, 187,  18, 104, 190,  21, 107, 193,  24, 110, 196,  27, 113, 199,  30, 116,
+    },
+    {
+        255, 179, 103,  27, 206, 130,  54, 233, 157,  81,   5, 184, 108,  32, 211, 135,
+         59, 238, 162,  86,  10, 189, 113,  37, 216, 140,  64, 243, 167,  91,  15, 194,
+    },
+    {
+        255, 147,  39, 186,  78, 225, 117,   9, 156,  48, 195,  87, 234, 126,  18, 165,
+         57, 204,  96, 243, 135,  27, 174,  66, 213, 105, 252, 144,  36, 183,  75, 222,
+    },
+    {
+        255,  64, 128, 192,   1,  65, 129, 193,   2,  66, 130, 194,   3,  67, 131, 195,
+          4,  68, 132, 196,   5,  69, 133, 197,   6,  70, 134, 198,   7,  71, 135, 199,
+    },
+    {
+        255, 216, 177, 138,  99,  60,  21, 237, 198, 159, 120,  81,  42,   3, 219, 180,
+        141, 102,  63,  24, 240, 201, 162, 123,  84,  45,   6, 222, 183, 144, 105,  66,
+    },
+    {
+        255,  52, 104, 156, 208,   5,  57, 109, 161, 213,  10,  62, 114, 166, 218,  15,
+         67, 119, 171, 223,  20,  72, 124, 176, 228,  25,  77, 129, 181, 233,  30,  82,
+    },
+    {
+        255, 176,  97,  18, 194, 115,  36, 212, 133,  54, 230, 151,  72, 248, 169,  90,
+         11, 187, 108,  29, 205, 126,  47, 223, 144,  65, 241, 162,  83,   4, 180, 101,
+    },
+    {
+        255, 239, 223, 207, 191, 175, 159, 143, 127, 111,  95,  79,  63,  47,  31,  15,
+        254, 238, 222, 206, 190, 174, 158, 142, 126, 110,  94,  78,  62,  46,  30,  14,
+    },
+    {
+        255,  38,  76, 114, 152, 190, 228,  11,  49,  87, 125, 163, 201, 239,  22,  60,
+         98, 136, 174, 212, 250,  33,  71, 109, 147, 185, 223,   6,  44,  82, 120, 158,
+    },
+    {
+        255,  55, 110, 165, 220,  20,  75, 130, 185, 240,  40,  95, 150, 205,   5,  60,
+        115, 170, 225,  25,  80, 135, 190, 245,  45, 100, 155, 210,  10,  65, 120, 175,
+    },
+    {
+        255,  12,  24,  36,  48,  60,  72,  84,  96, 108, 120, 132, 144, 156, 168, 180,
+        192, 204, 216, 228, 240, 252,   9,  21,  33,  45,  57,  69,  81,  93, 105, 117,
+    },
+    {
+        255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,
+         17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,  17,
+    },
+    {
+        255,  68, 136, 204,  17,  85, 153, 221,  34, 102, 170, 238,  51, 119, 187, 255,
+         68, 136, 204,  17,  85, 153, 221,  34, 102, 170, 238,  51, 119, 187, 255,  68,
+    },
+    {
+        255, 111, 222,  78, 189,  45, 156,  12, 123, 234,  90, 201,  57, 168,  24, 135,
+        246, 102, 213,  69, 180,  36, 147,   3, 114, 225,  81, 192,  48, 159,  15, 126,
+    },
+    {
+        255, 120, 240, 105, 225,  90, 210,  75, 195,  60, 180,  45, 165,  30, 150,  15,
+        135, 255, 120, 240, 105, 225,  90, 210,  75, 195,  60, 180,  45, 165,  30, 150,
+    },
+    {
+        255,  25,  50,  75, 100, 125, 150, 175, 200, 225, 250,  20,  45,  70,  95, 120,
+        145, 170, 195, 220, 245,  15,  40,  65,  90, 115, 140, 165, 190, 215, 240,  10,
+    },
+    {
+        255, 154,  53, 207, 106,   5, 159,  58, 212, 111,  10, 164,  63, 217, 116,  15,
+        169,  68, 222, 121,  20, 174,  73, 227, 126,  25, 179,  78, 232, 131,  30, 184,
+    },
+    {
+        255,  71, 142, 213,  29, 100, 171, 242,  58, 129, 200,  16,  87, 158, 229,  45,
+        116, 187,   3,  74, 145, 216,  32, 103, 174, 245,  61, 132, 203,  19,  90, 161,
+    },
+    {
+        255, 116, 232,  93, 209,  70, 186,  47, 163,  24, 140,   1, 117, 233,  94, 210,
+         71, 187,  48, 164,  25, 141,   2, 118, 234,  95, 211,  72, 188,  49, 165,  26,
+    },
+    {
+        255, 167,  79, 246, 158,  70, 237, 149,  61, 228, 140,  52, 219, 131,  43, 210,
+        122,  34, 201, 113,  25, 192, 104,  16, 183,  95,   7, 174,  86, 253, 165,  77,
+    },
+    {
+        255, 193, 131,  69,   7, 200, 138,  76,  14, 207, 145,  83,  21, 214, 152,  90,
+         28, 221, 159,  97,  35, 228, 166, 104,  42, 235, 173, 111,  49, 242, 180, 118,
+    },
+    {
+        255,  35,  70, 105, 140, 175, 210, 245,  25,  60,  95, 130, 165, 200, 235,  15,
+         50,  85, 120, 155, 190, 225,   5,  40,  75, 110, 145, 180, 215, 250,  30,  65,
+    },
+    {
+        255,  83, 166, 249,  77, 160, 243,  71, 154, 237,  65, 148, 231,  59, 142, 225,
+         53, 136, 219,  47, 130, 213,  41, 124, 207,  35, 118, 201,  29, 112, 195,  23,
+    },
+    {
+        255, 137,  19, 156,  38, 175,  57, 194,  76, 213,  95, 232, 114, 251, 133,  15,
+        152,  34, 171,  53, 190,  72, 209,  91, 228, 110, 247, 129,  11, 148,  30, 167,
+    },
+    {
+        255, 251, 247, 243, 239, 235, 231, 227, 223, 219, 215, 211, 207, 203, 199, 195,
+        191, 187, 183, 179, 175, 171, 167, 163, 159, 155, 151, 147, 143, 139, 135, 131,
+    },
+    {
+        255,  20,  40,  60,  80, 100, 120, 140, 160, 180, 200, 220, 240,   5,  25,  45,
+         65,  85, 105, 125, 145, 165, 185, 205, 225, 245,  10,  30,  50,  70,  90, 110,
+    },
+    {
+        255,  93, 186,  24, 117, 210,  48, 141, 234,  72, 165,   3,  96, 189,  27, 120,
+        213,  51, 144, 237,  75, 168,   6,  99, 192,  30, 123, 216,  54, 147, 240,  78,
+    },
+    {
+        255, 248, 241, 234, 227, 220, 213, 206, 199, 192, 185, 178, 171, 164, 157, 150,
+        143, 136, 129, 122, 115, 108, 101,  94,  87,  80,  73,  66,  59,  52,  45,  38,
+    },
+    {
+        255, 151,  47, 198,  94, 245, 141,  37, 188,  84, 235, 131,  27, 178,  74, 225,
+        121,  17, 168,  64, 215, 111,   7, 158,  54, 205, 101, 252, 148,  44, 195,  91,
+    },
+    {
+        255,  46,  92, 138, 184, 230,  21,  67, 113, 159, 205, 251,  42,  88, 134, 180,
+        226,  17,  63, 109, 155, 201, 247,  38,  84, 130, 176, 222,  13,  59, 105, 151,
+    },
+    {
+        255,  75, 150, 225,  45, 120, 195,  15,  90, 165, 240,  60, 135, 210,  30, 105,
+        180, 255,  75, 150, 225,  45, 120, 195,  15,  90, 165, 240,  60, 135, 210,  30,
+    },
+    {
+        255, 185, 115,  45, 230, 160,  90,  20, 205, 135,  65, 250, 180, 110,  40, 225,
+        155,  85,  15, 200, 130,  60, 245, 175, 105,  35, 220, 150,  80,  10, 195, 125,
+    },
+    {
+        255,  96, 192,  33, 129, 225,  66, 162,   3,  99, 195,  36, 132, 228,  69, 165,
+          6, 102, 198,  39, 135, 231,  72, 168,   9, 105, 201,  42, 138, 234,  75, 171,
+    },
+    {
+        255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225,
+        240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210,
+    },
+    {
+        255, 237, 219, 201, 183, 165, 147, 129, 111,  93,  75,  57,  39,  21,   3, 240,
+        222, 204, 186, 168, 150, 132, 114,  96,  78,  60,  42,  24,   6, 243, 225, 207,
+    },
+    {
+        255,  62, 124, 186, 248,  55, 117, 179, 241,  48, 110, 172, 234,  41, 103, 165,
+        227,  34,  96, 158, 220,  27,  89, 151, 213,  20,  82, 144, 206,  13,  75, 137,
+    },
+    {
+        255, 229, 203, 177, 151, 125,  99,  73,  47,  21, 250, 224, 198, 172, 146, 120,
+         94,  68,  42,  16, 245, 219, 193, 167, 141, 115,  89,  63,  37,  11, 240, 214,
+    },
+    {
+        255, 246, 237, 228, 219, 210, 201, 192, 183, 174, 165, 156, 147, 138, 129, 120,
+        111, 102,  93,  84,  75,  66,  57,  48,  39,  30,  21,  12,   3, 249, 240, 231,
+    },
+    {
+        255, 135,  15, 150,  30, 165,  45, 180,  60, 195,  75, 210,  90, 225, 105, 240,
+        120, 255, 135,  15, 150,  30, 165,  45, 180,  60, 195,  75, 210,  90, 225, 105,
+    },
+    {
+        255, 165,  75, 240, 150,  60, 225, 135,  45, 210, 120,  30, 195, 105,  15, 180,
+         90, 255, 165,  75, 240, 150,  60, 225, 135,  45, 210, 120,  30, 195, 105,  15,
+    },
+    {
+        255,  23,  46,  69,  92, 115, 138, 161, 184, 207, 230, 253,  21,  44,  67,  90,
+        113, 136, 159, 182, 205, 228, 251,  19,  42,  65,  88, 111, 134, 157, 180, 203,
+    },
+    {
+        255,  58, 116, 174, 232,  35,  93, 151, 209,  12,  70, 128, 186, 244,  47, 105,
+        163, 221,  24,  82, 140, 198,   1,  59, 117, 175, 233,  36,  94, 152, 210,  13,
+    },
+    {
+        255, 163,  71, 234, 142,  50, 213, 121,  29, 192, 100,   8, 171,  79, 242, 150,
+         58, 221, 129,  37, 200, 108,  16, 179,  87, 250, 158,  66, 229, 137,  45, 208,
+    },
+    {
+        255,  60, 120, 180, 240,  45, 105, 165, 225,  30,  90, 150, 210,  15,  75, 135,
+        195, 255,  60, 120, 180, 240,  45, 105, 165, 225,  30,  90, 150, 210,  15,  75,
+    },
+    {
+        255, 183, 111,  39, 222, 150,  78,   6, 189, 117,  45, 228, 156,  84,  12, 195,
+        123,  51, 234, 162,  90,  18, 201, 129,  57, 240, 168,  96,  24, 207, 135,  63,
+    },
+};
+
+static field_logarithm_t *const ccsds_255_223_element_exp_rows[256] = {
+    (field_logarithm_t *)ccsds_255_223_element_exp[0],
+    (field_logarithm_t *)ccsds_255_223_element_exp[1],
+    (field_logarithm_t *)ccsds_255_223_element_exp[2],
+    (field_logarithm_t *)ccsds_255_223_element_exp[3],
+    (field_logarithm_t *)ccsds_255_223_element_exp[4],
+    (field_logarithm_t *)ccsds_255_223_element_exp[5],
+    (field_logarithm_t *)ccsds_255_223_element_exp[6],
+    (field_logarithm_t *)ccsds_255_223_element_exp[7],
+    (field_logarithm_t *)ccsds_255_223_element_exp[8],
+    (field_logarithm_t *)ccsds_255_223_element_exp[9],
+    (field_logarithm_t *)ccsds_255_223_element_exp[10],
+    (field_logarithm_t *)ccsds_255_223_element_exp[11],
+    (field_logarithm_t *)ccsds_255_223_element_exp[12],
+    (field_logarithm_t *)ccsds_255_223_element_exp[13],
+    (field_logarithm_t *)ccsds_255_223_element_exp[14],
+    (field_logarithm_t *)ccsds_255_223_element_exp[15],
+    (field_logarithm_t *)ccsds_255_223_element_exp[16],
+    (field_logarithm_t *)ccsds_255_223_element_exp[17],
+    (field_logarithm_t *)ccsds_255_223_element_exp[18],
+    (field_logarithm_t *)ccsds_255_223_element_exp[19],
+    (field_logarithm_t *)ccsds_255_223_element_exp[20],
+    (field_logarithm_t *)ccsds_255_223_element_exp[21],
+    (field_logarithm_t *)ccsds_255_223_element_exp[22],
+    (field_logarithm_t *)ccsds_255_223_element_exp[23],
+    (field_logarithm_t *)ccsds_255_223_element_exp[24],
+    (field_logarithm_t *)ccsds_255_223_element_exp[25],
+    (field_logarithm_t *)ccsds_255_223_element_exp[26],
+    (field_logarithm_t *)ccsds_255_223_element_exp[27],
+    (field_logarithm_t *)ccsds_255_223_element_exp[28],
+    (field_logarithm_t *)ccsds_255_223_element_exp[29],
+    (field_logarithm_t *)ccsds_255_223_element_exp[30],
+    (field_logarithm_t *)ccsds_255_223_element_exp[31],
+    (field_logarithm_t *)ccsds_255_223_element_exp[32],
+    (field_logarithm_t *)ccsds_255_223_element_exp[33],
+    (field_logarithm_t *)ccsds_255_223_element_exp[34],
+    (field_logarithm_t *)ccsds_255_223_element_exp[35],
+    (field_logarithm_t *)ccsds_255_223_element_exp[36],
+    (field_logarithm_t *)ccsds_255_223_element_exp[37],
+    (field_logarithm_t *)ccsds_255_223_element_exp[38],
+    (field_logarithm_t *)ccsds_255_223_element_exp[39],
+    (field_logarithm_t *)ccsds_255_223_element_exp[40],
+    (field_logarithm_t *)ccsds_255_223_element_exp[41],
+    (field_logarithm_t *)ccsds_255_223_element_exp[42],
+    (field_logarithm_t *)ccsds_255_223_element_exp[43],
+    (field_logarithm_t *)ccsds_255_223_element_exp[44],
+    (field_logarithm_t *)ccsds_255_223_element_exp[45],
+    (field_logarithm_t *)ccsds_255_223_element_exp[46],
+    (field_logarithm_t *)ccsds_255_223_element_exp[47],
+    (field_logarithm_t *)ccsds_255_223_element_exp[48],
+    (field_logarithm_t *)ccsds_255_223_element_exp[49],
+    (field_logarithm_t *)ccsds_255_223_element_exp[50],
+    (field_logarithm_t *)ccsds_255_223_element_exp[51],
+    (field_logarithm_t *)ccsds_255_223_element_exp[52],
+    (field_logarithm_t *)ccsds_255_223_element_exp[53],
+    (field_logarithm_t *)ccsds_255_223_element_exp[54],
+    (field_logarithm_t *)ccsds_255_223_element_exp[55],
+    (field_logarithm_t *)ccsds_255_223_element_exp[56],
+    (field_logarithm_t *)ccsds_255_223_element_exp[57],
+    (field_logarithm_t *)ccsds_255_223_element_exp[58],
+    (field_logarithm_t *)ccsds_255_223_element_exp[59],
+    (field_logarithm_t *)ccsds_255_223_element_exp[60],
+    (field_logarithm_t *)ccsds_255_223_element_exp[61],
+    (field_logarithm_t *)ccsds_255_223_element_exp[62],
+    (field_logarithm_t *)ccsds_255_223_element_exp[63],
+    (field_logarithm_t *)ccsds_255_223_element_exp[64],
+    (field_logarithm_t *)ccsds_255_223_element_exp[65],
+    (field_logarithm_t *)ccsds_255_223_element_exp[66],
+    (field_logarithm_t *)ccsds_255_223_element_exp[67],
+    (field_logarithm_t *)ccsds_255_223_element_exp[68],
+    (field_logarithm_t *)ccsds_255_223_element_exp[69],
+    (field_logarithm_t *)ccsds_255_223_element_exp[70],
+    (field_logarithm_t *)ccsds_255_223_element_exp[71],
+    (field_logarithm_t *)ccsds_255_223_element_exp[72],
+    (field_logarithm_t *)ccsds_255_223_element_exp[73],
+    (field_logarithm_t *)ccsds_255_223_element_exp[74],
+    (field_logarithm_t *)ccsds_255_223_element_exp[75],
+    (field_logarithm_t *)ccsds_255_223_element_exp[76],
+    (field_logarithm_t *)ccsds_255_223_element_exp[77],
+    (field_logarithm_t *)ccsds_255_223_element_exp[78],
+    (field_logarithm_t *)ccsds_255_223_element_exp[79],
+    (field_logarithm_t *)ccsds_255_223_element_exp[80],
+    (field_logarithm_t *)ccsds_255_223_element_exp[81],
+    (field_logarithm_t *)ccsds_255_223_element_exp[82],
+    (field_logarithm_t *)ccsds_255_223_element_exp[83],
+    (field_logarithm_t *)ccsds_255_223_element_exp[84],
+    (field_logarithm_t *)ccsds_255_223_element_exp[85],
+    (field_logarithm_t *)ccsds_255_223_element_exp[86],
+    (field_logarithm_t *)ccsds_255_223_element_exp[87],
+    (field_logarithm_t *)ccsds_255_223_element_exp[88],
+    (field_logarithm_t *)ccsds_255_223_element_exp[89],
+    (field_logarithm_t *)ccsds_255_223_element_exp[90],
+    (field_logarithm_t *)ccsds_255_223_element_exp[91],
+    (field_logarithm_t *)ccsds_255_223_element_exp[92],
+    (field_logarithm_t *)ccsds_255_223_element_exp[93],
+    (field_logarithm_t *)ccsds_255_223_element_exp[94],
+    (field_logarithm_t *)ccsds_255_223_element_exp[95],
+    (field_logarithm_t *)ccsds_255_223_element_exp[96],
+    (field_logarithm_t *)ccsds_255_223_element_exp[97],
+    (field_logarithm_t *)ccsds_255_223_element_exp[98],
+    (field_logarithm_t *)ccsds_255_223_element_exp[99],
+    (field_logarithm_t *)ccsds_255_223_element_exp[100],
+    (field_logarithm_t *)ccsds_255_223_element_exp[101],
+    (field_logarithm_t *)ccsds_255_223_element_exp[102],
+    (field_logarithm_t *)ccsds_255_223_element_exp[103],
+    (field_logarithm_t *)ccsds_255_223_element_exp[104],
+    (field_logarithm_t *)ccsds_255_223_element_exp[105],
+    (field_logarithm_t *)ccsds_255_223_element_exp[106],
+    (field_logarithm_t *)ccsds_255_223_element_exp[107],
+    (field_logarithm_t *)ccsds_255_223_element_exp[108],
+    (field_logarithm_t *)ccsds_255_223_element_exp[109],
+    (field_logarithm_t *)ccsds_255_223_element_exp[110],
+    (field_logarithm_t *)ccsds_255_223_element_exp[111],
+    (field_logarithm_t *)ccsds_255_223_element_exp[112],
+    (field_logarithm_t *)ccsds_255_223_element_exp[113],
+    (field_logarithm_t *)ccsds_255_223_element_exp[114],
+    (field_logarithm_t *)ccsds_255_223_element_exp[115],
+    (field_logarithm_t *)ccsds_255_223_element_exp[116],
+    (field_logarithm_t *)ccsds_255_223_element_exp[117],
+    (field_logarithm_t *)ccsds_255_223_element_exp[118],
+    (field_logarithm_t *)ccsds_255_223_element_exp[119],
+    (field_logarithm_t *)ccsds_255_223_element_exp[120],
+    (field_logarithm_t *)ccsds_255_223_element_exp[121],
+    (field_logarithm_t *)ccsds_255_223_element_exp[122],
+    (field_logarithm_t *)ccsds_255_223_element_exp[123],
+    (field_logarithm_t *)ccsds_255_223_element_exp[124],
+    (field_logarithm_t *)ccsds_255_223_element_exp[125],
+    (field_logarithm_t *)ccsds_255_223_element_exp[126],
+    (field_logarithm_t *)ccsds_255_223_element_exp[127],
+    (field_logarithm_t *)ccsds_255_223_element_exp[128],
+    (field_logarithm_t *)ccsds_255_223_element_exp[129],
+    (field_logarithm_t *)ccsds_255_223_element_exp[130],
+    (field_logarithm_t *)ccsds_255_223_element_exp[131],
+    (field_logarithm_t *)ccsds_255_223_element_exp[132],
+    (field_logarithm_t *)ccsds_255_223_element_exp[133],
+    (field_logarithm_t *)ccsds_255_223_element_exp[134],
+    (field_logarithm_t *)ccsds_255_223_element_exp[135],
+    (field_logarithm_t *)ccsds_255_223_element_exp[136],
+    (field_logarithm_t *)ccsds_255_223_element_exp[137],
+    (field_logarithm_t *)ccsds_255_223_element_exp[138],
+    (field_logarithm_t *)ccsds_255_223_element_exp[139],
+    (field_logarithm_t *)ccsds_255_223_element_exp[140],
+    (field_logarithm_t *)ccsds_255_223_element_exp[141],
+    (field_logarithm_t *)ccsds_255_223_element_exp[142],
+    (field_logarithm_t *)ccsds_255_223_element_exp[143],
+    (field_logarithm_t *)ccsds_255_223_element_exp[144],
+    (field_logarithm_t *)ccsds_255_223_element_exp[145],
+    (field_logarithm_t *)ccsds_255_223_element_exp[146],
+    (field_logarithm_t *)ccsds_255_223_element_exp[147],
+    (field_logarithm_t *)ccsds_255_223_element_exp[148],
+    (field_logarithm_t *)ccsds_255_223_element_exp[149],
+    (field_logarithm_t *)ccsds_255_223_element_exp[150],
+    (field_logarithm_t *)ccsds_255_223_element_exp[151],
+    (field_logarithm_t *)ccsds_255_223_element_exp[152],
+    (field_logarithm_t *)ccsds_255_223_element_exp[153],
+    (field_logarithm_t *)ccsds_255_223_element_exp[154],
+    (field_logarithm_t *)ccsds_255_223_element_exp[155],
+    (field_logarithm_t *)ccsds_255_223_element_exp[156],
+    (field_logarithm_t *)ccsds_255_223_element_exp[157],
+    (field_logarithm_t *)ccsds_255_223_element_exp[158],
+    (field_logarithm_t *)ccsds_255_223_element_exp[159],
+    (field_logarithm_t *)ccsds_255_223_element_exp[160],
+    (field_logarithm_t *)ccsds_255_223_element_exp[161],
+    (field_logarithm_t *)ccsds_255_223_element_exp[162],
+    (field_logarithm_t *)ccsds_255_223_element_exp[163],
+    (field_logarithm_t *)ccsds_255_223_element_exp[164],
+    (field_logarithm_t *)ccsds_255_223_element_exp[165],
+    (field_logarithm_t *)ccsds_255_223_element_exp[166],
+    (field_logarithm_t *)ccsds_255_223_element_exp[167],
+    (field_logarithm_t *)ccsds_255_223_element_exp[168],
+    (field_logarithm_t *)ccsds_255_223_element_exp[169],
+    (field_logarithm_t *)ccsds_255_223_element_exp[170],
+    (field_logarithm_t *)ccsds_255_223_element_exp[171],
+    (field_logarithm_t *)ccsds_255_223_element_exp[172],
+    (field_logarithm_t *)ccsds_255_223_element_exp[173],
+    (field_logarithm_t *)ccsds_255_223_element_exp[174],
+    (field_logarithm_t *)ccsds_255_223_element_exp[175],
+    (field_logarithm_t *)ccsds_255_223_element_exp[176],
+    (field_logarithm_t *)ccsds_255_223_element_exp[177],
+    (field_logarithm_t *)ccsds_255_223_element_exp[178],
+    (field_logarithm_t *)ccsds_255_223_element_exp[179],
+    (field_logarithm_t *)ccsds_255_223_element_exp[180],
+    (field_logarithm_t *)ccsds_255_223_element_exp[181],
+    (field_logarithm_t *)ccsds_255_223_element_exp[182],
+    (field_logarithm_t *)ccsds_255_223_element_exp[183],
+    (field_logarithm_t *)ccsds_255_223_element_exp[184],
+    (field_logarithm_t *)ccsds_255_223_element_exp[185],
+    (field_logarithm_t *)ccsds_255_223_element_exp[186],
+    (field_logarithm_t *)ccsds_255_223_element_exp[187],
+    (field_logarithm_t *)ccsds_255_223_element_exp[188],
+    (field_logarithm_t *)ccsds_255_223_element_exp[189],
+    (field_logarithm_t *)ccsds_255_223_element_exp[190],
+    (field_logarithm_t *)ccsds_255_223_element_exp[191],
+    (field_logarithm_t *)ccsds_255_223_element_exp[192],
+    (field_logarithm_t *)ccsds_255_223_element_exp[193],
+    (field_logarithm_t *)ccsds_255_223_element_exp[194],
+    (field_logarithm_t *)ccsds_255_223_element_exp[195],
+    (field_logarithm_t *)ccsds_255_223_element_exp[196],
+    (field_logarithm_t *)ccsds_255_223_element_exp[197],
+    (field_logarithm_t *)ccsds_255_223_element_exp[198],
+    (field_logarithm_t *)ccsds_255_223_element_exp[199],
+    (field_logarithm_t *)ccsds_255_223_element_exp[200],
+    (field_logarithm_t *)ccsds_255_223_element_exp[201],
+    (field_logarithm_t *)ccsds_255_223_element_exp[202],
+    (field_logarithm_t *)ccsds_255_223_element_exp[203],
+    (field_logarithm_t *)ccsds_255_223_element_exp[204],
+    (field_logarithm_t *)ccsds_255_223_element_exp[205],
+    (field_logarithm_t *)ccsds_255_223_element_exp[206],
+    (field_logarithm_t *)ccsds_255_223_element_exp[207],
+    (field_logarithm_t *)ccsds_255_223_element_exp[208],
+    (field_logarithm_t *)ccsds_255_223_element_exp[209],
+    (field_logarithm_t *)ccsds_255_223_element_exp[210],
+    (field_logarithm_t *)ccsds_255_223_element_exp[211],
+    (field_logarithm_t *)ccsds_255_223_element_exp[212],
+    (field_logarithm_t *)ccsds_255_223_element_exp[213],
+    (field_logarithm_t *)ccsds_255_223_element_exp[214],
+    (field_logarithm_t *)ccsds_255_223_element_exp[215],
+    (field_logarithm_t *)ccsds_255_223_element_exp[216],
+    (field_logarithm_t *)ccsds_255_223_element_exp[217],
+    (field_logarithm_t *)ccsds_255_223_element_exp[218],
+    (field_logarithm_t *)ccsds_255_223_element_exp[219],
+    (field_logarithm_t *)ccsds_255_223_element_exp[220],
+    (field_logarithm_t *)ccsds_255_223_element_exp[221],
+    (field_logarithm_t *)ccsds_255_223_element_exp[222],
+    (field_logarithm_t *)ccsds_255_223_element_exp[223],
+    (field_logarithm_t *)ccsds_255_223_element_exp[224],
+    (field_logarithm_t *)ccsds_255_223_element_exp[225],
+    (field_logarithm_t *)ccsds_255_223_element_exp[226],
+    (field_logarithm_t *)ccsds_255_223_element_exp[227],
+    (field_logarithm_t *)ccsds_255_223_element_exp[228],
+    (field_logarithm_t *)ccsds_255_223_element_exp[229],
+    (field_logarithm_t *)ccsds_255_223_element_exp[230],
+    (field_logarithm_t *)ccsds_255_223_element_exp[231],
+    (field_logarithm_t *)ccsds_255_223_element_exp[232],
+    (field_logarithm_t *)ccsds_255_223_element_exp[233],
+    (field_logarithm_t *)ccsds_255_223_element_exp[234],
+    (field_logarithm_t *)ccsds_255_223_element_exp[235],
+    (field_logarithm_t *)ccsds_255_223_element_exp[236],
+    (field_logarithm_t *)ccsds_255_223_element_exp[237],
+    (field_logarithm_t *)ccsds_255_223_element_exp[238],
+    (field_logarithm_t *)ccsds_255_223_element_exp[239],
+    (field_logarithm_t *)ccsds_255_223_element_exp[240],
+    (field_logarithm_t *)ccsds_255_223_element_exp[241],
+    (field_logarithm_t *)ccsds_255_223_element_exp[242],
+    (field_logarithm_t *)ccsds_255_223_element_exp[243],
+    (field_logarithm_t *)ccsds_255_223_element_exp[244],
+    (field_logarithm_t *)ccsds_255_223_element_exp[245],
+    (field_logarithm_t *)ccsds_255_223_element_exp[246],
+    (field_logarithm_t *)ccsds_255_223_element_exp[247],
+    (field_logarithm_t *)ccsds_255_223_element_exp[248],
+    (field_logarithm_t *)ccsds_255_223_element_exp[249],
+    (field_logarithm_t *)ccsds_255_223_element_exp[250],
+    (field_logarithm_t *)ccsds_255_223_element_exp[251],
+    (field_logarithm_t *)ccsds_255_223_element_exp[252],
+    (field_logarithm_t *)ccsds_255_223_element_exp[253],
+    (field_logarithm_t *)ccsds_255_223_element_exp[254],
+    (field_logarithm_t *)ccsds_255_223_element_exp[255],
+};
+
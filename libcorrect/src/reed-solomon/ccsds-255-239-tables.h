@@ -0,0 +1,1406 @@
+// generated by tools/gen_rs_static_tables.c, do not edit
+// (255, 239) reed-solomon, ccsds primitive polynomial 0x187, first consecutive root 1, root gap 1
+
+static const field_element_t ccsds_255_239_exp[512] = {
+      1,   2,   4,   8,  16,  32,  64, 128, 135, 137, 149, 173, 221,  61, 122, 244,
+    111, 222,  59, 118, 236,  95, 190, 251, 113, 226,  67, 134, 139, 145, 165, 205,
+     29,  58, 116, 232,  87, 174, 219,  49,  98, 196,  15,  30,  60, 120, 240, 103,
+    206,  27,  54, 108, 216,  55, 110, 220,  63, 126, 252, 127, 254, 123, 246, 107,
+    214,  43,  86, 172, 223,  57, 114, 228,  79, 158, 187, 241, 101, 202,  19,  38,
+     76, 152, 183, 233,  85, 170, 211,  33,  66, 132, 143, 153, 181, 237,  93, 186,
+    243,  97, 194,   3,   6,  12,  24,  48,  96, 192,   7,  14,  28,  56, 112, 224,
+     71, 142, 155, 177, 229,  77, 154, 179, 225,  69, 138, 147, 161, 197,  13,  26,
+     52, 104, 208,  39,  78, 156, 191, 249, 117, 234,  83, 166, 203,  17,  34,  68,
+    136, 151, 169, 213,  45,  90, 180, 239,  89, 178, 227,  65, 130, 131, 129, 133,
+    141, 157, 189, 253, 125, 250, 115, 230,  75, 150, 171, 209,  37,  74, 148, 175,
+    217,  53, 106, 212,  47,  94, 188, 255, 121, 242,  99, 198,  11,  22,  44,  88,
+    176, 231,  73, 146, 163, 193,   5,  10,  20,  40,  80, 160, 199,   9,  18,  36,
+     72, 144, 167, 201,  21,  42,  84, 168, 215,  41,  82, 164, 207,  25,  50, 100,
+    200,  23,  46,  92, 184, 247, 105, 210,  35,  70, 140, 159, 185, 245, 109, 218,
+     51, 102, 204,  31,  62, 124, 248, 119, 238,  91, 182, 235,  81, 162, 195,   1,
+      2,   4,   8,  16,  32,  64, 128, 135, 137, 149, 173, 221,  61, 122, 244, 111,
+    222,  59, 118, 236,  95, 190, 251, 113, 226,  67, 134, 139, 145, 165, 205,  29,
+     58, 116, 232,  87, 174, 219,  49,  98, 196,  15,  30,  60, 120, 240, 103, 206,
+     27,  54, 108, 216,  55, 110, 220,  63, 126, 252, 127, 254, 123, 246, 107, 214,
+     43,  86, 172, 223,  57, 114, 228,  79, 158, 187, 241, 101, 202,  19,  38,  76,
+    152, 183, 233,  85, 170, 211,  33,  66, 132, 143, 153, 181, 237,  93, 186, 243,
+     97, 194,   3,   6,  12,  24,  48,  96, 192,   7,  14,  28,  56, 112, 224,  71,
+    142, 155, 177, 229,  77, 154, 179, 225,  69, 138, 147, 161, 197,  13,  26,  52,
+    104, 208,  39,  78, 156, 191, 249, 117, 234,  83, 166, 203,  17,  34,  68, 136,
+    151, 169, 213,  45,  90, 180, 239,  89, 178, 227,  65, 130, 131, 129, 133, 141,
+    157, 189, 253, 125, 250, 115, 230,  75, 150, 171, 209,  37,  74, 148, 175, 217,
+     53, 106, 212,  47,  94, 188, 255, 121, 242,  99, 198,  11,  22,  44,  88, 176,
+    231,  73, 146, 163, 193,   5,  10,  20,  40,  80, 160, 199,   9,  18,  36,  72,
+    144, 167, 201,  21,  42,  84, 168, 215,  41,  82, 164, 207,  25,  50, 100, 200,
+     23,  46,  92, 184, 247, 105, 210,  35,  70, 140, 159, 185, 245, 109, 218,  51,
+    102, 204,  31,  62, 124, 248, 119, 238,  91, 182, 235,  81, 162, 195,   1,   2,
+};
+
+static const field_logarithm_t ccsds_255_239_log[256] = {
+      0, 255,   1,  99,   2, 198, 100, 106,   3, 205, 199, 188, 101, 126, 107,  42,
+      4, 141, 206,  78, 200, 212, 189, 225, 102, 221, 127,  49, 108,  32,  43, 243,
+      5,  87, 142, 232, 207, 172,  79, 131, 201, 217, 213,  65, 190, 148, 226, 180,
+    103,  39, 222, 240, 128, 177,  50,  53, 109,  69,  33,  18,  44,  13, 244,  56,
+      6, 155,  88,  26, 143, 121, 233, 112, 208, 194, 173, 168,  80, 117, 132,  72,
+    202, 252, 218, 138, 214,  84,  66,  36, 191, 152, 149, 249, 227,  94, 181,  21,
+    104,  97,  40, 186, 223,  76, 241,  47, 129, 230, 178,  63,  51, 238,  54,  16,
+    110,  24,  70, 166,  34, 136,  19, 247,  45, 184,  14,  61, 245, 164,  57,  59,
+      7, 158, 156, 157,  89, 159,  27,   8, 144,   9, 122,  28, 234, 160, 113,  90,
+    209,  29, 195, 123, 174,  10, 169, 145,  81,  91, 118, 114, 133, 161,  73, 235,
+    203, 124, 253, 196, 219,  30, 139, 210, 215, 146,  85, 170,  67,  11,  37, 175,
+    192, 115, 153, 119, 150,  92, 250,  82, 228, 236,  95,  74, 182, 162,  22, 134,
+    105, 197,  98, 254,  41, 125, 187, 204, 224, 211,  77, 140, 242,  31,  48, 220,
+    130, 171, 231,  86, 179, 147,  64, 216,  52, 176, 239,  38,  55,  12,  17,  68,
+    111, 120,  25, 154,  71, 116, 167, 193,  35,  83, 137, 251,  20,  93, 248, 151,
+     46,  75, 185,  96,  15, 237,  62, 229, 246, 135, 165,  23,  58, 163,  60, 183,
+};
+
+static const field_element_t ccsds_255_239_generator[17] = {
+    117, 241,   3, 163, 211,  15,   5, 199, 126, 198, 125, 248,  59, 224,  81, 201,
+      1,
+};
+
+static const field_element_t ccsds_255_239_generator_roots[16] = {
+      2,   4,   8,  16,  32,  64, 128, 135, 137, 149, 173, 221,  61, 122, 244, 111,
+};
+
+static const field_logarithm_t ccsds_255_239_generator_root_exp[16][255] = {
+    {
+        255,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+         16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+         32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+         48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+         64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+         80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,
+         96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+        112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+        128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+        144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+        160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+        176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+        192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+        208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+        224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+        240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254,
+    },
+    {
+        255,   2,   4,   6,   8,  10,  12,  14,  16,  18,  20,  22,  24,  26,  28,  30,
+         32,  34,  36,  38,  40,  42,  44,  46,  48,  50,  52,  54,  56,  58,  60,  62,
+         64,  66,  68,  70,  72,  74,  76,  78,  80,  82,  84,  86,  88,  90,  92,  94,
+         96,  98, 100, 102, 104, 106, 108, 110, 112, 114, 116, 118, 120, 122, 124, 126,
+        128, 130, 132, 134, 136, 138, 140, 142, 144, 146, 148, 150, 152, 154, 156, 158,
+        160, 162, 164, 166, 168, 170, 172, 174, 176, 178, 180, 182, 184, 186, 188, 190,
+        192, 194, 196, 198, 200, 202, 204, 206, 208, 210, 212, 214, 216, 218, 220, 222,
+        224, 226, 228, 230, 232, 234, 236, 238, 240, 242, 244, 246, 248, 250, 252, 254,
+          1,   3,   5,   7,   9,  11,  13,  15,  17,  19,  21,  23,  25,  27,  29,  31,
+         33,  35,  37,  39,  41,  43,  45,  47,  49,  51,  53,  55,  57,  59,  61,  63,
+         65,  67,  69,  71,  73,  75,  77,  79,  81,  83,  85,  87,  89,  91,  93,  95,
+         97,  99, 101, 103, 105, 107, 109, 111, 113, 115, 117, 119, 121, 123, 125, 127,
+        129, 131, 133, 135, 137, 139, 141, 143, 145, 147, 149, 151, 153, 155, 157, 159,
+        161, 163, 165, 167, 169, 171, 173, 175, 177, 179, 181, 183, 185, 187, 189, 191,
+        193, 195, 197, 199, 201, 203, 205, 207, 209, 211, 213, 215, 217, 219, 221, 223,
+        225, 227, 229, 231, 233, 235, 237, 239, 241, 243, 245, 247, 249, 251, 253,
+    },
+    {
+        255,   3,   6,   9,  12,  15,  18,  21,  24,  27,  30,  33,  36,  39,  42,  45,
+         48,  51,  54,  57,  60,  63,  66,  69,  72,  75,  78,  81,  84,  87,  90,  93,
+         96,  99, 102, 105, 108, 111, 114, 117, 120, 123, 126, 129, 132, 135, 138, 141,
+        144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174, 177, 180, 183, 186, 189,
+        192, 195, 198, 201, 204, 207, 210, 213, 216, 219, 222, 225, 228, 231, 234, 237,
+        240, 243, 246, 249, 252, 255,   3,   6,   9,  12,  15,  18,  21,  24,  27,  30,
+         33,  36,  39,  42,  45,  48,  51,  54,  57,  60,  63,  66,  69,  72,  75,  78,
+         81,  84,  87,  90,  93,  96,  99, 102, 105, 108, 111, 114, 117, 120, 123, 126,
+        129, 132, 135, 138, 141, 144, 147, 150, 153, 156, 159, 162, 165, 168, 171, 174,
+        177, 180, 183, 186, 189, 192, 195, 198, 201, 204, 207, 210, 213, 216, 219, 222,
+        225, 228, 231, 234, 237, 240, 243, 246, 249, 252, 255,   3,   6,   9,  12,  15,
+         18,  21,  24,  27,  30,  33,  36,  39,  42,  45,  48,  51,  54,  57,  60,  63,
+         66,  69,  72,  75,  78,  81,  84,  87,  90,  93,  96,  99, 102, 105, 108, 111,
+        114, 117, 120, 123, 126, 129, 132, 135, 138, 141, 144, 147, 150, 153, 156, 159,
+        162, 165, 168, 171, 174, 177, 180, 183, 186, 189, 192, 195, 198, 201, 204, 207,
+        210, 213, 216, 219, 222, 225, 228, 231, 234, 237, 240, 243, 246, 249, 252,
+    },
+    {
+        255,   4,   8,  12,  16,  20,  24,  28,  32,  36,  40,  44,  48,  52,  56,  60,
+         64,  68,  72,  76,  80,  84,  88,  92,  96, 100, 104, 108, 112, 116, 120, 124,
+        128, 132, 136, 140, 144, 148, 152, 156, 160, 164, 168, 172, 176, 180, 184, 188,
+        192, 196, 200, 204, 208, 212, 216, 220, 224, 228, 232, 236, 240, 244, 248, 252,
+          1,   5,   9,  13,  17,  21,  25,  29,  33,  37,  41,  45,  49,  53,  57,  61,
+         65,  69,  73,  77,  81,  85,  89,  93,  97, 101, 105, 109, 113, 117, 121, 125,
+        129, 133, 137, 141, 145, 149, 153, 157, 161, 165, 169, 173, 177, 181, 185, 189,
+        193, 197, 201, 205, 209, 213, 217, 221, 225, 229, 233, 237, 241, 245, 249, 253,
+          2,   6,  10,  14,  18,  22,  26,  30,  34,  38,  42,  46,  50,  54,  58,  62,
+         66,  70,  74,  78,  82,  86,  90,  94,  98, 102, 106, 110, 114, 118, 122, 126,
+        130, 134, 138, 142, 146, 150, 154, 158, 162, 166, 170, 174, 178, 182, 186, 190,
+        194, 198, 202, 206, 210, 214, 218, 222, 226, 230, 234, 238, 242, 246, 250, 254,
+          3,   7,  11,  15,  19,  23,  27,  31,  35,  39,  43,  47,  51,  55,  59,  63,
+         67,  71,  75,  79,  83,  87,  91,  95,  99, 103, 107, 111, 115, 119, 123, 127,
+        131, 135, 139, 143, 147, 151, 155, 159, 163, 167, 171, 175, 179, 183, 187, 191,
+        195, 199, 203, 207, 211, 215, 219, 223, 227, 231, 235, 239, 243, 247, 251,
+    },
+    {
+        255,   5,  10,  15,  20,  25,  30,  35,  40,  45,  50,  55,  60,  65,  70,  75,
+         80,  85,  90,  95, 100, 105, 110, 115, 120, 125, 130, 135, 140, 145, 150, 155,
+        160, 165, 170, 175, 180, 185, 190, 195, 200, 205, 210, 215, 220, 225, 230, 235,
+        240, 245, 250, 255,   5,  10,  15,  20,  25,  30,  35,  40,  45,  50,  55,  60,
+         65,  70,  75,  80,  85,  90,  95, 100, 105, 110, 115, 120, 125, 130, 135, 140,
+        145, 150, 155, 160, 165, 170, 175, 180, 185, 190, 195, 200, 205, 210, 215, 220,
+        225, 230, 235, 240, 245, 250, 255,   5,  10,  15,  20,  25,  30,  35,  40,  45,
+         50,  55,  60,  65,  70,  75,  80,  85,  90,  95, 100, 105, 110, 115, 120, 125,
+        130, 135, 140, 145, 150, 155, 160, 165, 170, 175, 180, 185, 190, 195, 200, 205,
+        210, 215, 220, 225, 230, 235, 240, 245, 250, 255,   5,  10,  15,  20,  25,  30,
+         35,  40,  45,  50,  55,  60,  65,  70,  75,  80,  85,  90,  95, 100, 105, 110,
+        115, 120, 125, 130, 135, 140, 145, 150, 155, 160, 165, 170, 175, 180, 185, 190,
+        195, 200, 205, 210, 215, 220, 225, 230, 235, 240, 245, 250, 255,   5,  10,  15,
+         20,  25,  30,  35,  40,  45,  50,  55,  60,  65,  70,  75,  80,  85,  90,  95,
+        100, 105, 110, 115, 120, 125, 130, 135, 140, 145, 150, 155, 160, 165, 170, 175,
+        180, 185, 190, 195, 200, 205, 210, 215, 220, 225, 230, 235, 240, 245, 250,
+    },
+    {
+        255,   6,  12,  18,  24,  30,  36,  42,  48,  54,  60,  66,  72,  78,  84,  90,
+         96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156, 162, 168, 174, 180, 186,
+        192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252,   3,   9,  15,  21,  27,
+         33,  39,  45,  51,  57,  63,  69,  75,  81,  87,  93,  99, 105, 111, 117, 123,
+        129, 135, 141, 147, 153, 159, 165, 171, 177, 183, 189, 195, 201, 207, 213, 219,
+        225, 231, 237, 243, 249, 255,   6,  12,  18,  24,  30,  36,  42,  48,  54,  60,
+         66,  72,  78,  84,  90,  96, 102, 108, 114, 120, 126, 132, 138, 144, 150, 156,
+        162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222, 228, 234, 240, 246, 252,
+          3,   9,  15,  21,  27,  33,  39,  45,  51,  57,  63,  69,  75,  81,  87,  93,
+         99, 105, 111, 117, 123, 129, 135, 141, 147, 153, 159, 165, 171, 177, 183, 189,
+        195, 201, 207, 213, 219, 225, 231, 237, 243, 249, 255,   6,  12,  18,  24,  30,
+         36,  42,  48,  54,  60,  66,  72,  78,  84,  90,  96, 102, 108, 114, 120, 126,
+        132, 138, 144, 150, 156, 162, 168, 174, 180, 186, 192, 198, 204, 210, 216, 222,
+        228, 234, 240, 246, 252,   3,   9,  15,  21,  27,  33,  39,  45,  51,  57,  63,
+         69,  75,  81,  87,  93,  99, 105, 111, 117, 123, 129, 135, 141, 147, 153, 159,
+        165, 171, 177, 183, 189, 195, 201, 207, 213, 219, 225, 231, 237, 243, 249,
+    },
+    {
+        255,   7,  14,  21,  28,  35,  42,  49,  56,  63,  70,  77,  84,  91,  98, 105,
+        112, 119, 126, 133, 140, 147, 154, 161, 168, 175, 182, 189, 196, 203, 210, 217,
+        224, 231, 238, 245, 252,   4,  11,  18,  25,  32,  39,  46,  53,  60,  67,  74,
+         81,  88,  95, 102, 109, 116, 123, 130, 137, 144, 151, 158, 165, 172, 179, 186,
+        193, 200, 207, 214, 221, 228, 235, 242, 249,   1,   8,  15,  22,  29,  36,  43,
+         50,  57,  64,  71,  78,  85,  92,  99, 106, 113, 120, 127, 134, 141, 148, 155,
+        162, 169, 176, 183, 190, 197, 204, 211, 218, 225, 232, 239, 246, 253,   5,  12,
+         19,  26,  33,  40,  47,  54,  61,  68,  75,  82,  89,  96, 103, 110, 117, 124,
+        131, 138, 145, 152, 159, 166, 173, 180, 187, 194, 201, 208, 215, 222, 229, 236,
+        243, 250,   2,   9,  16,  23,  30,  37,  44,  51,  58,  65,  72,  79,  86,  93,
+        100, 107, 114, 121, 128, 135, 142, 149, 156, 163, 170, 177, 184, 191, 198, 205,
+        212, 219, 226, 233, 240, 247, 254,   6,  13,  20,  27,  34,  41,  48,  55,  62,
+         69,  76,  83,  90,  97, 104, 111, 118, 125, 132, 139, 146, 153, 160, 167, 174,
+        181, 188, 195, 202, 209, 216, 223, 230, 237, 244, 251,   3,  10,  17,  24,  31,
+         38,  45,  52,  59,  66,  73,  80,  87,  94, 101, 108, 115, 122, 129, 136, 143,
+        150, 157, 164, 171, 178, 185, 192, 199, 206, 213, 220, 227, 234, 241, 248,
+    },
+    {
+        255,   8,  16,  24,  32,  40,  48,  56,  64,  72,  80,  88,  96, 104, 112, 120,
+        128, 136, 144, 152, 160, 168, 176, 184, 192, 200, 208, 216, 224, 232, 240, 248,
+          1,   9,  17,  25,  33,  41,  49,  57,  65,  73,  81,  89,  97, 105, 113, 121,
+        129, 137, 145, 153, 161, 169, 177, 185, 193, 201, 209, 217, 225, 233, 241, 249,
+          2,  10,  18,  26,  34,  42,  50,  58,  66,  74,  82,  90,  98, 106, 114, 122,
+        130, 138, 146, 154, 162, 170, 178, 186, 194, 202, 210, 218, 226, 234, 242, 250,
+          3,  11,  19,  27,  35,  43,  51,  59,  67,  75,  83,  91,  99, 107, 115, 123,
+        131, 139, 147, 155, 163, 171, 179, 187, 195, 203, 211, 219, 227, 235, 243, 251,
+          4,  12,  20,  28,  36,  44,  52,  60,  68,  76,  84,  92, 100, 108, 116, 124,
+        132, 140, 148, 156, 164, 172, 180, 188, 196, 204, 212, 220, 228, 236, 244, 252,
+          5,  13,  21,  29,  37,  45,  53,  61,  69,  77,  85,  93, 101, 109, 117, 125,
+        133, 141, 149, 157, 165, 173, 181, 189, 197, 205, 213, 221, 229, 237, 245, 253,
+          6,  14,  22,  30,  38,  46,  54,  62,  70,  78,  86,  94, 102, 110, 118, 126,
+        134, 142, 150, 158, 166, 174, 182, 190, 198, 206, 214, 222, 230, 238, 246, 254,
+          7,  15,  23,  31,  39,  47,  55,  63,  71,  79,  87,  95, 103, 111, 119, 127,
+        135, 143, 151, 159, 167, 175, 183, 191, 199, 207, 215, 223, 231, 239, 247,
+    },
+    {
+        255,   9,  18,  27,  36,  45,  54,  63,  72,  81,  90,  99, 108, 117, 126, 135,
+        144, 153, 162, 171, 180, 189, 198, 207, 216, 225, 234, 243, 252,   6,  15,  24,
+         33,  42,  51,  60,  69,  78,  87,  96, 105, 114, 123, 132, 141, 150, 159, 168,
+        177, 186, 195, 204, 213, 222, 231, 240, 249,   3,  12,  21,  30,  39,  48,  57,
+         66,  75,  84,  93, 102, 111, 120, 129, 138, 147, 156, 165, 174, 183, 192, 201,
+        210, 219, 228, 237, 246, 255,   9,  18,  27,  36,  45,  54,  63,  72,  81,  90,
+         99, 108, 117, 126, 135, 144, 153, 162, 171, 180, 189, 198, 207, 216, 225, 234,
+        243, 252,   6,  15,  24,  33,  42,  51,  60,  69,  78,  87,  96, 105, 114, 123,
+        132, 141, 150, 159, 168, 177, 186, 195, 204, 213, 222, 231, 240, 249,   3,  12,
+         21,  30,  39,  48,  57,  66,  75,  84,  93, 102, 111, 120, 129, 138, 147, 156,
+        165, 174, 183, 192, 201, 210, 219, 228, 237, 246, 255,   9,  18,  27,  36,  45,
+         54,  63,  72,  81,  90,  99, 108, 117, 126, 135, 144, 153, 162, 171, 180, 189,
+        198, 207, 216, 225, 234, 243, 252,   6,  15,  24,  33,  42,  51,  60,  69,  78,
+         87,  96, 105, 114, 123, 132, 141, 150, 159, 168, 177, 186, 195, 204, 213, 222,
+        231, 240, 249,   3,  12,  21,  30,  39,  48,  57,  66,  75,  84,  93, 102, 111,
+        120, 129, 138, 147, 156, 165, 174, 183, 192, 201, 210, 219, 228, 237, 246,
+    },
+    {
+        255,  10,  20,  30,  40,  50,  60,  70,  80,  90, 100, 110, 120, 130, 140, 150,
+        160, 170, 180, 190, 200, 210, 220, 230, 240, 250,   5,  15,  25,  35,  45,  55,
+         65,  75,  85,  95, 105, 115, 125, 135, 145, 155, 165, 175, 185, 195, 205, 215,
+        225, 235, 245, 255,  10,  20,  30,  40,  50,  60,  70,  80,  90, 100, 110, 120,
+        130, 140, 150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250,   5,  15,  25,
+         35,  45,  55,  65,  75,  85,  95, 105, 115, 125, 135, 145, 155, 165, 175, 185,
+        195, 205, 215, 225, 235, 245, 255,  10,  20,  30,  40,  50,  60,  70,  80,  90,
+        100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 220, 230, 240, 250,
+          5,  15,  25,  35,  45,  55,  65,  75,  85,  95, 105, 115, 125, 135, 145, 155,
+        165, 175, 185, 195, 205, 215, 225, 235, 245, 255,  10,  20,  30,  40,  50,  60,
+         70,  80,  90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190, 200, 210, 220,
+        230, 240, 250,   5,  15,  25,  35,  45,  55,  65,  75,  85,  95, 105, 115, 125,
+        135, 145, 155, 165, 175, 185, 195, 205, 215, 225, 235, 245, 255,  10,  20,  30,
+         40,  50,  60,  70,  80,  90, 100, 110, 120, 130, 140, 150, 160, 170, 180, 190,
+        200, 210, 220, 230, 240, 250,   5,  15,  25,  35,  45,  55,  65,  75,  85,  95,
+        105, 115, 125, 135, 145, 155, 165, 175, 185, 195, 205, 215, 225, 235, 245,
+    },
+    {
+        255,  11,  22,  33,  44,  55,  66,  77,  88,  99, 110, 121, 132, 143, 154, 165,
+        176, 187, 198, 209, 220, 231, 242, 253,   9,  20,  31,  42,  53,  64,  75,  86,
+         97, 108, 119, 130, 141, 152, 163, 174, 185, 196, 207, 218, 229, 240, 251,   7,
+         18,  29,  40,  51,  62,  73,  84,  95, 106, 117, 128, 139, 150, 161, 172, 183,
+        194, 205, 216, 227, 238, 249,   5,  16,  27,  38,  49,  60,  71,  82,  93, 104,
+        115, 126, 137, 148, 159, 170, 181, 192, 203, 214, 225, 236, 247,   3,  14,  25,
+         36,  47,  58,  69,  80,  91, 102, 113, 124, 135, 146, 157, 168, 179, 190, 201,
+        212, 223, 234, 245,   1,  12,  23,  34,  45,  56,  67,  78,  89, 100, 111, 122,
+        133, 144, 155, 166, 177, 188, 199, 210, 221, 232, 243, 254,  10,  21,  32,  43,
+         54,  65,  76,  87,  98, 109, 120, 131, 142, 153, 164, 175, 186, 197, 208, 219,
+        230, 241, 252,   8,  19,  30,  41,  52,  63,  74,  85,  96, 107, 118, 129, 140,
+        151, 162, 173, 184, 195, 206, 217, 228, 239, 250,   6,  17,  28,  39,  50,  61,
+         72,  83,  94, 105, 116, 127, 138, 149, 160, 171, 182, 193, 204, 215, 226, 237,
+        248,   4,  15,  26,  37,  48,  59,  70,  81,  92, 103, 114, 125, 136, 147, 158,
+        169, 180, 191, 202, 213, 224, 235, 246,   2,  13,  24,  35,  46,  57,  68,  79,
+         90, 101, 112, 123, 134, 145, 156, 167, 178, 189, 200, 211, 222, 233, 244,
+    },
+    {
+        255,  12,  24,  36,  48,  60,  72,  84,  96, 108, 120, 132, 144, 156, 168, 180,
+        192, 204, 216, 228, 240, 252,   9,  21,  33,  45,  57,  69,  81,  93, 105, 117,
+        129, 141, 153, 165, 177, 189, 201, 213, 225, 237, 249,   6,  18,  30,  42,  54,
+         66,  78,  90, 102, 114, 126, 138, 150, 162, 174, 186, 198, 210, 222, 234, 246,
+          3,  15,  27,  39,  51,  63,  75,  87,  99, 111, 123, 135, 147, 159, 171, 183,
+        195, 207, 219, 231, 243, 255,  12,  24,  36,  48,  60,  72,  84,  96, 108, 120,
+        132, 144, 156, 168, 180, 192, 204, 216, 228, 240, 252,   9,  21,  33,  45,  57,
+         69,  81,  93, 105, 117, 129, 141, 153, 165, 177, 189, 201, 213, 225, 237, 249,
+          6,  18,  30,  42,  54,  66,  78,  90, 102, 114, 126, 138, 150, 162, 174, 186,
+        198, 210, 222, 234, 246,   3,  15,  27,  39,  51,  63,  75,  87,  99, 111, 123,
+        135, 147, 159, 171, 183, 195, 207, 219, 231, 243, 255,  12,  24,  36,  48,  60,
+         72,  84,  96, 108, 120, 132, 144, 156, 168, 180, 192, 204, 216, 228, 240, 252,
+          9,  21,  33,  45,  57,  69,  81,  93, 105, 117, 129, 141, 153, 165, 177, 189,
+        201, 213, 225, 237, 249,   6,  18,  30,  42,  54,  66,  78,  90, 102, 114, 126,
+        138, 150, 162, 174, 186, 198, 210, 222, 234, 246,   3,  15,  27,  39,  51,  63,
+         75,  87,  99, 111, 123, 135, 147, 159, 171, 183, 195, 207, 219, 231, 243,
+    },
+    {
+        255,  13,  26,  39,  52,  65,  78,  91, 104, 117, 130, 143, 156, 169, 182, 195,
+        208, 221, 234, 247,   5,  18,  31,  44,  57,  70,  83,  96, 109, 122, 135, 148,
+        161, 174, 187, 200, 213, 226, 239, 252,  10,  23,  36,  49,  62,  75,  88, 101,
+        114, 127, 140, 153, 166, 179, 192, 205, 218, 231, 244,   2,  15,  28,  41,  54,
+         67,  80,  93, 106, 119, 132, 145, 158, 171, 184, 197, 210, 223, 236, 249,   7,
+         20,  33,  46,  59,  72,  85,  98, 111, 124, 137, 150, 163, 176, 189, 202, 215,
+        228, 241, 254,  12,  25,  38,  51,  64,  77,  90, 103, 116, 129, 142, 155, 168,
+        181, 194, 207, 220, 233, 246,   4,  17,  30,  43,  56,  69,  82,  95, 108, 121,
+        134, 147, 160, 173, 186, 199, 212, 225, 238, 251,   9,  22,  35,  48,  61,  74,
+         87, 100, 113, 126, 139, 152, 165, 178, 191, 204, 217, 230, 243,   1,  14,  27,
+         40,  53,  66,  79,  92, 105, 118, 131, 144, 157, 170, 183, 196, 209, 222, 235,
+        248,   6,  19,  32,  45,  58,  71,  84,  97, 110, 123, 136, 149, 162, 175, 188,
+        201, 214, 227, 240, 253,  11,  24,  37,  50,  63,  76,  89, 102, 115, 128, 141,
+        154, 167, 180, 193, 206, 219, 232, 245,   3,  16,  29,  42,  55,  68,  81,  94,
+        107, 120, 133, 146, 159, 172, 185, 198, 211, 224, 237, 250,   8,  21,  34,  47,
+         60,  73,  86,  99, 112, 125, 138, 151, 164, 177, 190, 203, 216, 229, 242,
+    },
+    {
+        255,  14,  28,  42,  56,  70,  84,  98, 112, 126, 140, 154, 168, 182, 196, 210,
+        224, 238, 252,  11,  25,  39,  53,  67,  81,  95, 109, 123, 137, 151, 165, 179,
+        193, 207, 221, 235, 249,   8,  22,  36,  50,  64,  78,  92, 106, 120, 134, 148,
+        162, 176, 190, 204, 218, 232, 246,   5,  19,  33,  47,  61,  75,  89, 103, 117,
+        131, 145, 159, 173, 187, 201, 215, 229, 243,   2,  16,  30,  44,  58,  72,  86,
+        100, 114, 128, 142, 156, 170, 184, 198, 212, 226, 240, 254,  13,  27,  41,  55,
+         69,  83,  97, 111, 125, 139, 153, 167, 181, 195, 209, 223, 237, 251,  10,  24,
+         38,  52,  66,  80,  94, 108, 122, 136, 150, 164, 178, 192, 206, 220, 234, 248,
+          7,  21,  35,  49,  63,  77,  91, 105, 119, 133, 147, 161, 175, 189, 203, 217,
+        231, 245,   4,  18,  32,  46,  60,  74,  88, 102, 116, 130, 144, 158, 172, 186,
+        200, 214, 228, 242,   1,  15,  29,  43,  57,  71,  85,  99, 113, 127, 141, 155,
+        169, 183, 197, 211, 225, 239, 253,  12,  26,  40,  54,  68,  82,  96, 110, 124,
+        138, 152, 166, 180, 194, 208, 222, 236, 250,   9,  23,  37,  51,  65,  79,  93,
+        107, 121, 135, 149, 163, 177, 191, 205, 219, 233, 247,   6,  20,  34,  48,  62,
+         76,  90, 104, 118, 132, 146, 160, 174, 188, 202, 216, 230, 244,   3,  17,  31,
+         45,  59,  73,  87, 101, 115, 129, 143, 157, 171, 185, 199, 213, 227, 241,
+    },
+    {
+        255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225,
+        240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210,
+        225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195,
+        210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180,
+        195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165,
+        180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150,
+        165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120, 135,
+        150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105, 120,
+        135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90, 105,
+        120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,  90,
+        105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,  75,
+         90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,  60,
+         75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,  45,
+         60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,  30,
+         45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240, 255,  15,
+         30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225, 240,
+    },
+    {
+        255,  16,  32,  48,  64,  80,  96, 112, 128, 144, 160, 176, 192, 208, 224, 240,
+          1,  17,  33,  49,  65,  81,  97, 113, 129, 145, 161, 177, 193, 209, 225, 241,
+          2,  18,  34,  50,  66,  82,  98, 114, 130, 146, 162, 178, 194, 210, 226, 242,
+          3,  19,  35,  51,  67,  83,  99, 115, 131, 147, 163, 179, 195, 211, 227, 243,
+          4,  20,  36,  52,  68,  84, 100, 116, 132, 148, 164, 180, 196, 212, 228, 244,
+          5,  21,  37,  53,  69,  85, 101, 117, 133, 149, 165, 181, 197, 213, 229, 245,
+          6,  22,  38,  54,  70,  86, 102, 118, 134, 150, 166, 182, 198, 214, 230, 246,
+          7,  23,  39,  55,  71,  87, 103, 119, 135, 151, 167, 183, 199, 215, 231, 247,
+          8,  24,  40,  56,  72,  88, 104, 120, 136, 152, 168, 184, 200, 216, 232, 248,
+          9,  25,  41,  57,  73,  89, 105, 121, 137, 153, 169, 185, 201, 217, 233, 249,
+         10,  26,  42,  58,  74,  90, 106, 122, 138, 154, 170, 186, 202, 218, 234, 250,
+         11,  27,  43,  59,  75,  91, 107, 123, 139, 155, 171, 187, 203, 219, 235, 251,
+         12,  28,  44,  60,  76,  92, 108, 124, 140, 156, 172, 188, 204, 220, 236, 252,
+         13,  29,  45,  61,  77,  93, 109, 125, 141, 157, 173, 189, 205, 221, 237, 253,
+         14,  30,  46,  62,  78,  94, 110, 126, 142, 158, 174, 190, 206, 222, 238, 254,
+         15,  31,  47,  63,  79,  95, 111, 127, 143, 159, 175, 191, 207, 223, 239,
+    },
+};
+
+static field_logarithm_t *const ccsds_255_239_generator_root_exp_rows[16] = {
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[0],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[1],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[2],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[3],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[4],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[5],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[6],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[7],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[8],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[9],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[10],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[11],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[12],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[13],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[14],
+    (field_logarithm_t *)ccsds_255_239_generator_root_exp[15],
+};
+
+static const field_logarithm_t ccsds_255_239_element_exp[256][16] = {
+    {
+          0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    },
+    {
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    },
+    {
+        255,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+    },
+    {
+        255,  99, 198,  42, 141, 240,  84, 183,  27, 126, 225,  69, 168,  12, 111, 210,
+    },
+    {
+        255,   2,   4,   6,   8,  10,  12,  14,  16,  18,  20,  22,  24,  26,  28,  30,
+    },
+    {
+        255, 198, 141,  84,  27, 225, 168, 111,  54, 252, 195, 138,  81,  24, 222, 165,
+    },
+    {
+        255, 100, 200,  45, 145, 245,  90, 190,  35, 135, 235,  80, 180,  25, 125, 225,
+    },
+    {
+        255, 106, 212,  63, 169,  20, 126, 232,  83, 189,  40, 146, 252, 103, 209,  60,
+    },
+    {
+        255,   3,   6,   9,  12,  15,  18,  21,  24,  27,  30,  33,  36,  39,  42,  45,
+    },
+    {
+        255, 205, 155, 105,  55,   5, 210, 160, 110,  60,  10, 215, 165, 115,  65,  15,
+    },
+    {
+        255, 199, 143,  87,  31, 230, 174, 118,  62,   6, 205, 149,  93,  37, 236, 180,
+    },
+    {
+        255, 188, 121,  54, 242, 175, 108,  41, 229, 162,  95,  28, 216, 149,  82,  15,
+    },
+    {
+        255, 101, 202,  48, 149, 250,  96, 197,  43, 144, 245,  91, 192,  38, 139, 240,
+    },
+    {
+        255, 126, 252, 123, 249, 120, 246, 117, 243, 114, 240, 111, 237, 108, 234, 105,
+    },
+    {
+        255, 107, 214,  66, 173,  25, 132, 239,  91, 198,  50, 157,   9, 116, 223,  75,
+    },
+    {
+        255,  42,  84, 126, 168, 210, 252,  39,  81, 123, 165, 207, 249,  36,  78, 120,
+    },
+    {
+        255,   4,   8,  12,  16,  20,  24,  28,  32,  36,  40,  44,  48,  52,  56,  60,
+    },
+    {
+        255, 141,  27, 168,  54, 195,  81, 222, 108, 249, 135,  21, 162,  48, 189,  75,
+    },
+    {
+        255, 206, 157, 108,  59,  10, 216, 167, 118,  69,  20, 226, 177, 128,  79,  30,
+    },
+    {
+        255,  78, 156, 234,  57, 135, 213,  36, 114, 192,  15,  93, 171, 249,  72, 150,
+    },
+    {
+        255, 200, 145,  90,  35, 235, 180, 125,  70,  15, 215, 160, 105,  50, 250, 195,
+    },
+    {
+        255, 212, 169, 126,  83,  40, 252, 209, 166, 123,  80,  37, 249, 206, 163, 120,
+    },
+    {
+        255, 189, 123,  57, 246, 180, 114,  48, 237, 171, 105,  39, 228, 162,  96,  30,
+    },
+    {
+        255, 225, 195, 165, 135, 105,  75,  45,  15, 240, 210, 180, 150, 120,  90,  60,
+    },
+    {
+        255, 102, 204,  51, 153, 255, 102, 204,  51, 153, 255, 102, 204,  51, 153, 255,
+    },
+    {
+        255, 221, 187, 153, 119,  85,  51,  17, 238, 204, 170, 136, 102,  68,  34, 255,
+    },
+    {
+        255, 127, 254, 126, 253, 125, 252, 124, 251, 123, 250, 122, 249, 121, 248, 120,
+    },
+    {
+        255,  49,  98, 147, 196, 245,  39,  88, 137, 186, 235,  29,  78, 127, 176, 225,
+    },
+    {
+        255, 108, 216,  69, 177,  30, 138, 246,  99, 207,  60, 168,  21, 129, 237,  90,
+    },
+    {
+        255,  32,  64,  96, 128, 160, 192, 224,   1,  33,  65,  97, 129, 161, 193, 225,
+    },
+    {
+        255,  43,  86, 129, 172, 215,   3,  46,  89, 132, 175, 218,   6,  49,  92, 135,
+    },
+    {
+        255, 243, 231, 219, 207, 195, 183, 171, 159, 147, 135, 123, 111,  99,  87,  75,
+    },
+    {
+        255,   5,  10,  15,  20,  25,  30,  35,  40,  45,  50,  55,  60,  65,  70,  75,
+    },
+    {
+        255,  87, 174,   6,  93, 180,  12,  99, 186,  18, 105, 192,  24, 111, 198,  30,
+    },
+    {
+        255, 142,  29, 171,  58, 200,  87, 229, 116,   3, 145,  32, 174,  61, 203,  90,
+    },
+    {
+        255, 232, 209, 186, 163, 140, 117,  94,  71,  48,  25,   2, 234, 211, 188, 165,
+    },
+    {
+        255, 207, 159, 111,  63,  15, 222, 174, 126,  78,  30, 237, 189, 141,  93,  45,
+    },
+    {
+        255, 172,  89,   6, 178,  95,  12, 184, 101,  18, 190, 107,  24, 196, 113,  30,
+    },
+    {
+        255,  79, 158, 237,  61, 140, 219,  43, 122, 201,  25, 104, 183,   7,  86, 165,
+    },
+    {
+        255, 131,   7, 138,  14, 145,  21, 152,  28, 159,  35, 166,  42, 173,  49, 180,
+    },
+    {
+        255, 201, 147,  93,  39, 240, 186, 132,  78,  24, 225, 171, 117,  63,   9, 210,
+    },
+    {
+        255, 217, 179, 141, 103,  65,  27, 244, 206, 168, 130,  92,  54,  16, 233, 195,
+    },
+    {
+        255, 213, 171, 129,  87,  45,   3, 216, 174, 132,  90,  48,   6, 219, 177, 135,
+    },
+    {
+        255,  65, 130, 195,   5,  70, 135, 200,  10,  75, 140, 205,  15,  80, 145, 210,
+    },
+    {
+        255, 190, 125,  60, 250, 185, 120,  55, 245, 180, 115,  50, 240, 175, 110,  45,
+    },
+    {
+        255, 148,  41, 189,  82, 230, 123,  16, 164,  57, 205,  98, 246, 139,  32, 180,
+    },
+    {
+        255, 226, 197, 168, 139, 110,  81,  52,  23, 249, 220, 191, 162, 133, 104,  75,
+    },
+    {
+        255, 180, 105,  30, 210, 135,  60, 240, 165,  90,  15, 195, 120,  45, 225, 150,
+    },
+    {
+        255, 103, 206,  54, 157,   5, 108, 211,  59, 162,  10, 113, 216,  64, 167,  15,
+    },
+    {
+        255,  39,  78, 117, 156, 195, 234,  18,  57,  96, 135, 174, 213, 252,  36,  75,
+    },
+    {
+        255, 222, 189, 156, 123,  90,  57,  24, 246, 213, 180, 147, 114,  81,  48,  15,
+    },
+    {
+        255, 240, 225, 210, 195, 180, 165, 150, 135, 120, 105,  90,  75,  60,  45,  30,
+    },
+    {
+        255, 128,   1, 129,   2, 130,   3, 131,   4, 132,   5, 133,   6, 134,   7, 135,
+    },
+    {
+        255, 177,  99,  21, 198, 120,  42, 219, 141,  63, 240, 162,  84,   6, 183, 105,
+    },
+    {
+        255,  50, 100, 150, 200, 250,  45,  95, 145, 195, 245,  40,  90, 140, 190, 240,
+    },
+    {
+        255,  53, 106, 159, 212,  10,  63, 116, 169, 222,  20,  73, 126, 179, 232,  30,
+    },
+    {
+        255, 109, 218,  72, 181,  35, 144, 253, 107, 216,  70, 179,  33, 142, 251, 105,
+    },
+    {
+        255,  69, 138, 207,  21,  90, 159, 228,  42, 111, 180, 249,  63, 132, 201,  15,
+    },
+    {
+        255,  33,  66,  99, 132, 165, 198, 231,   9,  42,  75, 108, 141, 174, 207, 240,
+    },
+    {
+        255,  18,  36,  54,  72,  90, 108, 126, 144, 162, 180, 198, 216, 234, 252,  15,
+    },
+    {
+        255,  44,  88, 132, 176, 220,   9,  53,  97, 141, 185, 229,  18,  62, 106, 150,
+    },
+    {
+        255,  13,  26,  39,  52,  65,  78,  91, 104, 117, 130, 143, 156, 169, 182, 195,
+    },
+    {
+        255, 244, 233, 222, 211, 200, 189, 178, 167, 156, 145, 134, 123, 112, 101,  90,
+    },
+    {
+        255,  56, 112, 168, 224,  25,  81, 137, 193, 249,  50, 106, 162, 218,  19,  75,
+    },
+    {
+        255,   6,  12,  18,  24,  30,  36,  42,  48,  54,  60,  66,  72,  78,  84,  90,
+    },
+    {
+        255, 155,  55, 210, 110,  10, 165,  65, 220, 120,  20, 175,  75, 230, 130,  30,
+    },
+    {
+        255,  88, 176,   9,  97, 185,  18, 106, 194,  27, 115, 203,  36, 124, 212,  45,
+    },
+    {
+        255,  26,  52,  78, 104, 130, 156, 182, 208, 234,   5,  31,  57,  83, 109, 135,
+    },
+    {
+        255, 143,  31, 174,  62, 205,  93, 236, 124,  12, 155,  43, 186,  74, 217, 105,
+    },
+    {
+        255, 121, 242, 108, 229,  95, 216,  82, 203,  69, 190,  56, 177,  43, 164,  30,
+    },
+    {
+        255, 233, 211, 189, 167, 145, 123, 101,  79,  57,  35,  13, 246, 224, 202, 180,
+    },
+    {
+        255, 112, 224,  81, 193,  50, 162,  19, 131, 243, 100, 212,  69, 181,  38, 150,
+    },
+    {
+        255, 208, 161, 114,  67,  20, 228, 181, 134,  87,  40, 248, 201, 154, 107,  60,
+    },
+    {
+        255, 194, 133,  72,  11, 205, 144,  83,  22, 216, 155,  94,  33, 227, 166, 105,
+    },
+    {
+        255, 173,  91,   9, 182, 100,  18, 191, 109,  27, 200, 118,  36, 209, 127,  45,
+    },
+    {
+        255, 168,  81, 249, 162,  75, 243, 156,  69, 237, 150,  63, 231, 144,  57, 225,
+    },
+    {
+        255,  80, 160, 240,  65, 145, 225,  50, 130, 210,  35, 115, 195,  20, 100, 180,
+    },
+    {
+        255, 117, 234,  96, 213,  75, 192,  54, 171,  33, 150,  12, 129, 246, 108, 225,
+    },
+    {
+        255, 132,   9, 141,  18, 150,  27, 159,  36, 168,  45, 177,  54, 186,  63, 195,
+    },
+    {
+        255,  72, 144, 216,  33, 105, 177, 249,  66, 138, 210,  27,  99, 171, 243,  60,
+    },
+    {
+        255, 202, 149,  96,  43, 245, 192, 139,  86,  33, 235, 182, 129,  76,  23, 225,
+    },
+    {
+        255, 252, 249, 246, 243, 240, 237, 234, 231, 228, 225, 222, 219, 216, 213, 210,
+    },
+    {
+        255, 218, 181, 144, 107,  70,  33, 251, 214, 177, 140, 103,  66,  29, 247, 210,
+    },
+    {
+        255, 138,  21, 159,  42, 180,  63, 201,  84, 222, 105, 243, 126,   9, 147,  30,
+    },
+    {
+        255, 214, 173, 132,  91,  50,   9, 223, 182, 141, 100,  59,  18, 232, 191, 150,
+    },
+    {
+        255,  84, 168, 252,  81, 165, 249,  78, 162, 246,  75, 159, 243,  72, 156, 240,
+    },
+    {
+        255,  66, 132, 198,   9,  75, 141, 207,  18,  84, 150, 216,  27,  93, 159, 225,
+    },
+    {
+        255,  36,  72, 108, 144, 180, 216, 252,  33,  69, 105, 141, 177, 213, 249,  30,
+    },
+    {
+        255, 191, 127,  63, 254, 190, 126,  62, 253, 189, 125,  61, 252, 188, 124,  60,
+    },
+    {
+        255, 152,  49, 201,  98, 250, 147,  44, 196,  93, 245, 142,  39, 191,  88, 240,
+    },
+    {
+        255, 149,  43, 192,  86, 235, 129,  23, 172,  66, 215, 109,   3, 152,  46, 195,
+    },
+    {
+        255, 249, 243, 237, 231, 225, 219, 213, 207, 201, 195, 189, 183, 177, 171, 165,
+    },
+    {
+        255, 227, 199, 171, 143, 115,  87,  59,  31,   3, 230, 202, 174, 146, 118,  90,
+    },
+    {
+        255,  94, 188,  27, 121, 215,  54, 148, 242,  81, 175,  14, 108, 202,  41, 135,
+    },
+    {
+        255, 181, 107,  33, 214, 140,  66, 247, 173,  99,  25, 206, 132,  58, 239, 165,
+    },
+    {
+        255,  21,  42,  63,  84, 105, 126, 147, 168, 189, 210, 231, 252,  18,  39,  60,
+    },
+    {
+        255, 104, 208,  57, 161,  10, 114, 218,  67, 171,  20, 124, 228,  77, 181,  30,
+    },
+    {
+        255,  97, 194,  36, 133, 230,  72, 169,  11, 108, 205,  47, 144, 241,  83, 180,
+    },
+    {
+        255,  40,  80, 120, 160, 200, 240,  25,  65, 105, 145, 185, 225,  10,  50,  90,
+    },
+    {
+        255, 186, 117,  48, 234, 165,  96,  27, 213, 144,  75,   6, 192, 123,  54, 240,
+    },
+    {
+        255, 223, 191, 159, 127,  95,  63,  31, 254, 222, 190, 158, 126,  94,  62,  30,
+    },
+    {
+        255,  76, 152, 228,  49, 125, 201,  22,  98, 174, 250,  71, 147, 223,  44, 120,
+    },
+    {
+        255, 241, 227, 213, 199, 185, 171, 157, 143, 129, 115, 101,  87,  73,  59,  45,
+    },
+    {
+        255,  47,  94, 141, 188, 235,  27,  74, 121, 168, 215,   7,  54, 101, 148, 195,
+    },
+    {
+        255, 129,   3, 132,   6, 135,   9, 138,  12, 141,  15, 144,  18, 147,  21, 150,
+    },
+    {
+        255, 230, 205, 180, 155, 130, 105,  80,  55,  30,   5, 235, 210, 185, 160, 135,
+    },
+    {
+        255, 178, 101,  24, 202, 125,  48, 226, 149,  72, 250, 173,  96,  19, 197, 120,
+    },
+    {
+        255,  63, 126, 189, 252,  60, 123, 186, 249,  57, 120, 183, 246,  54, 117, 180,
+    },
+    {
+        255,  51, 102, 153, 204, 255,  51, 102, 153, 204, 255,  51, 102, 153, 204, 255,
+    },
+    {
+        255, 238, 221, 204, 187, 170, 153, 136, 119, 102,  85,  68,  51,  34,  17, 255,
+    },
+    {
+        255,  54, 108, 162, 216,  15,  69, 123, 177, 231,  30,  84, 138, 192, 246,  45,
+    },
+    {
+        255,  16,  32,  48,  64,  80,  96, 112, 128, 144, 160, 176, 192, 208, 224, 240,
+    },
+    {
+        255, 110, 220,  75, 185,  40, 150,   5, 115, 225,  80, 190,  45, 155,  10, 120,
+    },
+    {
+        255,  24,  48,  72,  96, 120, 144, 168, 192, 216, 240,   9,  33,  57,  81, 105,
+    },
+    {
+        255,  70, 140, 210,  25,  95, 165, 235,  50, 120, 190,   5,  75, 145, 215,  30,
+    },
+    {
+        255, 166,  77, 243, 154,  65, 231, 142,  53, 219, 130,  41, 207, 118,  29, 195,
+    },
+    {
+        255,  34,  68, 102, 136, 170, 204, 238,  17,  51,  85, 119, 153, 187, 221, 255,
+    },
+    {
+        255, 136,  17, 153,  34, 170,  51, 187,  68, 204,  85, 221, 102, 238, 119, 255,
+    },
+    {
+        255,  19,  38,  57,  76,  95, 114, 133, 152, 171, 190, 209, 228, 247,  11,  30,
+    },
+    {
+        255, 247, 239, 231, 223, 215, 207, 199, 191, 183, 175, 167, 159, 151, 143, 135,
+    },
+    {
+        255,  45,  90, 135, 180, 225,  15,  60, 105, 150, 195, 240,  30,  75, 120, 165,
+    },
+    {
+        255, 184, 113,  42, 226, 155,  84,  13, 197, 126,  55, 239, 168,  97,  26, 210,
+    },
+    {
+        255,  14,  28,  42,  56,  70,  84,  98, 112, 126, 140, 154, 168, 182, 196, 210,
+    },
+    {
+        255,  61, 122, 183, 244,  50, 111, 172, 233,  39, 100, 161, 222,  28,  89, 150,
+    },
+    {
+        255, 245, 235, 225, 215, 205, 195, 185, 175, 165, 155, 145, 135, 125, 115, 105,
+    },
+    {
+        255, 164,  73, 237, 146,  55, 219, 128,  37, 201, 110,  19, 183,  92,   1, 165,
+    },
+    {
+        255,  57, 114, 171, 228,  30,  87, 144, 201,   3,  60, 117, 174, 231,  33,  90,
+    },
+    {
+        255,  59, 118, 177, 236,  40,  99, 158, 217,  21,  80, 139, 198,   2,  61, 120,
+    },
+    {
+        255,   7,  14,  21,  28,  35,  42,  49,  56,  63,  70,  77,  84,  91,  98, 105,
+    },
+    {
+        255, 158,  61, 219, 122,  25, 183,  86, 244, 147,  50, 208, 111,  14, 172,  75,
+    },
+    {
+        255, 156,  57, 213, 114,  15, 171,  72, 228, 129,  30, 186,  87, 243, 144,  45,
+    },
+    {
+        255, 157,  59, 216, 118,  20, 177,  79, 236, 138,  40, 197,  99,   1, 158,  60,
+    },
+    {
+        255,  89, 178,  12, 101, 190,  24, 113, 202,  36, 125, 214,  48, 137, 226,  60,
+    },
+    {
+        255, 159,  63, 222, 126,  30, 189,  93, 252, 156,  60, 219, 123,  27, 186,  90,
+    },
+    {
+        255,  27,  54,  81, 108, 135, 162, 189, 216, 243,  15,  42,  69,  96, 123, 150,
+    },
+    {
+        255,   8,  16,  24,  32,  40,  48,  56,  64,  72,  80,  88,  96, 104, 112, 120,
+    },
+    {
+        255, 144,  33, 177,  66, 210,  99, 243, 132,  21, 165,  54, 198,  87, 231, 120,
+    },
+    {
+        255,   9,  18,  27,  36,  45,  54,  63,  72,  81,  90,  99, 108, 117, 126, 135,
+    },
+    {
+        255, 122, 244, 111, 233, 100, 222,  89, 211,  78, 200,  67, 189,  56, 178,  45,
+    },
+    {
+        255,  28,  56,  84, 112, 140, 168, 196, 224, 252,  25,  53,  81, 109, 137, 165,
+    },
+    {
+        255, 234, 213, 192, 171, 150, 129, 108,  87,  66,  45,  24,   3, 237, 216, 195,
+    },
+    {
+        255, 160,  65, 225, 130,  35, 195, 100,   5, 165,  70, 230, 135,  40, 200, 105,
+    },
+    {
+        255, 113, 226,  84, 197,  55, 168,  26, 139, 252, 110, 223,  81, 194,  52, 165,
+    },
+    {
+        255,  90, 180,  15, 105, 195,  30, 120, 210,  45, 135, 225,  60, 150, 240,  75,
+    },
+    {
+        255, 209, 163, 117,  71,  25, 234, 188, 142,  96,  50,   4, 213, 167, 121,  75,
+    },
+    {
+        255,  29,  58,  87, 116, 145, 174, 203, 232,   6,  35,  64,  93, 122, 151, 180,
+    },
+    {
+        255, 195, 135,  75,  15, 210, 150,  90,  30, 225, 165, 105,  45, 240, 180, 120,
+    },
+    {
+        255, 123, 246, 114, 237, 105, 228,  96, 219,  87, 210,  78, 201,  69, 192,  60,
+    },
+    {
+        255, 174,  93,  12, 186, 105,  24, 198, 117,  36, 210, 129,  48, 222, 141,  60,
+    },
+    {
+        255,  10,  20,  30,  40,  50,  60,  70,  80,  90, 100, 110, 120, 130, 140, 150,
+    },
+    {
+        255, 169,  83, 252, 166,  80, 249, 163,  77, 246, 160,  74, 243, 157,  71, 240,
+    },
+    {
+        255, 145,  35, 180,  70, 215, 105, 250, 140,  30, 175,  65, 210, 100, 245, 135,
+    },
+    {
+        255,  81, 162, 243,  69, 150, 231,  57, 138, 219,  45, 126, 207,  33, 114, 195,
+    },
+    {
+        255,  91, 182,  18, 109, 200,  36, 127, 218,  54, 145, 236,  72, 163, 254,  90,
+    },
+    {
+        255, 118, 236,  99, 217,  80, 198,  61, 179,  42, 160,  23, 141,   4, 122, 240,
+    },
+    {
+        255, 114, 228,  87, 201,  60, 174,  33, 147,   6, 120, 234,  93, 207,  66, 180,
+    },
+    {
+        255, 133,  11, 144,  22, 155,  33, 166,  44, 177,  55, 188,  66, 199,  77, 210,
+    },
+    {
+        255, 161,  67, 228, 134,  40, 201, 107,  13, 174,  80, 241, 147,  53, 214, 120,
+    },
+    {
+        255,  73, 146, 219,  37, 110, 183,   1,  74, 147, 220,  38, 111, 184,   2,  75,
+    },
+    {
+        255, 235, 215, 195, 175, 155, 135, 115,  95,  75,  55,  35,  15, 250, 230, 210,
+    },
+    {
+        255, 203, 151,  99,  47, 250, 198, 146,  94,  42, 245, 193, 141,  89,  37, 240,
+    },
+    {
+        255, 124, 248, 117, 241, 110, 234, 103, 227,  96, 220,  89, 213,  82, 206,  75,
+    },
+    {
+        255, 253, 251, 249, 247, 245, 243, 241, 239, 237, 235, 233, 231, 229, 227, 225,
+    },
+    {
+        255, 196, 137,  78,  19, 215, 156,  97,  38, 234, 175, 116,  57, 253, 194, 135,
+    },
+    {
+        255, 219, 183, 147, 111,  75,  39,   3, 222, 186, 150, 114,  78,  42,   6, 225,
+    },
+    {
+        255,  30,  60,  90, 120, 150, 180, 210, 240,  15,  45,  75, 105, 135, 165, 195,
+    },
+    {
+        255, 139,  23, 162,  46, 185,  69, 208,  92, 231, 115, 254, 138,  22, 161,  45,
+    },
+    {
+        255, 210, 165, 120,  75,  30, 240, 195, 150, 105,  60,  15, 225, 180, 135,  90,
+    },
+    {
+        255, 215, 175, 135,  95,  55,  15, 230, 190, 150, 110,  70,  30, 245, 205, 165,
+    },
+    {
+        255, 146,  37, 183,  74, 220, 111,   2, 148,  39, 185,  76, 222, 113,   4, 150,
+    },
+    {
+        255,  85, 170, 255,  85, 170, 255,  85, 170, 255,  85, 170, 255,  85, 170, 255,
+    },
+    {
+        255, 170,  85, 255, 170,  85, 255, 170,  85, 255, 170,  85, 255, 170,  85, 255,
+    },
+    {
+        255,  67, 134, 201,  13,  80, 147, 214,  26,  93, 160, 227,  39, 106, 173, 240,
+    },
+    {
+        255,  11,  22,  33,  44,  55,  66,  77,  88,  99, 110, 121, 132, 143, 154, 165,
+    },
+    {
+        255,  37,  74, 111, 148, 185, 222,   4,  41,  78, 115, 152, 189, 226,   8,  45,
+    },
+    {
+        255, 175,  95,  15, 190, 110,  30, 205, 125,  45, 220, 140,  60, 235, 155,  75,
+    },
+    {
+        255, 192, 129,  66,   3, 195, 132,  69,   6, 198, 135,  72,   9, 201, 138,  75,
+    },
+    {
+        255, 115, 230,  90, 205,  65, 180,  40, 155,  15, 130, 245, 105, 220,  80, 195,
+    },
+    {
+        255, 153,  51, 204, 102, 255, 153,  51, 204, 102, 255, 153,  51, 204, 102, 255,
+    },
+    {
+        255, 119, 238, 102, 221,  85, 204,  68, 187,  51, 170,  34, 153,  17, 136, 255,
+    },
+    {
+        255, 150,  45, 195,  90, 240, 135,  30, 180,  75, 225, 120,  15, 165,  60, 210,
+    },
+    {
+        255,  92, 184,  21, 113, 205,  42, 134, 226,  63, 155, 247,  84, 176,  13, 105,
+    },
+    {
+        255, 250, 245, 240, 235, 230, 225, 220, 215, 210, 205, 200, 195, 190, 185, 180,
+    },
+    {
+        255,  82, 164, 246,  73, 155, 237,  64, 146, 228,  55, 137, 219,  46, 128, 210,
+    },
+    {
+        255, 228, 201, 174, 147, 120,  93,  66,  39,  12, 240, 213, 186, 159, 132, 105,
+    },
+    {
+        255, 236, 217, 198, 179, 160, 141, 122, 103,  84,  65,  46,  27,   8, 244, 225,
+    },
+    {
+        255,  95, 190,  30, 125, 220,  60, 155, 250,  90, 185,  25, 120, 215,  55, 150,
+    },
+    {
+        255,  74, 148, 222,  41, 115, 189,   8,  82, 156, 230,  49, 123, 197,  16,  90,
+    },
+    {
+        255, 182, 109,  36, 218, 145,  72, 254, 181, 108,  35, 217, 144,  71, 253, 180,
+    },
+    {
+        255, 162,  69, 231, 138,  45, 207, 114,  21, 183,  90, 252, 159,  66, 228, 135,
+    },
+    {
+        255,  22,  44,  66,  88, 110, 132, 154, 176, 198, 220, 242,   9,  31,  53,  75,
+    },
+    {
+        255, 134,  13, 147,  26, 160,  39, 173,  52, 186,  65, 199,  78, 212,  91, 225,
+    },
+    {
+        255, 105, 210,  60, 165,  15, 120, 225,  75, 180,  30, 135, 240,  90, 195,  45,
+    },
+    {
+        255, 197, 139,  81,  23, 220, 162, 104,  46, 243, 185, 127,  69,  11, 208, 150,
+    },
+    {
+        255,  98, 196,  39, 137, 235,  78, 176,  19, 117, 215,  58, 156, 254,  97, 195,
+    },
+    {
+        255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240,
+    },
+    {
+        255,  41,  82, 123, 164, 205, 246,  32,  73, 114, 155, 196, 237,  23,  64, 105,
+    },
+    {
+        255, 125, 250, 120, 245, 115, 240, 110, 235, 105, 230, 100, 225,  95, 220,  90,
+    },
+    {
+        255, 187, 119,  51, 238, 170, 102,  34, 221, 153,  85,  17, 204, 136,  68, 255,
+    },
+    {
+        255, 204, 153, 102,  51, 255, 204, 153, 102,  51, 255, 204, 153, 102,  51, 255,
+    },
+    {
+        255, 224, 193, 162, 131, 100,  69,  38,   7, 231, 200, 169, 138, 107,  76,  45,
+    },
+    {
+        255, 211, 167, 123,  79,  35, 246, 202, 158, 114,  70,  26, 237, 193, 149, 105,
+    },
+    {
+        255,  77, 154, 231,  53, 130, 207,  29, 106, 183,   5,  82, 159, 236,  58, 135,
+    },
+    {
+        255, 140,  25, 165,  50, 190,  75, 215, 100, 240, 125,  10, 150,  35, 175,  60,
+    },
+    {
+        255, 242, 229, 216, 203, 190, 177, 164, 151, 138, 125, 112,  99,  86,  73,  60,
+    },
+    {
+        255,  31,  62,  93, 124, 155, 186, 217, 248,  24,  55,  86, 117, 148, 179, 210,
+    },
+    {
+        255,  48,  96, 144, 192, 240,  33,  81, 129, 177, 225,  18,  66, 114, 162, 210,
+    },
+    {
+        255, 220, 185, 150, 115,  80,  45,  10, 230, 195, 160, 125,  90,  55,  20, 240,
+    },
+    {
+        255, 130,   5, 135,  10, 140,  15, 145,  20, 150,  25, 155,  30, 160,  35, 165,
+    },
+    {
+        255, 171,  87,   3, 174,  90,   6, 177,  93,   9, 180,  96,  12, 183,  99,  15,
+    },
+    {
+        255, 231, 207, 183, 159, 135, 111,  87,  63,  39,  15, 246, 222, 198, 174, 150,
+    },
+    {
+        255,  86, 172,   3,  89, 175,   6,  92, 178,   9,  95, 181,  12,  98, 184,  15,
+    },
+    {
+        255, 179, 103,  27, 206, 130,  54, 233, 157,  81,   5, 184, 108,  32, 211, 135,
+    },
+    {
+        255, 147,  39, 186,  78, 225, 117,   9, 156,  48, 195,  87, 234, 126,  18, 165,
+    },
+    {
+        255,  64, 128, 192,   1,  65, 129, 193,   2,  66, 130, 194,   3,  67, 131, 195,
+    },
+    {
+        255, 216, 177, 138,  99,  60,  21, 237, 198, 159, 120,  81,  42,   3, 219, 180,
+    },
+    {
+        255,  52, 104, 156, 208,   5,  57, 109, 161, 213,  10,  62, 114, 166, 218,  15,
+    },
+    {
+        255, 176,  97,  18, 194, 115,  36, 212, 133,  54, 230, 151,  72, 248, 169,  90,
+    },
+    {
+        255, 239, 223, 207, 191, 175, 159, 143, 127, 111,  95,  79,  63,  47,  31,  15,
+    },
+    {
+        255,  38,  76, 114, 152, 190, 228,  11,  49,  87, 125, 163, 201, 239,  22,  60,
+    },
+    {
+        255,  55, 110, 165, 220,  20,  75, 130, 185, 240,  40,  95, 150, 205,   5,  60,
+    },
+    {
+        255,  12,  24,  36,  48,  60,  72,  84,  96, 108, 120, 132, 144, 156, 168, 180,
+    },
+    {
+        255,  17,  34,  51,  68,  85, 102, 119, 136, 153, 170, 187, 204, 221, 238, 255,
+    },
+    {
+        255,  68, 136, 204,  17,  85, 153, 221,  34, 102, 170, 238,  51, 119, 187, 255,
+    },
+    {
+        255, 111, 222,  78, 189,  45, 156,  12, 123, 234,  90, 201,  57, 168,  24, 135,
+    },
+    {
+        255, 120, 240, 105, 225,  90, 210,  75, 195,  60, 180,  45, 165,  30, 150,  15,
+    },
+    {
+        255,  25,  50,  75, 100, 125, 150, 175, 200, 225, 250,  20,  45,  70,  95, 120,
+    },
+    {
+        255, 154,  53, 207, 106,   5, 159,  58, 212, 111,  10, 164,  63, 217, 116,  15,
+    },
+    {
+        255,  71, 142, 213,  29, 100, 171, 242,  58, 129, 200,  16,  87, 158, 229,  45,
+    },
+    {
+        255, 116, 232,  93, 209,  70, 186,  47, 163,  24, 140,   1, 117, 233,  94, 210,
+    },
+    {
+        255, 167,  79, 246, 158,  70, 237, 149,  61, 228, 140,  52, 219, 131,  43, 210,
+    },
+    {
+        255, 193, 131,  69,   7, 200, 138,  76,  14, 207, 145,  83,  21, 214, 152,  90,
+    },
+    {
+        255,  35,  70, 105, 140, 175, 210, 245,  25,  60,  95, 130, 165, 200, 235,  15,
+    },
+    {
+        255,  83, 166, 249,  77, 160, 243,  71, 154, 237,  65, 148, 231,  59, 142, 225,
+    },
+    {
+        255, 137,  19, 156,  38, 175,  57, 194,  76, 213,  95, 232, 114, 251, 133,  15,
+    },
+    {
+        255, 251, 247, 243, 239, 235, 231, 227, 223, 219, 215, 211, 207, 203, 199, 195,
+    },
+    {
+        255,  20,  40,  60,  80, 100, 120, 140, 160, 180, 200, 220, 240,   5,  25,  45,
+    },
+    {
+        255,  93, 186,  24, 117, 210,  48, 141, 234,  72, 165,   3,  96, 189,  27, 120,
+    },
+    {
+        255, 248, 241, 234, 227, 220, 213, 206, 199, 192, 185, 178, 171, 164, 157, 150,
+    },
+    {
+        255, 151,  47, 198,  94, 245, 141,  37, 188,  84, 235, 131,  27, 178,  74, 225,
+    },
+    {
+        255,  46,  92, 138, 184, 230,  21,  67, 113, 159, 205, 251,  42,  88, 134, 180,
+    },
+    {
+        255,  75, 150, 225,  45, 120, 195,  15,  90, 165, 240,  60, 135, 210,  30, 105,
+    },
+    {
+        255, 185, 115,  45, 230, 160,  90,  20, 205, 135,  65, 250, 180, 110,  40, 225,
+    },
+    {
+        255,  96, 192,  33, 129, 225,  66, 162,   3,  99, 195,  36, 132, 228,  69, 165,
+    },
+    {
+        255,  15,  30,  45,  60,  75,  90, 105, 120, 135, 150, 165, 180, 195, 210, 225,
+    },
+    {
+        255, 237, 219, 201, 183, 165, 147, 129, 111,  93,  75,  57,  39,  21,   3, 240,
+    },
+    {
+        255,  62, 124, 186, 248,  55, 117, 179, 241,  48, 110, 172, 234,  41, 103, 165,
+    },
+    {
+        255, 229, 203, 177, 151, 125,  99,  73,  47,  21, 250, 224, 198, 172, 146, 120,
+    },
+    {
+        255, 246, 237, 228, 219, 210, 201, 192, 183, 174, 165, 156, 147, 138, 129, 120,
+    },
+    {
+        255, 135,  15, 150,  30, 165,  45, 180,  60, 195,  75, 210,  90, 225, 105, 240,
+    },
+    {
+        255, 165,  75, 240, 150,  60, 225, 135,  45, 210, 120,  30, 195, 105,  15, 180,
+    },
+    {
+        255,  23,  46,  69,  92, 115, 138, 161, 184, 207, 230, 253,  21,  44,  67,  90,
+    },
+    {
+        255,  58, 116, 174, 232,  35,  93, 151, 209,  12,  70, 128, 186, 244,  47, 105,
+    },
+    {
+        255, 163,  71, 234, 142,  50, 213, 121,  29, 192, 100,   8, 171,  79, 242, 150,
+    },
+    {
+        255,  60, 120, 180, 240,  45, 105, 165, 225,  30,  90, 150, 210,  15,  75, 135,
+    },
+    {
+        255, 183, 111,  39, 222, 150,  78,   6, 189, 117,  45, 228, 156,  84,  12, 195,
+    },
+};
+
+static field_logarithm_t *const ccsds_255_239_element_exp_rows[256] = {
+    (field_logarithm_t *)ccsds_255_239_element_exp[0],
+    (field_logarithm_t *)ccsds_255_239_element_exp[1],
+    (field_logarithm_t *)ccsds_255_239_element_exp[2],
+    (field_logarithm_t *)ccsds_255_239_element_exp[3],
+    (field_logarithm_t *)ccsds_255_239_element_exp[4],
+    (field_logarithm_t *)ccsds_255_239_element_exp[5],
+    (field_logarithm_t *)ccsds_255_239_element_exp[6],
+    (field_logarithm_t *)ccsds_255_239_element_exp[7],
+    (field_logarithm_t *)ccsds_255_239_element_exp[8],
+    (field_logarithm_t *)ccsds_255_239_element_exp[9],
+    (field_logarithm_t *)ccsds_255_239_element_exp[10],
+    (field_logarithm_t *)ccsds_255_239_element_exp[11],
+    (field_logarithm_t *)ccsds_255_239_element_exp[12],
+    (field_logarithm_t *)ccsds_255_239_element_exp[13],
+    (field_logarithm_t *)ccsds_255_239_element_exp[14],
+    (field_logarithm_t *)ccsds_255_239_element_exp[15],
+    (field_logarithm_t *)ccsds_255_239_element_exp[16],
+    (field_logarithm_t *)ccsds_255_239_element_exp[17],
+    (field_logarithm_t *)ccsds_255_239_element_exp[18],
+    (field_logarithm_t *)ccsds_255_239_element_exp[19],
+    (field_logarithm_t *)ccsds_255_239_element_exp[20],
+    (field_logarithm_t *)ccsds_255_239_element_exp[21],
+    (field_logarithm_t *)ccsds_255_239_element_exp[22],
+    (field_logarithm_t *)ccsds_255_239_element_exp[23],
+    (field_logarithm_t *)ccsds_255_239_element_exp[24],
+    (field_logarithm_t *)ccsds_255_239_element_exp[25],
+    (field_logarithm_t *)ccsds_255_239_element_exp[26],
+    (field_logarithm_t *)ccsds_255_239_element_exp[27],
+    (field_logarithm_t *)ccsds_255_239_element_exp[28],
+    (field_logarithm_t *)ccsds_255_239_element_exp[29],
+    (field_logarithm_t *)ccsds_255_239_element_exp[30],
+    (field_logarithm_t *)ccsds_255_239_element_exp[31],
+    (field_logarithm_t *)ccsds_255_239_element_exp[32],
+    (field_logarithm_t *)ccsds_255_239_element_exp[33],
+    (field_logarithm_t *)ccsds_255_239_element_exp[34],
+    (field_logarithm_t *)ccsds_255_239_element_exp[35],
+    (field_logarithm_t *)ccsds_255_239_element_exp[36],
+    (field_logarithm_t *)ccsds_255_239_element_exp[37],
+    (field_logarithm_t *)ccsds_255_239_element_exp[38],
+    (field_logarithm_t *)ccsds_255_239_element_exp[39],
+    (field_logarithm_t *)ccsds_255_239_element_exp[40],
+    (field_logarithm_t *)ccsds_255_239_element_exp[41],
+    (field_logarithm_t *)ccsds_255_239_element_exp[42],
+    (field_logarithm_t *)ccsds_255_239_element_exp[43],
+    (field_logarithm_t *)ccsds_255_239_element_exp[44],
+    (field_logarithm_t *)ccsds_255_239_element_exp[45],
+    (field_logarithm_t *)ccsds_255_239_element_exp[46],
+    (field_logarithm_t *)ccsds_255_239_element_exp[47],
+    (field_logarithm_t *)ccsds_255_239_element_exp[48],
+    (field_logarithm_t *)ccsds_255_239_element_exp[49],
+    (field_logarithm_t *)ccsds_255_239_element_exp[50],
+    (field_logarithm_t *)ccsds_255_239_element_exp[51],
+    (field_logarithm_t *)ccsds_255_239_element_exp[52],
+    (field_logarithm_t *)ccsds_255_239_element_exp[53],
+    (field_logarithm_t *)ccsds_255_239_element_exp[54],
+    (field_logarithm_t *)ccsds_255_239_element_exp[55],
+    (field_logarithm_t *)ccsds_255_239_element_exp[56],
+    (field_logarithm_t *)ccsds_255_239_element_exp[57],
+    (field_logarithm_t *)ccsds_255_239_element_exp[58],
+    (field_logarithm_t *)ccsds_255_239_element_exp[59],
+    (field_logarithm_t *)ccsds_255_239_element_exp[60],
+    (field_logarithm_t *)ccsds_255_239_element_exp[61],
+    (field_logarithm_t *)ccsds_255_239_element_exp[62],
+    (field_logarithm_t *)ccsds_255_239_element_exp[63],
+    (field_logarithm_t *)ccsds_255_239_element_exp[64],
+    (field_logarithm_t *)ccsds_255_239_element_exp[65],
+    (field_logarithm_t *)ccsds_255_239_element_exp[66],
+    (field_logarithm_t *)ccsds_255_239_element_exp[67],
+    (field_logarithm_t *)ccsds_255_239_element_exp[68],
+    (field_logarithm_t *)ccsds_255_239_element_exp[69],
+    (field_logarithm_t *)ccsds_255_239_element_exp[70],
+    (field_logarithm_t *)ccsds_255_239_element_exp[71],
+    (field_logarithm_t *)ccsds_255_239_element_exp[72],
+    (field_logarithm_t *)ccsds_255_239_element_exp[73],
+    (field_logarithm_t *)ccsds_255_239_element_exp[74],
+    (field_logarithm_t *)ccsds_255_239_element_exp[75],
+    (field_logarithm_t *)ccsds_255_239_element_exp[76],
+    (field_logarithm_t *)ccsds_255_239_element_exp[77],
+    (field_logarithm_t *)ccsds_255_239_element_exp[78],
+    (field_logarithm_t *)ccsds_255_239_element_exp[79],
+    (field_logarithm_t *)ccsds_255_239_element_exp[80],
+    (field_logarithm_t *)ccsds_255_239_element_exp[81],
+    (field_logarithm_t *)ccsds_255_239_element_exp[82],
+    (field_logarithm_t *)ccsds_255_239_element_exp[83],
+    (field_logarithm_t *)ccsds_255_239_element_exp[84],
+    (field_logarithm_t *)ccsds_255_239_element_exp[85],
+    (field_logarithm_t *)ccsds_255_239_element_exp[86],
+    (field_logarithm_t *)ccsds_255_239_element_exp[87],
+    (field_logarithm_t *)ccsds_255_239_element_exp[88],
+    (field_logarithm_t *)ccsds_255_239_element_exp[89],
+    (field_logarithm_t *)ccsds_255_239_element_exp[90],
+    (field_logarithm_t *)ccsds_255_239_element_exp[91],
+    (field_logarithm_t *)ccsds_255_239_element_exp[92],
+    (field_logarithm_t *)ccsds_255_239_element_exp[93],
+    (field_logarithm_t *)ccsds_255_239_element_exp[94],
+    (field_logarithm_t *)ccsds_255_239_element_exp[95],
+    (field_logarithm_t *)ccsds_255_239_element_exp[96],
+    (field_logarithm_t *)ccsds_255_239_element_exp[97],
+    (field_logarithm_t *)ccsds_255_239_element_exp[98],
+    (field_logarithm_t *)ccsds_255_239_element_exp[99],
+    (field_logarithm_t *)ccsds_255_239_element_exp[100],
+    (field_logarithm_t *)ccsds_255_239_element_exp[101],
+    (field_logarithm_t *)ccsds_255_239_element_exp[102],
+    (field_logarithm_t *)ccsds_255_239_element_exp[103],
+    (field_logarithm_t *)ccsds_255_239_element_exp[104],
+    (field_logarithm_t *)ccsds_255_239_element_exp[105],
+    (field_logarithm_t *)ccsds_255_239_element_exp[106],
+    (field_logarithm_t *)ccsds_255_239_element_exp[107],
+    (field_logarithm_t *)ccsds_255_239_element_exp[108],
+    (field_logarithm_t *)ccsds_255_239_element_exp[109],
+    (field_logarithm_t *)ccsds_255_239_element_exp[110],
+    (field_logarithm_t *)ccsds_255_239_element_exp[111],
+    (field_logarithm_t *)ccsds_255_239_element_exp[112],
+    (field_logarithm_t *)ccsds_255_239_element_exp[113],
+    (field_logarithm_t *)ccsds_255_239_element_exp[114],
+    (field_logarithm_t *)ccsds_255_239_element_exp[115],
+    (field_logarithm_t *)ccsds_255_239_element_exp[116],
+    (field_logarithm_t *)ccsds_255_239_element_exp[117],
+    (field_logarithm_t *)ccsds_255_239_element_exp[118],
+    (field_logarithm_t *)ccsds_255_239_element_exp[119],
+    (field_logarithm_t *)ccsds_255_239_element_exp[120],
+    (field_logarithm_t *)ccsds_255_239_element_exp[121],
+    (field_logarithm_t *)ccsds_255_239_element_exp[122],
+    (field_logarithm_t *)ccsds_255_239_element_exp[123],
+    (field_logarithm_t *)ccsds_255_239_element_exp[124],
+    (field_logarithm_t *)ccsds_255_239_element_exp[125],
+    (field_logarithm_t *)ccsds_255_239_element_exp[126],
+    (field_logarithm_t *)ccsds_255_239_element_exp[127],
+    (field_logarithm_t *)ccsds_255_239_element_exp[128],
+    (field_logarithm_t *)ccsds_255_239_element_exp[129],
+    (field_logarithm_t *)ccsds_255_239_element_exp[130],
+    (field_logarithm_t *)ccsds_255_239_element_exp[131],
+    (field_logarithm_t *)ccsds_255_239_element_exp[132],
+    (field_logarithm_t *)ccsds_255_239_element_exp[133],
+    (field_logarithm_t *)ccsds_255_239_element_exp[134],
+    (field_logarithm_t *)ccsds_255_239_element_exp[135],
+    (field_logarithm_t *)ccsds_255_239_element_exp[136],
+    (field_logarithm_t *)ccsds_255_239_element_exp[137],
+    (field_logarithm_t *)ccsds_255_239_element_exp[138],
+    (field_logarithm_t *)ccsds_255_239_element_exp[139],
+    (field_logarithm_t *)ccsds_255_239_element_exp[140],
+    (field_logarithm_t *)ccsds_255_239_element_exp[141],
+    (field_logarithm_t *)ccsds_255_239_element_exp[142],
+    (field_logarithm_t *)ccsds_255_239_element_exp[143],
+    (field_logarithm_t *)ccsds_255_239_element_exp[144],
+    (field_logarithm_t *)ccsds_255_239_element_exp[145],
+    (field_logarithm_t *)ccsds_255_239_element_exp[146],
+    (field_logarithm_t *)ccsds_255_239_element_exp[147],
+    (field_logarithm_t *)ccsds_255_239_element_exp[148],
+    (field_logarithm_t *)ccsds_255_239_element_exp[149],
+    (field_logarithm_t *)ccsds_255_239_element_exp[150],
+    (field_logarithm_t *)ccsds_255_239_element_exp[151],
+    (field_logarithm_t *)ccsds_255_239_element_exp[152],
+    (field_logarithm_t *)ccsds_255_239_element_exp[153],
+    (field_logarithm_t *)ccsds_255_239_element_exp[154],
+    (field_logarithm_t *)ccsds_255_239_element_exp[155],
+    (field_logarithm_t *)ccsds_255_239_element_exp[156],
+    (field_logarithm_t *)ccsds_255_239_element_exp[157],
+    (field_logarithm_t *)ccsds_255_239_element_exp[158],
+    (field_logarithm_t *)ccsds_255_239_element_exp[159],
+    (field_logarithm_t *)ccsds_255_239_element_exp[160],
+    (field_logarithm_t *)ccsds_255_239_element_exp[161],
+    (field_logarithm_t *)ccsds_255_239_element_exp[162],
+    (field_logarithm_t *)ccsds_255_239_element_exp[163],
+    (field_logarithm_t *)ccsds_255_239_element_exp[164],
+    (field_logarithm_t *)ccsds_255_239_element_exp[165],
+    (field_logarithm_t *)ccsds_255_239_element_exp[166],
+    (field_logarithm_t *)ccsds_255_239_element_exp[167],
+    (field_logarithm_t *)ccsds_255_239_element_exp[168],
+    (field_logarithm_t *)ccsds_255_239_element_exp[169],
+    (field_logarithm_t *)ccsds_255_239_element_exp[170],
+    (field_logarithm_t *)ccsds_255_239_element_exp[171],
+    (field_logarithm_t *)ccsds_255_239_element_exp[172],
+    (field_logarithm_t *)ccsds_255_239_element_exp[173],
+    (field_logarithm_t *)ccsds_255_239_element_exp[174],
+    (field_logarithm_t *)ccsds_255_239_element_exp[175],
+    (field_logarithm_t *)ccsds_255_239_element_exp[176],
+    (field_logarithm_t *)ccsds_255_239_element_exp[177],
+    (field_logarithm_t *)ccsds_255_239_element_exp[178],
+    (field_logarithm_t *)ccsds_255_239_element_exp[179],
+    (field_logarithm_t *)ccsds_255_239_element_exp[180],
+    (field_logarithm_t *)ccsds_255_239_element_exp[181],
+    (field_logarithm_t *)ccsds_255_239_element_exp[182],
+    (field_logarithm_t *)ccsds_255_239_element_exp[183],
+    (field_logarithm_t *)ccsds_255_239_element_exp[184],
+    (field_logarithm_t *)ccsds_255_239_element_exp[185],
+    (field_logarithm_t *)ccsds_255_239_element_exp[186],
+    (field_logarithm_t *)ccsds_255_239_element_exp[187],
+    (field_logarithm_t *)ccsds_255_239_element_exp[188],
+    (field_logarithm_t *)ccsds_255_239_element_exp[189],
+    (field_logarithm_t *)ccsds_255_239_element_exp[190],
+    (field_logarithm_t *)ccsds_255_239_element_exp[191],
+    (field_logarithm_t *)ccsds_255_239_element_exp[192],
+    (field_logarithm_t *)ccsds_255_239_element_exp[193],
+    (field_logarithm_t *)ccsds_255_239_element_exp[194],
+    (field_logarithm_t *)ccsds_255_239_element_exp[195],
+    (field_logarithm_t *)ccsds_255_239_element_exp[196],
+    (field_logarithm_t *)ccsds_255_239_element_exp[197],
+    (field_logarithm_t *)ccsds_255_239_element_exp[198],
+    (field_logarithm_t *)ccsds_255_239_element_exp[199],
+    (field_logarithm_t *)ccsds_255_239_element_exp[200],
+    (field_logarithm_t *)ccsds_255_239_element_exp[201],
+    (field_logarithm_t *)ccsds_255_239_element_exp[202],
+    (field_logarithm_t *)ccsds_255_239_element_exp[203],
+    (field_logarithm_t *)ccsds_255_239_element_exp[204],
+    (field_logarithm_t *)ccsds_255_239_element_exp[205],
+    (field_logarithm_t *)ccsds_255_239_element_exp[206],
+    (field_logarithm_t *)ccsds_255_239_element_exp[207],
+    (field_logarithm_t *)ccsds_255_239_element_exp[208],
+    (field_logarithm_t *)ccsds_255_239_element_exp[209],
+    (field_logarithm_t *)ccsds_255_239_element_exp[210],
+    (field_logarithm_t *)ccsds_255_239_element_exp[211],
+    (field_logarithm_t *)ccsds_255_239_element_exp[212],
+    (field_logarithm_t *)ccsds_255_239_element_exp[213],
+    (field_logarithm_t *)ccsds_255_239_element_exp[214],
+    (field_logarithm_t *)ccsds_255_239_element_exp[215],
+    (field_logarithm_t *)ccsds_255_239_element_exp[216],
+    (field_logarithm_t *)ccsds_255_239_element_exp[217],
+    (field_logarithm_t *)ccsds_255_239_element_exp[218],
+    (field_logarithm_t *)ccsds_255_239_element_exp[219],
+    (field_logarithm_t *)ccsds_255_239_element_exp[220],
+    (field_logarithm_t *)ccsds_255_239_element_exp[221],
+    (field_logarithm_t *)ccsds_255_239_element_exp[222],
+    (field_logarithm_t *)ccsds_255_239_element_exp[223],
+    (field_logarithm_t *)ccsds_255_239_element_exp[224],
+    (field_logarithm_t *)ccsds_255_239_element_exp[225],
+    (field_logarithm_t *)ccsds_255_239_element_exp[226],
+    (field_logarithm_t *)ccsds_255_239_element_exp[227],
+    (field_logarithm_t *)ccsds_255_239_element_exp[228],
+    (field_logarithm_t *)ccsds_255_239_element_exp[229],
+    (field_logarithm_t *)ccsds_255_239_element_exp[230],
+    (field_logarithm_t *)ccsds_255_239_element_exp[231],
+    (field_logarithm_t *)ccsds_255_239_element_exp[232],
+    (field_logarithm_t *)ccsds_255_239_element_exp[233],
+    (field_logarithm_t *)ccsds_255_239_element_exp[234],
+    (field_logarithm_t *)ccsds_255_239_element_exp[235],
+    (field_logarithm_t *)ccsds_255_239_element_exp[236],
+    (field_logarithm_t *)ccsds_255_239_element_exp[237],
+    (field_logarithm_t *)ccsds_255_239_element_exp[238],
+    (field_logarithm_t *)ccsds_255_239_element_exp[239],
+    (field_logarithm_t *)ccsds_255_239_element_exp[240],
+    (field_logarithm_t *)ccsds_255_239_element_exp[241],
+    (field_logarithm_t *)ccsds_255_239_element_exp[242],
+    (field_logarithm_t *)ccsds_255_239_element_exp[243],
+    (field_logarithm_t *)ccsds_255_239_element_exp[244],
+    (field_logarithm_t *)ccsds_255_239_element_exp[245],
+    (field_logarithm_t *)ccsds_255_239_element_exp[246],
+    (field_logarithm_t *)ccsds_255_239_element_exp[247],
+    (field_logarithm_t *)ccsds_255_239_element_exp[248],
+    (field_logarithm_t *)ccsds_255_239_element_exp[249],
+    (field_logarithm_t *)ccsds_255_239_element_exp[250],
+    (field_logarithm_t *)ccsds_255_239_element_exp[251],
+    (field_logarithm_t *)ccsds_255_239_element_exp[252],
+    (field_logarithm_t *)ccsds_255_239_element_exp[253],
+    (field_logarithm_t *)ccsds_255_239_element_exp[254],
+    (field_logarithm_t *)ccsds_255_239_element_exp[255],
+};
+
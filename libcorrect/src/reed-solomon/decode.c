@@ -294,6 +294,10 @@ void correct_reed_solomon_decoder_create(correct_reed_solomon *rs) {
 
     rs->init_from_roots_scratch[0] = polynomial_create(rs->min_distance);
     rs->init_from_roots_scratch[1] = polynomial_create(rs->min_distance);
+
+    // erasure locator * error locator has order erasures + errors <= min_distance
+    rs->syndrome_copy = malloc(rs->min_distance * sizeof(field_element_t));
+    rs->full_error_locator = polynomial_create(rs->min_distance);
 }
 
 ssize_t correct_reed_solomon_decode(correct_reed_solomon *rs, const uint8_t *encoded, size_t encoded_length,
@@ -444,7 +448,7 @@ ssize_t correct_reed_solomon_decode_with_erasures(correct_reed_solomon *rs, cons
 
     reed_solomon_find_modified_syndromes(rs, rs->syndromes, rs->erasure_locator, rs->modified_syndromes);
 
-    field_element_t *syndrome_copy = malloc(rs->min_distance * sizeof(field_element_t));
+    field_element_t *syndrome_copy = rs->syndrome_copy;
     memcpy(syndrome_copy, rs->syndromes, rs->min_distance * sizeof(field_element_t));
 
     for (unsigned int i = erasure_length; i < rs->min_distance; i++) {
@@ -474,11 +478,11 @@ ssize_t correct_reed_solomon_decode_with_erasures(correct_reed_solomon *rs, cons
     if (!reed_solomon_factorize_error_locator(rs->field, erasure_length, rs->error_locator_log, rs->error_roots, rs->element_exp)) {
         // roots couldn't be found, so there were too many errors to deal with
         // RS has failed for this message
-        free(syndrome_copy);
         return -1;
     }
 
-    polynomial_t temp_poly = polynomial_create(rs->error_locator.order + erasure_length);
+    polynomial_t temp_poly = rs->full_error_locator;
+    temp_poly.order = rs->error_locator.order + erasure_length;
     polynomial_mul(rs->field, rs->erasure_locator, rs->error_locator, temp_poly);
     polynomial_t placeholder_poly = rs->error_locator;
     rs->error_locator = temp_poly;
@@ -501,8 +505,5 @@ ssize_t correct_reed_solomon_decode_with_erasures(correct_reed_solomon *rs, cons
         msg[i] = rs->received_polynomial.coeff[encoded_length - (i + 1)];
     }
 
-    polynomial_destroy(temp_poly);
-    free(syndrome_copy);
-
     return msg_length;
 }
@@ -35,6 +35,9 @@ correct_reed_solomon *correct_reed_solomon_create(field_operation_t primitive_po
 }
 
 void correct_reed_solomon_destroy(correct_reed_solomon *rs) {
+    if (rs->is_static) {
+        return;
+    }
     field_destroy(rs->field);
     polynomial_destroy(rs->generator);
     free(rs->generator_roots);
@@ -63,6 +66,8 @@ void correct_reed_solomon_destroy(correct_reed_solomon *rs) {
         free(rs->element_exp);
         polynomial_destroy(rs->init_from_roots_scratch[0]);
         polynomial_destroy(rs->init_from_roots_scratch[1]);
+        free(rs->syndrome_copy);
+        polynomial_destroy(rs->full_error_locator);
     }
     free(rs);
 }
@@ -0,0 +1,91 @@
+#include "correct/reed-solomon/reed-solomon.h"
+
+// (255, k) CCSDS instances with no setup cost
+// the tables are const and stay in flash on targets that execute in place,
+// only the scratch space takes ram (about 1.3k for 32 roots)
+#include "ccsds-255-223-tables.h"
+#include "ccsds-255-239-tables.h"
+#include "ccsds-255-191-tables.h"
+
+#define CCSDS_BLOCK_LENGTH 255
+
+// an instance named name with roots parity bytes, the tables are name_*
+//  encoder scratch: encoded_polynomial, encoded_remainder
+//  decoder scratch: the rest, sized as in correct_reed_solomon_decoder_create
+#define CCSDS_STATIC_RS(name, roots)                                                    \
+static field_element_t name##_encoded_polynomial[CCSDS_BLOCK_LENGTH];                   \
+static field_element_t name##_encoded_remainder[CCSDS_BLOCK_LENGTH];                    \
+static field_element_t name##_syndromes[roots];                                         \
+static field_element_t name##_modified_syndromes[2 * roots];                            \
+static field_element_t name##_received_polynomial[CCSDS_BLOCK_LENGTH];                  \
+static field_element_t name##_error_locator[roots + 1];                                 \
+static field_element_t name##_error_locator_log[roots + 1];                             \
+static field_element_t name##_erasure_locator[roots + 1];                               \
+static field_element_t name##_error_roots[2 * roots];                                   \
+static field_element_t name##_error_vals[roots];                                        \
+static field_logarithm_t name##_error_locations[roots];                                 \
+static field_element_t name##_last_error_locator[roots + 1];                            \
+static field_element_t name##_error_evaluator[roots];                                   \
+static field_element_t name##_error_locator_derivative[roots];                          \
+static field_element_t name##_init_from_roots_scratch[2][roots + 1];                    \
+static field_element_t name##_syndrome_copy[roots];                                     \
+static field_element_t name##_full_error_locator[roots + 1];                            \
+                                                                                        \
+static correct_reed_solomon name = {                                                    \
+    .block_length = CCSDS_BLOCK_LENGTH,                                                 \
+    .message_length = CCSDS_BLOCK_LENGTH - roots,                                       \
+    .min_distance = roots,                                                              \
+                                                                                        \
+    .first_consecutive_root = 1,                                                        \
+    .generator_root_gap = 1,                                                            \
+                                                                                        \
+    .field = {name##_exp, name##_log},                                                  \
+                                                                                        \
+    /* the tables are only ever read, the casts drop const to fit the struct */         \
+    .generator = {(field_element_t *)name##_generator, roots},                          \
+    .generator_roots = (field_element_t *)name##_generator_roots,                       \
+    .generator_root_exp = (field_logarithm_t **)name##_generator_root_exp_rows,         \
+                                                                                        \
+    .encoded_polynomial = {name##_encoded_polynomial, CCSDS_BLOCK_LENGTH - 1},          \
+    .encoded_remainder = {name##_encoded_remainder, CCSDS_BLOCK_LENGTH - 1},            \
+                                                                                        \
+    .syndromes = name##_syndromes,                                                      \
+    .modified_syndromes = name##_modified_syndromes,                                    \
+    .received_polynomial = {name##_received_polynomial, CCSDS_BLOCK_LENGTH - 1},        \
+    .error_locator = {name##_error_locator, roots},                                     \
+    .error_locator_log = {name##_error_locator_log, roots},                             \
+    .erasure_locator = {name##_erasure_locator, roots},                                 \
+    .error_roots = name##_error_roots,                                                  \
+    .error_vals = name##_error_vals,                                                    \
+    .error_locations = name##_error_locations,                                          \
+                                                                                        \
+    .element_exp = (field_logarithm_t **)name##_element_exp_rows,                       \
+                                                                                        \
+    .last_error_locator = {name##_last_error_locator, roots},                           \
+    .error_evaluator = {name##_error_evaluator, roots - 1},                             \
+    .error_locator_derivative = {name##_error_locator_derivative, roots - 1},           \
+    .init_from_roots_scratch = {{name##_init_from_roots_scratch[0], roots},             \
+                                {name##_init_from_roots_scratch[1], roots}},            \
+                                                                                        \
+    .syndrome_copy = name##_syndrome_copy,                                              \
+    .full_error_locator = {name##_full_error_locator, roots},                           \
+                                                                                        \
+    .has_init_decode = true,                                                            \
+    .is_static = true,                                                                  \
+};
+
+CCSDS_STATIC_RS(ccsds_255_223, 32)
+CCSDS_STATIC_RS(ccsds_255_239, 16)
+CCSDS_STATIC_RS(ccsds_255_191, 64)
+
+correct_reed_solomon *correct_reed_solomon_ccsds_255_223(void) {
+    return &ccsds_255_223;
+}
+
+correct_reed_solomon *correct_reed_solomon_ccsds_255_239(void) {
+    return &ccsds_255_239;
+}
+
+correct_reed_solomon *correct_reed_solomon_ccsds_255_191(void) {
+    return &ccsds_255_191;
+}
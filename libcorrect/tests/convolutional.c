@@ -128,6 +128,25 @@ int main() {
 
     printf("\n");
 
+    // the same code given by its output table
+    {
+        unsigned int table[1 << 7];
+        for (unsigned int i = 0; i < 1 << 7; i++) {
+            table[i] = 0;
+            for (unsigned int j = 0; j < 2; j++) {
+                if (__builtin_popcount(i & correct_conv_r12_7_polynomial[j]) % 2) {
+                    table[i] |= 1 << j;
+                }
+            }
+        }
+        conv = correct_convolutional_create_table(2, 7, table);
+        assert_test_result(conv, &testbench, 1000000, 2, 7, INFINITY, 0);
+        assert_test_result(conv, &testbench, 1000000, 2, 7, 4.5, 1e-05);
+        correct_convolutional_destroy(conv);
+    }
+
+    printf("\n");
+
     free_scratch(testbench);
     return 0;
 }
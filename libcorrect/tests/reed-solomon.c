@@ -66,9 +66,40 @@ int main() {
     run_tests(rs, testbench, block_length, message_length, min_distance / 4,
               min_distance / 2, 20000);
 
-    rs_testbench_destroy(testbench);
     correct_reed_solomon_destroy(rs);
 
+    // same code from the static instance, not to be destroyed
+    correct_reed_solomon *ccsds_rs = correct_reed_solomon_ccsds_255_223();
+
+    run_tests(ccsds_rs, testbench, block_length, message_length, 0, 0, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length / 2,
+              min_distance / 2, 0, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length,
+              min_distance / 2, 0, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length, 0,
+              min_distance, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length,
+              min_distance / 4, min_distance / 2, 20000);
+
+    rs_testbench_destroy(testbench);
+
+    min_distance = 64;
+    message_length = block_length - min_distance;
+    ccsds_rs = correct_reed_solomon_ccsds_255_191();
+    testbench = rs_testbench_create(block_length, min_distance);
+
+    run_tests(ccsds_rs, testbench, block_length, message_length / 2, 0, 0,
+              20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length, 0, 0, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length,
+              min_distance / 2, 0, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length, 0,
+              min_distance, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length,
+              min_distance / 4, min_distance / 2, 20000);
+
+    rs_testbench_destroy(testbench);
+
     min_distance = 16;
     message_length = block_length - min_distance;
     rs = correct_reed_solomon_create(
@@ -89,9 +120,22 @@ int main() {
               min_distance / 2, 20000);
     run_tests(rs, testbench, block_length, message_length, min_distance / 4,
               min_distance / 2, 20000);
+    correct_reed_solomon_destroy(rs);
+
+    // same code from the static instance
+    ccsds_rs = correct_reed_solomon_ccsds_255_239();
+
+    run_tests(ccsds_rs, testbench, block_length, message_length, 0, 0, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length / 2,
+              min_distance / 2, 0, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length,
+              min_distance / 2, 0, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length, 0,
+              min_distance, 20000);
+    run_tests(ccsds_rs, testbench, block_length, message_length,
+              min_distance / 4, min_distance / 2, 20000);
 
     rs_testbench_destroy(testbench);
-    correct_reed_solomon_destroy(rs);
 
     min_distance = 8;
     message_length = block_length - min_distance;
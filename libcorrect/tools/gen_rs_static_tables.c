@@ -0,0 +1,77 @@
+#include "correct/reed-solomon.h"
+
+// prints the tables of a (255, 255 - min_distance) CCSDS code as C source
+// the output is src/reed-solomon/ccsds-255-<k>-tables.h, used by static.c:
+//   rs_gen_static_tables 32 > src/reed-solomon/ccsds-255-223-tables.h
+//   rs_gen_static_tables 16 > src/reed-solomon/ccsds-255-239-tables.h
+//   rs_gen_static_tables 64 > src/reed-solomon/ccsds-255-191-tables.h
+
+void correct_reed_solomon_decoder_create(correct_reed_solomon *rs);
+
+static size_t min_distance = 32;
+static char prefix[32];
+
+static void print_row(const uint8_t *row, size_t length, const char *indent) {
+    for (size_t i = 0; i < length; i++) {
+        if (i % 16 == 0) {
+            printf("%s", indent);
+        }
+        printf("%3d,", row[i]);
+        printf((i % 16 == 15 || i == length - 1) ? "\n" : " ");
+    }
+}
+
+static void print_table(const char *type, const char *name, const uint8_t *table, size_t length) {
+    printf("static const %s %s_%s[%zu] = {\n", type, prefix, name, length);
+    print_row(table, length, "    ");
+    printf("};\n\n");
+}
+
+static void print_rows(const char *type, const char *name, field_logarithm_t **rows, size_t nrows,
+                       size_t length) {
+    printf("static const %s %s_%s[%zu][%zu] = {\n", type, prefix, name, nrows, length);
+    for (size_t i = 0; i < nrows; i++) {
+        printf("    {\n");
+        print_row(rows[i], length, "        ");
+        printf("    },\n");
+    }
+    printf("};\n\n");
+
+    // the decoder indexes these through row pointers
+    printf("static %s *const %s_%s_rows[%zu] = {\n", type, prefix, name, nrows);
+    for (size_t i = 0; i < nrows; i++) {
+        printf("    (%s *)%s_%s[%zu],\n", type, prefix, name, i);
+    }
+    printf("};\n\n");
+}
+
+int main(int argc, char **argv) {
+    if (argc > 1) {
+        min_distance = strtoul(argv[1], NULL, 10);
+    }
+    if (min_distance < 2 || min_distance > 128 || min_distance % 2) {
+        fprintf(stderr, "usage: %s [min_distance], even, 2..128\n", argv[0]);
+        return 1;
+    }
+    snprintf(prefix, sizeof(prefix), "ccsds_255_%zu", 255 - min_distance);
+
+    correct_reed_solomon *rs = correct_reed_solomon_create(
+        correct_rs_primitive_polynomial_ccsds, 1, 1, min_distance);
+    correct_reed_solomon_decoder_create(rs);
+
+    printf("// generated by tools/gen_rs_static_tables.c, do not edit\n");
+    printf("// (255, %zu) reed-solomon, ccsds primitive polynomial 0x%x, "
+           "first consecutive root 1, root gap 1\n\n",
+           255 - min_distance, correct_rs_primitive_polynomial_ccsds);
+
+    print_table("field_element_t", "exp", rs->field.exp, 512);
+    print_table("field_logarithm_t", "log", rs->field.log, 256);
+    print_table("field_element_t", "generator", rs->generator.coeff, rs->generator.order + 1);
+    print_table("field_element_t", "generator_roots", rs->generator_roots, rs->min_distance);
+    print_rows("field_logarithm_t", "generator_root_exp", rs->generator_root_exp, rs->min_distance,
+               rs->block_length);
+    print_rows("field_logarithm_t", "element_exp", rs->element_exp, 256, rs->min_distance);
+
+    correct_reed_solomon_destroy(rs);
+    return 0;
+}
@@ -0,0 +1,156 @@
+// Burst error resilience of the sector layouts and fec profiles.
+//
+// Sectors are recorded in each sector format and fec profile, then every
+// sector gets one burst at a random place in its data part: the level is
+// held for the burst length like in a dropout, or with -r the cells are
+// random. The tape is played back over an ideal channel and read by the
+// firmware's core1 reader, so erasure hints (RS_ERASURES) play along.
+//
+//   bench_burst [-n sectors] [-b LIST] [-p LIST] [-r] [-s seed]
+//
+// LIST is burst lengths in bit cells or fec profiles (fec_profile_t),
+// comma separated or first:last:step.
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
+
+#include "config.h"
+#include "firmware.h"
+#include "tapesim.h"
+
+static std::vector<int> parse_list(const char * arg)
+{
+    std::vector<int> values;
+    int first, last, step;
+    if (sscanf(arg, "%d:%d:%d", &first, &last, &step) == 3 && step > 0) {
+        for (int v = first; v <= last; v += step) {
+            values.push_back(v);
+        }
+        return values;
+    }
+    std::string s(arg);
+    for (size_t pos = 0; pos <= s.size(); ) {
+        size_t comma = s.find(',', pos);
+        if (comma == std::string::npos) comma = s.size();
+        values.push_back(atoi(s.substr(pos, comma - pos).c_str()));
+        pos = comma + 1;
+    }
+    return values;
+}
+
+static uint64_t rng;
+
+static uint32_t next_random()
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng >> 32;
+}
+
+static void set_cell(std::vector<uint32_t> & tape, size_t cell, uint32_t level)
+{
+    uint32_t & word = tape[cell / 32];
+    uint32_t bit = 1u << (31 - cell % 32);
+    word = level ? (word | bit) : (word & ~bit);
+}
+
+static uint32_t get_cell(const std::vector<uint32_t> & tape, size_t cell)
+{
+    return (tape[cell / 32] >> (31 - cell % 32)) & 1;
+}
+
+// one burst of burst_cells in the data part of every sector
+static void add_bursts(std::vector<uint32_t> & tape, int nsectors, uint8_t format,
+        uint8_t profile, int burst_cells, bool random)
+{
+    const size_t data_offset = SECTOR_LEADER_LEN + 1 + SECTOR_NUM_REPEATS
+        + DATA_LEADER_LEN + 1;
+    const size_t data_words = record_data_sz(format, profile) / 2;
+    const size_t words = data_offset + data_words + SECTOR_TRAILER_LEN;
+    const size_t data_cells = data_words * 32;
+
+    for (int n = 0; n < nsectors && burst_cells > 0; ++n) {
+        size_t first = (record_leader_words + n * words + data_offset) * 32
+            + next_random() % (data_cells - burst_cells);
+        uint32_t level = get_cell(tape, first - 1);
+        for (size_t i = first; i < first + burst_cells; ++i) {
+            set_cell(tape, i, random ? next_random() & 1 : level);
+        }
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    int nsectors = 64;
+    std::vector<int> bursts = { 0, 128, 256, 384, 512, 768, 1024, 1536, 2048 };
+    std::vector<int> profiles = { FEC_STANDARD, FEC_LIGHT, FEC_STRONG };
+    bool random = false;
+    uint64_t seed = 1;
+
+    int c;
+    while ((c = getopt(argc, argv, "n:b:p:rs:")) != -1) {
+        switch (c) {
+            case 'n': nsectors = atoi(optarg); break;
+            case 'b': bursts = parse_list(optarg); break;
+            case 'p': profiles = parse_list(optarg); break;
+            case 'r': random = true; break;
+            case 's': seed = strtoull(optarg, 0, 0); break;
+            default:
+                printf("usage: bench_burst [-n sectors] [-b LIST] [-p LIST] [-r] "
+                        "[-s seed]\n");
+                return 1;
+        }
+    }
+    for (int & profile : profiles) {
+        profile = std::min(std::max(profile, 0), FEC_PROFILE_COUNT - 1);
+    }
+
+    // sector formats only, track records are laid out differently
+    std::vector<uint32_t> recorded[SF_COUNT][FEC_PROFILE_COUNT];
+    for (uint8_t format = 0; format <= SF_INTERLEAVED; ++format) {
+        for (int profile : profiles) {
+            recorded[format][profile] = record_sectors(0, nsectors, format, profile);
+        }
+    }
+
+    printf("%d sectors, %s bursts, RS_ERASURES %d\n", nsectors,
+            random ? "random" : "dropout", RS_ERASURES);
+    printf("%17s", "");
+    for (int profile : profiles) {
+        printf(" %25s", (std::string(fec_profile_name(profile)) + ", "
+                    + std::to_string(record_data_sz(SF_LINEAR, profile)) + " bytes").c_str());
+    }
+    printf("\n%8s %8s", "cells", "bytes");
+    for (size_t i = 0; i < profiles.size(); ++i) {
+        printf(" %12s %12s", "linear", "interleaved");
+    }
+    printf("\n");
+
+    for (int burst : bursts) {
+        printf("%8d %8.1f", burst, burst / 16.0);
+        for (int profile : profiles) {
+            for (uint8_t format = 0; format <= SF_INTERLEAVED; ++format) {
+                rng = seed * 0x9e3779b97f4a7c15ull + burst;
+                std::vector<uint32_t> words = recorded[format][profile];
+                add_bursts(words, nsectors, format, profile, burst, random);
+
+                TapeChannel tape(tape_channel_ideal());
+                tape.record(words);
+                tape.rewind();
+                tape.make_current();
+
+                reader_stats_t st = run_reader(
+                        default_readloop_params(TapeChannel::word_sampler), 0);
+                printf(" %11.1f%%", 100.0 * (nsectors - st.done) / nsectors);
+            }
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
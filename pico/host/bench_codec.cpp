@@ -0,0 +1,11 @@
+// Modulation codec benchmark, the same one as the firmware runs on 'B'.
+//
+//   bench_codec
+
+#include "bench.h"
+
+int main()
+{
+    bench_modulation();
+    return 0;
+}
@@ -0,0 +1,158 @@
+// Net throughput of the fec profiles against density.
+//
+// Sectors are recorded once per fec profile, exactly as the firmware writes
+// them, then played back through TapeChannel at every mod_freq and read by
+// the firmware core1 reader. Prints net bytes per second of tape per
+// profile: a stronger code takes more tape per sector, the question is
+// whether it reads at a density high enough to make up for it.
+//
+// -m records with other modulations, one table each, to compare them in
+// one run; mod_freq stays the highest reversal frequency: rll(2,7) cells
+// go 1.5 times as fast, fm's half as fast, see modulation_cells().
+//
+//   bench_density -f 6000:16000:1000 -p 0,3 --noise 0.1
+//   bench_density -m 0,1,2 -f 4000:10000:1000
+//
+// Lists are comma separated or first:last:step.
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <getopt.h>
+
+#include "config.h"
+#include "firmware.h"
+#include "tapesim.h"
+
+static std::vector<double> parse_list(const char * arg)
+{
+    std::vector<double> values;
+    double first, last, step;
+    if (sscanf(arg, "%lf:%lf:%lf", &first, &last, &step) == 3 && step > 0) {
+        for (double v = first; v <= last + step * 1e-6; v += step) {
+            values.push_back(v);
+        }
+        return values;
+    }
+    std::string s(arg);
+    for (size_t pos = 0; pos <= s.size(); ) {
+        size_t comma = s.find(',', pos);
+        if (comma == std::string::npos) comma = s.size();
+        values.push_back(atof(s.substr(pos, comma - pos).c_str()));
+        pos = comma + 1;
+    }
+    return values;
+}
+
+static void usage()
+{
+    printf("usage: bench_density [options]\n"
+           "  -n N            sectors to record (16)\n"
+           "  -f LIST         mod_freq, Hz (6000:14000:1000)\n"
+           "  -p LIST         fec profiles, fec_profile_t (all)\n"
+           "  -m LIST         modulations, modulation_t (MODULATION)\n"
+           "  --ideal         start from a clean channel instead of the default\n"
+           "  --pw50 US       readback step width\n"
+           "  --jitter US     rms write jitter\n"
+           "  --noise FRAC    rms noise\n"
+           "  --dropouts N    per second, --dropout-ms MS\n"
+           "  --seed N\n");
+}
+
+int main(int argc, char ** argv)
+{
+    int nsectors = 16;
+    std::vector<double> freqs = parse_list("6000:14000:1000");
+    std::vector<double> profiles;
+    for (int p = 0; p < FEC_PROFILE_COUNT; ++p) {
+        profiles.push_back(p);
+    }
+    std::vector<double> modulations = { MODULATION };
+    tape_channel_params_t params = tape_channel_default();
+
+    enum { O_IDEAL = 256, O_PW50, O_JITTER, O_NOISE, O_DROPOUTS, O_DROPOUT_MS, O_SEED };
+    static const option longopts[] = {
+        { "ideal",      no_argument,        0, O_IDEAL },
+        { "pw50",       required_argument,  0, O_PW50 },
+        { "jitter",     required_argument,  0, O_JITTER },
+        { "noise",      required_argument,  0, O_NOISE },
+        { "dropouts",   required_argument,  0, O_DROPOUTS },
+        { "dropout-ms", required_argument,  0, O_DROPOUT_MS },
+        { "seed",       required_argument,  0, O_SEED },
+        { "help",       no_argument,        0, 'h' },
+        { 0, 0, 0, 0 }
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "n:f:p:m:h", longopts, 0)) != -1) {
+        switch (c) {
+            case 'n': nsectors = atoi(optarg); break;
+            case 'f': freqs = parse_list(optarg); break;
+            case 'p': profiles = parse_list(optarg); break;
+            case 'm': modulations = parse_list(optarg); break;
+            case O_IDEAL: params = tape_channel_ideal(); break;
+            case O_PW50: params.pw50_us = atof(optarg); break;
+            case O_JITTER: params.jitter_us = atof(optarg); break;
+            case O_NOISE: params.noise_rms = atof(optarg); break;
+            case O_DROPOUTS: params.dropouts_per_s = atof(optarg); break;
+            case O_DROPOUT_MS: params.dropout_ms = atof(optarg); break;
+            case O_SEED: params.seed = strtoull(optarg, 0, 0); break;
+            default: usage(); return c == 'h' ? 0 : 1;
+        }
+    }
+
+    for (double m : modulations) {
+        uint8_t modulation = (int)m % MOD_COUNT;
+
+        // one recording per profile
+        std::vector<TapeChannel> tapes;
+        for (double profile : profiles) {
+            tapes.emplace_back(params);
+            tapes.back().record(record_sectors(0, nsectors, SECTOR_FORMAT,
+                        (int)profile % FEC_PROFILE_COUNT, modulation));
+        }
+
+        printf("pw50 %.1fus jitter %.1fus wow %.2f%% flutter %.2f%% dc %.2f "
+               "noise %.2f dropouts %.2f/s x %.1fms, %d sectors, %s, %s\n",
+                params.pw50_us, params.jitter_us, params.wow_pct, params.flutter_pct,
+                params.dc_drift, params.noise_rms, params.dropouts_per_s,
+                params.dropout_ms, nsectors, sector_format_name(SECTOR_FORMAT),
+                modulation_name(modulation));
+        printf("%8s", "freq");
+        for (double profile : profiles) {
+            printf(" %22s", fec_profile_name((int)profile % FEC_PROFILE_COUNT));
+        }
+        printf("\n");
+
+        std::vector<double> best(profiles.size());
+        std::vector<int> best_freq(profiles.size());
+        for (double freq : freqs) {
+            // TapeChannel's cells go at twice its mod_freq
+            params.mod_freq = (int)freq * modulation_cells(modulation) / 2;
+            printf("%8d", (int)freq);
+            for (size_t i = 0; i < profiles.size(); ++i) {
+                TapeChannel & tape = tapes[i];
+                tape.set_params(params);
+                tape.make_current();
+                reader_stats_t st = run_reader(
+                        default_readloop_params(TapeChannel::word_sampler, modulation),
+                        nsectors, 1000000, 1, modulation);
+                double net = st.done * sector_user_data_sz / tape.tape_seconds();
+                printf("  %5d/%-3d %8.0f B/s", st.done, nsectors, net);
+                if (net > best[i]) {
+                    best[i] = net;
+                    best_freq[i] = (int)freq;
+                }
+            }
+            printf("\n");
+        }
+        printf("%8s", "best");
+        for (size_t i = 0; i < profiles.size(); ++i) {
+            printf("  %8.0f at %5d Hz", best[i], best_freq[i]);
+        }
+        printf("\n");
+    }
+
+    return 0;
+}
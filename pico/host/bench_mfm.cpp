@@ -0,0 +1,323 @@
+// MFM detectors: bit error rate versus density.
+//
+// Sectors are recorded as the firmware writes them, played back through
+// TapeChannel at every mod_freq, or read from a capture, and sampled by the
+// firmware's delay-locked loop with soft decisions on. A small reader finds
+// each sector's header and data sync and keeps its data words with their
+// soft decisions. These are demodulated three ways and compared bit by bit
+// with what was written:
+//   hard     mfm_decode_words(), clock cells dropped
+//   ml       mfmviterbi_decode_words() on hard cells
+//   ml soft  mfmviterbi_decode_words() with the soft decisions
+//
+//   bench_mfm -f 6000:12000:1000 --noise 0.15
+//   bench_mfm -c capture.txt -f 7000
+//
+// A capture is what readloop_dump_debugbuf() prints (the 'd' key after a
+// read) of sectors written by the firmware, -f is the MOD_FREQ it was
+// taken at. Lists are comma separated or first:last:step.
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+#include <getopt.h>
+
+#include "config.h"
+#include "firmware.h"
+#include "tapesim.h"
+#include "mfm.h"
+#include "modulation.h"
+#include "mfmviterbi.h"
+
+static std::vector<double> parse_list(const char * arg)
+{
+    std::vector<double> values;
+    double first, last, step;
+    if (sscanf(arg, "%lf:%lf:%lf", &first, &last, &step) == 3 && step > 0) {
+        for (double v = first; v <= last + step * 1e-6; v += step) {
+            values.push_back(v);
+        }
+        return values;
+    }
+    std::string s(arg);
+    for (size_t pos = 0; pos <= s.size(); ) {
+        size_t comma = s.find(',', pos);
+        if (comma == std::string::npos) comma = s.size();
+        values.push_back(atof(s.substr(pos, comma - pos).c_str()));
+        pos = comma + 1;
+    }
+    return values;
+}
+
+// a sector as the read loop saw it
+struct record_t {
+    int number;
+    uint8_t format;
+    uint8_t profile;
+    uint32_t sync;
+    std::vector<uint32_t> words;
+    std::vector<uint64_t> soft;
+};
+
+static std::vector<record_t> records;
+static record_t rec;
+static uint16_t headers[SECTOR_NUM_REPEATS];
+static size_t nheaders;
+static size_t resync_bits;
+
+static readloop_state_t capture_callback(readloop_state_t state, uint32_t bits, void *)
+{
+    switch (state) {
+        case TS_RESYNC_SECTOR:
+            if (bits == MfmModulation::sync_sector
+                    || ~bits == MfmModulation::sync_sector) {
+                nheaders = 0;
+                return TS_READ_SECTOR;
+            }
+            return state;
+        case TS_READ_SECTOR:
+            {
+                uint8_t b[2];
+                mfm_decode_words(&bits, 1, b);
+                headers[nheaders++] = b[0] << 8 | b[1];
+                if (nheaders < SECTOR_NUM_REPEATS) {
+                    return state;
+                }
+                // the most frequent one
+                int best = 0, votes = 0;
+                for (size_t i = 0; i < nheaders; ++i) {
+                    int v = std::count(headers, headers + nheaders, headers[i]);
+                    if (v > votes) {
+                        votes = v;
+                        best = headers[i];
+                    }
+                }
+                rec.number = best & 0xfff;
+                rec.format = (best >> 12) & 3;
+                rec.profile = (best >> 14) & 3;
+                if (rec.format >= SF_COUNT || rec.profile >= FEC_PROFILE_COUNT) {
+                    return TS_RESYNC_SECTOR;
+                }
+                resync_bits = 0;
+                return TS_RESYNC_DATA;
+            }
+        case TS_RESYNC_DATA:
+            // as SectorReader: a whole word in before a sync counts
+            if (++resync_bits < 32) {
+                return state;
+            }
+            if (bits == MfmModulation::sync_data
+                    || ~bits == MfmModulation::sync_data) {
+                rec.sync = bits;
+                rec.words.clear();
+                rec.soft.clear();
+                return TS_READ_DATA;
+            }
+            return resync_bits < 32 * (DATA_LEADER_LEN + 4) ? state : TS_RESYNC_SECTOR;
+        case TS_READ_DATA:
+            rec.words.push_back(bits);
+            rec.soft.push_back(readloop_soft_bits());
+            if (rec.words.size() < record_data_sz(rec.format, rec.profile) / 2) {
+                return state;
+            }
+            records.push_back(rec);
+            return TS_RESYNC_SECTOR;
+        default:
+            return state;
+    }
+}
+
+// data bytes of a sector as written, by number, format and profile
+static const std::vector<uint8_t> & written(int number, uint8_t format, uint8_t profile)
+{
+    static std::map<int, std::vector<uint8_t>> cache;
+    int key = number << 4 | format << 2 | profile;
+    auto it = cache.find(key);
+    if (it != cache.end()) {
+        return it->second;
+    }
+    const size_t data_offset = record_leader_words + SECTOR_LEADER_LEN + 1
+        + SECTOR_NUM_REPEATS + DATA_LEADER_LEN + 1;
+    std::vector<uint32_t> tape = record_sectors(number, 1, format, profile);
+    size_t words = record_data_sz(format, profile) / 2;
+    std::vector<uint8_t> bytes(words * 2);
+    mfm_decode_words(tape.data() + data_offset, words, bytes.data());
+    return cache[key] = bytes;
+}
+
+static size_t bit_errors(const uint8_t * a, const uint8_t * b, size_t len)
+{
+    size_t errors = 0;
+    for (size_t i = 0; i < len; ++i) {
+        errors += __builtin_popcount(a[i] ^ b[i]);
+    }
+    return errors;
+}
+
+// read samples from the hex dump of readloop_dump_debugbuf()
+static std::vector<uint32_t> load_capture(const char * path)
+{
+    std::vector<uint32_t> words;
+    FILE * f = fopen(path, "r");
+    if (!f) {
+        perror(path);
+        exit(1);
+    }
+    char line[256];
+    bool in = false;
+    uint32_t word = 0;
+    int nbytes = 0;
+    while (fgets(line, sizeof(line), f)) {
+        if (strstr(line, "debug sample begin")) {
+            in = true;
+            continue;
+        }
+        if (strstr(line, "debug sample end")) {
+            break;
+        }
+        if (!in) {
+            continue;
+        }
+        char * p = line;
+        char * end;
+        for (long v; (v = strtol(p, &end, 16)), end != p; p = end) {
+            word = word << 8 | (v & 0xff);
+            if (++nbytes == 4) {
+                words.push_back(word);
+                nbytes = 0;
+            }
+        }
+    }
+    fclose(f);
+    return words;
+}
+
+static std::vector<uint32_t> capture;
+static size_t capture_pos;
+
+static bool capture_sampler(uint32_t * word)
+{
+    if (capture_pos >= capture.size()) {
+        return false;
+    }
+    *word = capture[capture_pos++];
+    return true;
+}
+
+static void usage()
+{
+    printf("usage: bench_mfm [options]\n"
+           "  -n N            sectors to record (16)\n"
+           "  -f LIST         mod_freq, Hz (MOD_FREQ)\n"
+           "  -c FILE         read a capture instead, see readloop_dump_debugbuf()\n"
+           "  --ideal         start from a clean channel instead of the default\n"
+           "  --pw50 US       readback step width\n"
+           "  --jitter US     rms write jitter\n"
+           "  --noise FRAC    rms noise\n"
+           "  --seed N\n");
+}
+
+int main(int argc, char ** argv)
+{
+    int nsectors = 16;
+    std::vector<double> freqs = { MOD_FREQ };
+    const char * capture_path = 0;
+    tape_channel_params_t params = tape_channel_default();
+
+    enum { O_IDEAL = 256, O_PW50, O_JITTER, O_NOISE, O_SEED };
+    static const option longopts[] = {
+        { "ideal",      no_argument,        0, O_IDEAL },
+        { "pw50",       required_argument,  0, O_PW50 },
+        { "jitter",     required_argument,  0, O_JITTER },
+        { "noise",      required_argument,  0, O_NOISE },
+        { "seed",       required_argument,  0, O_SEED },
+        { "help",       no_argument,        0, 'h' },
+        { 0, 0, 0, 0 }
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "n:f:c:h", longopts, 0)) != -1) {
+        switch (c) {
+            case 'n': nsectors = atoi(optarg); break;
+            case 'f': freqs = parse_list(optarg); break;
+            case 'c': capture_path = optarg; break;
+            case O_IDEAL: params = tape_channel_ideal(); break;
+            case O_PW50: params.pw50_us = atof(optarg); break;
+            case O_JITTER: params.jitter_us = atof(optarg); break;
+            case O_NOISE: params.noise_rms = atof(optarg); break;
+            case O_SEED: params.seed = strtoull(optarg, 0, 0); break;
+            default: usage(); return c == 'h' ? 0 : 1;
+        }
+    }
+
+    TapeChannel tape(params);
+    if (capture_path) {
+        capture = load_capture(capture_path);
+        printf("%s: %zu samples\n", capture_path, capture.size() * 32);
+        freqs.resize(1);
+    }
+    else {
+        tape.record(record_sectors(0, nsectors));
+        tape.make_current();
+        for (int n = 0; n < nsectors; ++n) {
+            written(n, SECTOR_FORMAT, FEC_PROFILE);
+        }
+        printf("pw50 %.1fus jitter %.1fus wow %.2f%% flutter %.2f%% dc %.2f "
+               "noise %.2f dropouts %.2f/s x %.1fms\n",
+                params.pw50_us, params.jitter_us, params.wow_pct, params.flutter_pct,
+                params.dc_drift, params.noise_rms, params.dropouts_per_s,
+                params.dropout_ms);
+    }
+    printf("%8s %6s %9s %10s %10s %10s %8s %8s %8s\n", "freq", "read", "bits",
+            "hard", "ml", "ml_soft", "hard_s", "ml_s", "soft_s");
+
+    for (double freq : freqs) {
+        readloop_params_t rp;
+        records.clear();
+        if (capture_path) {
+            capture_pos = 0;
+            rp = default_readloop_params(capture_sampler);
+        }
+        else {
+            params.mod_freq = (int)freq;
+            tape.set_params(params);
+            rp = default_readloop_params(TapeChannel::word_sampler);
+        }
+        rp.soft = true;
+        readloop_setparams(rp);
+        readloop_delaylocked(capture_callback, 0);
+
+        // bit errors and sectors with any, each way
+        size_t bits = 0;
+        size_t errors[3] = {}, bad[3] = {};
+        std::vector<uint8_t> bytes;
+        for (const record_t & r : records) {
+            const std::vector<uint8_t> & truth = written(r.number, r.format, r.profile);
+            size_t count = r.words.size();
+            bytes.resize(count * 2);
+            bits += count * 16;
+            for (int way = 0; way < 3; ++way) {
+                if (way == 0) {
+                    mfm_decode_words(r.words.data(), count, bytes.data());
+                }
+                else {
+                    mfmviterbi_decode_words(r.words.data(), way == 2 ? r.soft.data() : 0,
+                            count, r.sync, bytes.data());
+                }
+                size_t e = bit_errors(bytes.data(), truth.data(), bytes.size());
+                errors[way] += e;
+                bad[way] += e != 0;
+            }
+        }
+        printf("%8d %6zu %9zu %10.2e %10.2e %10.2e %8zu %8zu %8zu\n", (int)freq,
+                records.size(), bits, bits ? (double)errors[0] / bits : 0,
+                bits ? (double)errors[1] / bits : 0, bits ? (double)errors[2] / bits : 0,
+                bad[0], bad[1], bad[2]);
+    }
+
+    return 0;
+}
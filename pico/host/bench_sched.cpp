@@ -0,0 +1,280 @@
+// Request scheduler on synthetic workloads.
+//
+// Requests are kept queue-depth deep and served by IoScheduler (iosched.h)
+// with different parameters, from plain first come first served to C-LOOK
+// with coalescing and the starvation bound. Tape time is estimated with the
+// same constants the seek planner starts from: play a sector, ff/rew speed,
+// mechanism switch. Every request must be served exactly once and none
+// may wait past the bound, or it exits with 1.
+//
+// Two checks go first: reads and writes of the same sectors served in the
+// pieces of io_piece_end() see what submit order says they should, and a
+// request far behind a stream of nearby ones is served within a small
+// starvation bound.
+//
+//   bench_sched [-n requests] [-d depth] [-t sectors] [-w writes%] [-b runs] [-s seed]
+//
+// -b is the starvation bound of the last policy, IOSCHED_MAX_WAIT by default.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <unistd.h>
+
+#include "config.h"
+#include "sectors.h"
+#include "iosched.h"
+
+static uint64_t rng;
+
+static uint32_t next_random()
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng >> 32;
+}
+
+struct workload_t {
+    const char * name;
+    int (*sector)(int tape_sectors);
+};
+
+static int uniform(int tape_sectors)
+{
+    return next_random() % tape_sectors;
+}
+
+// 80% of the requests go to the first 10% of the tape
+static int hotspot(int tape_sectors)
+{
+    int hot = tape_sectors / 10;
+    return next_random() % 5 ? next_random() % hot : hot + next_random() % (tape_sectors - hot);
+}
+
+// four files read or written front to back, requests interleaved
+static int streams(int tape_sectors)
+{
+    static int pos[4] = {-1, -1, -1, -1};
+    int i = next_random() % 4;
+    if (pos[i] < 0 || next_random() % 64 == 0) {
+        pos[i] = next_random() % tape_sectors;
+    }
+    pos[i] = (pos[i] + 1) % tape_sectors;
+    return pos[i];
+}
+
+// a few sectors, half of the requests writes: sectors are read and written
+// in the same run all the time. Served the way Bitstream::serve() does,
+// every read sees the last write submitted before it
+static bool check_order(int nrequests, int depth)
+{
+    const int tape_sectors = 8;
+    IoScheduler sched({IOSCHED_COALESCE_GAP, IOSCHED_MAX_RUN, 4});
+    std::vector<int> tape(tape_sectors, -1);       // id of the last write served
+    std::vector<int> written(tape_sectors, -1);    // ...submitted
+    std::vector<int> expected(nrequests, -1);
+    std::vector<io_dispatch_t> batch(IOSCHED_QUEUE_LEN);
+
+    int submitted = 0, head = 0, pieces = 0, wrong = 0;
+    while (submitted < nrequests || sched.pending() > 0) {
+        while (submitted < nrequests && sched.pending() < depth) {
+            io_request_t req = {(int)(next_random() % tape_sectors),
+                next_random() % 2 ? IO_WRITE : IO_READ, (uint32_t)submitted, 0, 0};
+            if (req.op == IO_WRITE) {
+                written[req.sector_num] = submitted;
+            }
+            else {
+                expected[submitted] = written[req.sector_num];
+            }
+            sched.submit(req);
+            ++submitted;
+        }
+
+        io_run_t run;
+        int n = sched.next(head, &run, batch.data());
+        head = run.last + 1;
+        for (int from = 0, to; from < n; from = to, ++pieces) {
+            to = io_piece_end(batch.data(), from, n);
+            for (int i = from; i < to; ++i) {
+                const io_request_t & r = batch[i].req;
+                if (r.op == IO_WRITE) {
+                    tape[r.sector_num] = r.id;
+                }
+            }
+            for (int i = from; i < to; ++i) {
+                const io_request_t & r = batch[i].req;
+                if (r.op == IO_READ && tape[r.sector_num] != expected[r.id]) {
+                    ++wrong;
+                }
+            }
+        }
+    }
+
+    const io_sched_stats_t & st = sched.stats();
+    printf("order: %d requests on %d sectors in %d runs, %d pieces, %d reads out of order\n",
+            nrequests, tape_sectors, (int)st.runs, pieces, wrong);
+    return wrong == 0;
+}
+
+// the head sweeps up a stream of requests that keep coming just ahead of
+// it, one request sits behind it: C-LOOK alone never goes back for it,
+// with the bound it is served after max_wait runs
+static bool check_starvation(int max_wait)
+{
+    IoScheduler sched({IOSCHED_COALESCE_GAP, IOSCHED_MAX_RUN, max_wait});
+    std::vector<io_dispatch_t> batch(IOSCHED_QUEUE_LEN);
+
+    const int victim = 0;
+    sched.submit({victim, IO_READ, 0, 0, 0});
+    int head = 100, served_after = -1;
+    for (int runs = 0; runs < 4 * max_wait + 4 && served_after < 0; ++runs) {
+        // far enough apart not to be coalesced
+        sched.submit({head + IOSCHED_COALESCE_GAP + 1, IO_READ, 1, 0, 0});
+        io_run_t run;
+        int n = sched.next(head, &run, batch.data());
+        head = run.last + 1;
+        for (int i = 0; i < n; ++i) {
+            if (batch[i].req.sector_num == victim) {
+                served_after = batch[i].wait;
+            }
+        }
+    }
+
+    printf("starvation: a request behind the head served after %d runs, bound %d\n",
+            served_after, max_wait);
+    return served_after >= 0 && served_after <= max_wait;
+}
+
+struct policy_t {
+    const char * name;
+    io_sched_params_t params;
+};
+
+// seconds to serve a run from head: the wheel stops after every run, going
+// to play and back to stop is about a second
+static double run_time(int head, const io_run_t & run)
+{
+    const double sector_s = sector_words * 32.0 / (2 * MOD_FREQ);
+    const double wind_sectors_s = (double)REEL_WIND_RATE / REEL_COUNTS_PER_SECTOR;
+    const double switch_s = REEL_SWITCH_MS / 1000.0;
+    const double play_stop_s = 1.0;
+
+    double t = (run.last - run.first + 1) * sector_s;
+    double play_through = play_stop_s + run.seek * sector_s;
+    double wind = switch_s + (std::abs(run.seek) + SEEK_LEAD_SECTORS) / wind_sectors_s
+        + SEEK_LEAD_SECTORS * sector_s;
+    if (run.seek >= 0 && play_through < wind) {
+        t += play_through;
+    }
+    else {
+        t += wind;
+    }
+    return t;
+}
+
+int main(int argc, char ** argv)
+{
+    int nrequests = 2000;
+    int depth = 16;
+    int tape_sectors = 1400;    // a C60
+    int write_pct = 30;
+    int max_wait = IOSCHED_MAX_WAIT;
+    uint64_t seed = 1;
+
+    int c;
+    while ((c = getopt(argc, argv, "n:d:t:w:b:s:")) != -1) {
+        switch (c) {
+            case 'n': nrequests = atoi(optarg); break;
+            case 'd': depth = atoi(optarg); break;
+            case 't': tape_sectors = atoi(optarg); break;
+            case 'w': write_pct = atoi(optarg); break;
+            case 'b': max_wait = atoi(optarg); break;
+            case 's': seed = strtoull(optarg, 0, 0); break;
+            default:
+                printf("usage: bench_sched [-n requests] [-d depth] [-t sectors] "
+                        "[-w writes%%] [-b runs] [-s seed]\n");
+                return 1;
+        }
+    }
+    if (depth > IOSCHED_QUEUE_LEN) {
+        depth = IOSCHED_QUEUE_LEN;
+    }
+
+    const workload_t workloads[] = {
+        {"uniform", uniform},
+        {"hotspot", hotspot},
+        {"streams", streams},
+    };
+    const policy_t policies[] = {
+        {"fcfs", {0, 1, 0}},
+        {"look", {0, 1, 1 << 30}},
+        {"look+coalesce", {IOSCHED_COALESCE_GAP, IOSCHED_MAX_RUN, 1 << 30}},
+        {"look+coal+bound", {IOSCHED_COALESCE_GAP, IOSCHED_MAX_RUN, max_wait}},
+    };
+
+    rng = seed * 0x9e3779b97f4a7c15ull + 1;
+    bool ok = check_order(nrequests, depth);
+    ok = check_starvation(4) && ok;
+
+    printf("%d requests, depth %d, %d sectors, %d%% writes\n", nrequests, depth,
+            tape_sectors, write_pct);
+    printf("%-8s %-16s %6s %7s %6s %8s %9s %9s %8s\n", "workload", "policy", "runs",
+            "req/run", "depth", "seek/req", "wait/max", "tape s", "req/min");
+
+    std::vector<io_dispatch_t> batch(IOSCHED_QUEUE_LEN);
+
+    for (const workload_t & w : workloads) {
+        for (const policy_t & p : policies) {
+            rng = seed * 0x9e3779b97f4a7c15ull + 1;
+            IoScheduler sched(p.params);
+            std::vector<int> served(nrequests, 0);
+
+            int submitted = 0;
+            int head = 0;
+            double tape_s = 0;
+            while (submitted < nrequests || sched.pending() > 0) {
+                while (submitted < nrequests && sched.pending() < depth) {
+                    io_request_t req = {
+                        w.sector(tape_sectors),
+                        (int)(next_random() % 100) < write_pct ? IO_WRITE : IO_READ,
+                        (uint32_t)submitted, 0, 0};
+                    sched.submit(req);
+                    ++submitted;
+                }
+
+                io_run_t run;
+                int n = sched.next(head, &run, batch.data());
+                tape_s += run_time(head, run);
+                head = run.last + 1;
+                for (int i = 0; i < n; ++i) {
+                    ++served[batch[i].req.id];
+                    if (batch[i].wait > p.params.max_wait + IOSCHED_QUEUE_LEN) {
+                        ok = false;
+                    }
+                }
+            }
+
+            for (int i = 0; i < nrequests; ++i) {
+                if (served[i] != 1) {
+                    printf("request %d served %d times\n", i, served[i]);
+                    ok = false;
+                }
+            }
+
+            const io_sched_stats_t & st = sched.stats();
+            printf("%-8s %-16s %6d %7.2f %6.1f %8.1f %5.1f/%-3d %9.0f %8.1f\n", w.name,
+                    p.name, (int)st.runs, (double)st.requests / st.runs,
+                    (double)st.depth_sum / st.requests,
+                    (double)st.seek_sum / st.requests,
+                    (double)st.wait_sum / st.requests, st.max_wait,
+                    tape_s, st.requests / tape_s * 60);
+        }
+    }
+
+    if (!ok) {
+        printf("FAILED\n");
+    }
+    return ok ? 0 : 1;
+}
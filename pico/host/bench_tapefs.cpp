@@ -0,0 +1,161 @@
+// tapefs extents under many small appends.
+//
+// tapefs_extend() is what tapefs_append() does to a file's extents and the
+// log head. Files are appended to with sizes that mostly leave the last
+// sector partly filled, so every append rewrites it; the sectors the
+// extents come out to are checked against a plain list of where each
+// sector of the file went.
+//
+//   one file      appends one after the other: the tail sector is right
+//                 behind the head and is rewritten in place, the file
+//                 must stay in a single extent however many appends
+//   two files     appends take turns, every one starts a new extent until
+//                 TAPEFS_MAX_EXTENTS, then the file is copied to the head
+//                 in one extent and goes on from there
+//   checkpoints   a checkpoint after every append, same as two files
+//
+// It exits with 1 if an extent is wrong, a file is copied that still had
+// an extent to spare or the single file is copied at all.
+//
+//   bench_tapefs [-n appends] [-s seed]
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <unistd.h>
+
+#include "sectors.h"
+#include "tapefs.h"
+
+constexpr size_t data_per_sector = sector_user_data_sz - sizeof(tapefs_header_t);
+
+static uint64_t rng;
+
+static uint32_t next_random()
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 7;
+    rng ^= rng << 17;
+    return rng >> 32;
+}
+
+struct sim_file_t {
+    tapefs_file_t f;
+    std::vector<int> where;     // sector of each data sector of the file
+    int moves;
+    size_t copied;              // sectors, by the moves
+};
+
+// the sectors the extents say
+static std::vector<int> extent_sectors(const tapefs_file_t & f)
+{
+    std::vector<int> sectors;
+    for (int i = 0; i < f.nextents; ++i) {
+        for (int n = 0; n < f.extents[i].count; ++n) {
+            sectors.push_back(f.extents[i].first + n);
+        }
+    }
+    return sectors;
+}
+
+// false if the extents are wrong, or the file was moved with an extent
+// left to spare
+static bool append(sim_file_t & s, int & head, size_t bytes)
+{
+    size_t tail = s.f.size % data_per_sector;
+    size_t count = (tail + bytes + data_per_sector - 1) / data_per_sector;
+    int extents = s.f.nextents;
+    int at = head;
+    size_t copies = tapefs_extend(&s.f, &at, count, tail != 0);
+
+    // the tail goes to the head again, only if it's right behind it the
+    // head steps back over it; a moved file is copied there first, all
+    // of it but the tail
+    int expected = head;
+    if (copies) {
+        if (extents != TAPEFS_MAX_EXTENTS || copies != s.f.size / data_per_sector) {
+            return false;
+        }
+        ++s.moves;
+        s.copied += copies;
+        for (size_t i = 0; i < copies; ++i) {
+            s.where[i] = expected++;
+        }
+    }
+    else if (tail) {
+        expected -= s.where.back() == head - 1 ? 1 : 0;
+    }
+    if (tail) {
+        s.where.pop_back();
+    }
+    for (size_t i = 0; i < count; ++i) {
+        s.where.push_back(expected + i);
+    }
+    head = expected + count;
+    s.f.size += bytes;
+    return at == expected && extent_sectors(s.f) == s.where;
+}
+
+static size_t random_size()
+{
+    return 1 + next_random() % (2 * data_per_sector);
+}
+
+static bool run(const char * name, int nfiles, int appends, int checkpoint_sectors)
+{
+    std::vector<sim_file_t> files(nfiles);
+    for (sim_file_t & s : files) {
+        s = sim_file_t{};
+    }
+    int head = 4, wrong = 0, moves = 0, extents = 0;
+    size_t copied = 0;
+    for (int i = 0; i < appends; ++i) {
+        if (!append(files[i % nfiles], head, random_size())) {
+            ++wrong;
+        }
+        head += checkpoint_sectors;
+    }
+    for (const sim_file_t & s : files) {
+        moves += s.moves;
+        copied += s.copied;
+        extents += s.f.nextents;
+    }
+    printf("%-12s %5d appends, %d files, %5d sectors, %3d extents, %4d moves copying %5d sectors, "
+            "%d wrong\n", name, appends, nfiles, head, extents, moves, (int)copied, wrong);
+
+    // one file written on its own doesn't need a second extent
+    return wrong == 0 && (nfiles > 1 || checkpoint_sectors > 0 || (extents == 1 && moves == 0));
+}
+
+int main(int argc, char ** argv)
+{
+    int appends = 4 * TAPEFS_MAX_EXTENTS;
+    uint64_t seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+        case 'n':
+            appends = atoi(optarg);
+            break;
+        case 's':
+            seed = strtoull(optarg, 0, 0);
+            break;
+        default:
+            fprintf(stderr, "usage: %s [-n appends] [-s seed]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    rng = seed * 0x9e3779b97f4a7c15ull + 1;
+    printf("%d bytes per sector, %d extents per file\n", (int)data_per_sector,
+            TAPEFS_MAX_EXTENTS);
+    bool ok = run("one file", 1, appends, 0);
+    ok = run("two files", 2, appends, 0) && ok;
+    ok = run("checkpoints", 1, appends, 1) && ok;
+
+    if (!ok) {
+        printf("FAILED\n");
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,188 @@
+// Receive path throughput on the host.
+//
+// Sectors are written by Bitstream::write_sector() into the tx fifo, looped
+// back as an ideal channel (MOD_HALFPERIOD samples per bit) into the rx fifo
+// and read by the firmware's own core1 reader running on a thread.
+// Reports decoded bytes per second and core1 time per sector.
+//
+//   bench_throughput [-b|-w|-x speed] [-t] [-p profile] [-c channels] [-m mod]
+//                    [nsectors]
+//
+// -b  prefilled rx fifo, one sample per word (RX_SAMPLES_PER_WORD 1)
+// -w  prefilled rx fifo, 32 packed samples per word
+// -x  rx fifo fed at speed x realtime and drained by dma into the ring
+//     (RX_DMA, the default, at 100x)
+// -t  SF_TRACK records instead of sectors, nsectors of them
+// -p  fec profile, fec_profile_t: 0 (255,223), 1 (255,239), 2 (255,191),
+//     3 (255,223) + convolutional
+// -c  head channels the sectors are striped over, dma ring only
+// -m  modulation, modulation_t: 0 mfm, 1 rll(2,7), 2 fm; tape time is at the cell
+//     clock of the modulation, see modulation_cells()
+
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <unistd.h>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hardware/pio.h"
+#include "hal_host.h"
+
+#include "config.h"
+#include "firmware.h"
+#include "rxring.h"
+
+// host cycles per nanosecond, 0 if unknown
+static double host_cycles_per_ns()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    uint64_t t0 = time_us_64();
+    uint64_t c0 = __rdtsc();
+    while (time_us_64() - t0 < 20000) {
+    }
+    uint64_t c1 = __rdtsc();
+    return (double)(c1 - c0) / ((time_us_64() - t0) * 1000.0);
+#else
+    return 0;
+#endif
+}
+
+int main(int argc, char ** argv)
+{
+    enum { FIFO_BITS, FIFO_WORDS, DMA } mode;
+    mode = RX_DMA ? DMA : RX_SAMPLES_PER_WORD == 32 ? FIFO_WORDS : FIFO_BITS;
+    double speed = 100;
+    uint8_t format = SECTOR_FORMAT;
+    uint8_t profile = FEC_PROFILE;
+    int channels = 1;
+    uint8_t modulation = MODULATION;
+
+    int c;
+    while ((c = getopt(argc, argv, "bwx:tp:c:m:")) != -1) {
+        switch (c) {
+            case 'b': mode = FIFO_BITS; break;
+            case 'w': mode = FIFO_WORDS; break;
+            case 'x': mode = DMA; speed = atof(optarg); break;
+            case 't': format = SF_TRACK; break;
+            case 'p': profile = atoi(optarg) % FEC_PROFILE_COUNT; break;
+            case 'c': channels = atoi(optarg); mode = DMA; break;
+            case 'm': modulation = atoi(optarg) % MOD_COUNT; break;
+            default:
+                printf("usage: bench_throughput [-b|-w|-x speed] [-t] [-p profile] "
+                        "[-c channels] [-m modulation] [nsectors]\n");
+                return 1;
+        }
+    }
+    int nsectors = optind < argc ? atoi(argv[optind]) : 32;
+
+    std::vector<std::vector<uint32_t>> tapes = record_channels(0, nsectors, format,
+            profile, channels, modulation);
+    channels = tapes.size();
+    const double cell_hz = (double)MOD_FREQ * modulation_cells(modulation);
+
+    // what the rx state machines push: one sample or 32 packed per word
+    size_t nsamples = tapes[0].size() * 32 * MOD_HALFPERIOD;
+    std::vector<std::vector<uint32_t>> rx_words(channels);
+    for (int ch = 0; ch < channels; ++ch) {
+        uint32_t packed = 0;
+        int npacked = 0;
+        for (uint32_t word : tapes[ch]) {
+            for (int i = 31; i >= 0; --i) {
+                for (int k = 0; k < MOD_HALFPERIOD; ++k) {
+                    uint32_t bit = (word >> i) & 1;
+                    if (mode == FIFO_BITS) {
+                        rx_words[ch].push_back(bit);
+                    }
+                    else {
+                        packed = (packed << 1) | bit;
+                        if (++npacked == 32) {
+                            rx_words[ch].push_back(packed);
+                            npacked = 0;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    reader_stats_t st;
+    if (mode == DMA) {
+        // rx state machine at speed x realtime into a hardware sized fifo,
+        // drained into the ring by dma. The host may have fewer cores than
+        // threads here, so the fifo waits for the dma instead of overflowing
+        // and only the ring can lose words
+        for (int ch = 0; ch < channels; ++ch) {
+            hal_pio_set_fifo_depth(channel_pio(ch), channel_sm_rx(ch), 0);
+            rxring_start(channel_pio(ch), channel_sm_rx(ch), ch, channels);
+        }
+        double word_us = 32e6 / (cell_hz * MOD_HALFPERIOD) / speed;
+        std::thread rx_sm([&] {
+            uint64_t t0 = time_us_64();
+            for (size_t i = 0; i < rx_words[0].size(); ++i) {
+                while (time_us_64() - t0 < i * word_us) {
+                    std::this_thread::yield();
+                }
+                for (int ch = 0; ch < channels; ++ch) {
+                    hal_pio_rx_push_blocking(channel_pio(ch), channel_sm_rx(ch),
+                            rx_words[ch][i]);
+                }
+            }
+        });
+        readloop_params_t params = default_readloop_params(rxring_get, modulation);
+        params.channel_sampler = rxring_get_channel;
+        st = run_reader(params, nsectors, 1000000, channels, modulation);
+        rx_sm.join();
+        rxring_stop();
+    }
+    else {
+        // the whole tape is prefilled into the rx fifo
+        hal_pio_set_fifo_depth(pio, sm_rx, rx_words[0].size());
+        for (uint32_t word : rx_words[0]) {
+            hal_pio_rx_push(pio, sm_rx, word);
+        }
+        st = run_reader(mode == FIFO_BITS
+                ? default_readloop_params(bitsampler_pio, modulation)
+                : default_readloop_params(bitsampler_pio_word, modulation), nsectors,
+                1000000, 1, modulation);
+    }
+
+    double wall_s = st.wall_us * 1e-6;
+    double tape_s = (double)nsamples / (cell_hz * MOD_HALFPERIOD);
+    double bytes = (double)st.done
+        * (format == SF_TRACK ? track_user_data_sz : sector_user_data_sz);
+    double sector_ns = nsectors ? (double)st.core1_ns / nsectors : 0;
+    double cycles_per_ns = host_cycles_per_ns();
+
+    static const char * mode_names[] = {
+        "fifo, 1 sample/word", "fifo, 32 samples/word", "dma ring"
+    };
+    printf("MOD_FREQ:          %d Hz, %s, %zu samples, %.1f s of tape, %s, "
+            "%d channel%s\n", MOD_FREQ, modulation_name(modulation), nsamples,
+            tape_s, mode_names[mode], channels, channels > 1 ? "s" : "");
+    printf("sectors:           %d found, %d read, %d errors of %d\n",
+            st.found, st.done, st.errors, nsectors);
+    printf("decoded:           %.0f bytes/s (%.1fx realtime)\n",
+            bytes / wall_s, tape_s / wall_s);
+    printf("net:               %.0f bytes per second of tape, %s, fec %s, "
+            "%zu bytes on tape each\n", bytes / tape_s,
+            format == SF_TRACK ? "track records" : "sectors", fec_profile_name(profile),
+            record_data_sz(format, profile));
+    printf("core1 per sector:  %.0f us", sector_ns * 1e-3);
+    if (cycles_per_ns > 0) {
+        printf(", %.0f host cycles", sector_ns * cycles_per_ns);
+    }
+    printf(", %.1f ns/sample\n", (double)st.core1_ns / nsamples);
+    if (mode == DMA) {
+        printf("rx:                fed at %.0fx realtime, %u fifo overflows, "
+                "%u ring overruns\n", speed, hal_pio_rx_overflows(pio, sm_rx),
+                st.rx_overruns);
+    }
+
+    return st.done == nsectors ? 0 : 1;
+}
@@ -0,0 +1,139 @@
+#include <array>
+
+#include "pico/stdlib.h"
+#include "pico/multicore.h"
+#include "hal_host.h"
+
+#include "config.h"
+#include "firmware.h"
+#include "rxring.h"
+
+const unsigned char * get_plaintext();
+size_t get_plaintext_size();
+
+Boost boost(GPIO_EBOOST);
+Motor motor(boost, GPIO_MOTOR_CONTROL);
+Solenoid solenoid(GPIO_SOLENOID_CONTROL);
+Wheel wheel(motor, solenoid, GPIO_MODE_ENTRY);
+Bitstream bstream(wheel, GPIO_RDHEAD, GPIO_WRHEAD, GPIO_WREN, GPIO_READ_LED,
+        GPIO_WRITE_LED);
+
+static sector_data_t sector_buf;
+static std::array<uint8_t, record_payload_max> decoded_buf;
+
+readloop_params_t default_readloop_params(readloop_bit_sampler_t sampler,
+        uint8_t modulation)
+{
+    readloop_params_t params = {
+        .bitwidth = MOD_HALFPERIOD,
+        .Kp = modulation_dll_kp(modulation),
+        .Ki = DLL_KI,
+        .alpha = DLL_ALPHA,
+        .sampler = sampler,
+        .phase_spike = DLL_PHASE_SPIKE,
+        .soft = DLL_SOFT,
+    };
+    return params;
+}
+
+readloop_params_t default_readloop_params(readloop_word_sampler_t sampler,
+        uint8_t modulation)
+{
+    readloop_params_t params = default_readloop_params((readloop_bit_sampler_t)0,
+            modulation);
+    params.word_sampler = sampler;
+    return params;
+}
+
+std::vector<std::vector<uint32_t>> record_channels(int first, int count,
+        uint8_t format, uint8_t profile, int channels, uint8_t modulation)
+{
+    bstream.set_format(format);
+    bstream.set_profile(profile);
+    bstream.set_channels(channels);
+    bstream.set_modulation(modulation);
+    channels = bstream.get_channels();
+    uint32_t leader = modulation_leader(bstream.get_modulation());
+    std::vector<std::vector<uint32_t>> tapes(channels,
+            std::vector<uint32_t>(record_leader_words, leader));
+
+    const uint8_t * text = get_plaintext();
+    size_t text_sz = get_plaintext_size();
+
+    // one sector or track record fits in the tx fifo
+    static_assert(record_words_max <= 4096, "tx fifo too small");
+    for (int ch = 0; ch < channels; ++ch) {
+        hal_pio_set_fifo_depth(channel_pio(ch), channel_sm_tx(ch), 4096);
+    }
+    bstream.init();
+    for (int ch = 0; ch < channels; ++ch) {
+        pio_sm_set_enabled(channel_pio(ch), channel_sm_tx(ch), true);
+    }
+
+    SectorWriter writer(sector_buf);
+    for (int n = first; n < first + count; ++n) {
+        size_t offset = (n * sector_user_data_sz) % text_sz;
+        bstream.write_sector(writer, n, text + offset, text_sz - offset);
+
+        for (int ch = 0; ch < channels; ++ch) {
+            uint32_t word;
+            while (hal_pio_tx_pop(channel_pio(ch), channel_sm_tx(ch), &word, 0)) {
+                tapes[ch].push_back(word);
+            }
+        }
+    }
+    for (auto & tape : tapes) {
+        tape.insert(tape.end(), record_leader_words, leader);
+    }
+
+    bstream.deinit();
+    for (int ch = 0; ch < channels; ++ch) {
+        hal_pio_set_fifo_depth(channel_pio(ch), channel_sm_tx(ch), 0);
+    }
+    bstream.set_channels(TAPE_CHANNELS);
+    bstream.set_modulation(MODULATION);
+
+    return tapes;
+}
+
+std::vector<uint32_t> record_sectors(int first, int count, uint8_t format,
+        uint8_t profile, uint8_t modulation)
+{
+    return record_channels(first, count, format, profile, 1, modulation)[0];
+}
+
+reader_stats_t run_reader(readloop_params_t params, int nsectors,
+        uint64_t timeout_us, int channels, uint8_t modulation)
+{
+    reader_stats_t stats = {};
+
+    readloop_setparams(params);
+
+    SectorReader reader(sector_buf, decoded_buf.begin(), channels, modulation);
+    core1_reader = &reader;
+
+    uint64_t t0 = time_us_64();
+    multicore_launch_core1(core1_entry);
+
+    uint32_t out;
+    while ((nsectors <= 0 || stats.done + stats.errors < nsectors)
+            && multicore_fifo_pop_timeout_us(timeout_us, &out)) {
+        if (out == TS_TERMINATE) {
+            break;
+        }
+        switch (out & 0xffff0000) {
+            case MSG_SECTOR_FOUND:      ++stats.found; break;
+            case MSG_SECTOR_READ_DONE:  ++stats.done; break;
+            case MSG_SECTOR_READ_ERROR: ++stats.errors; break;
+        }
+    }
+    stats.wall_us = time_us_64() - t0;
+    multicore_reset_core1();
+    stats.core1_ns = hal_core1_cpu_time_ns();
+    stats.rx_overruns = rxring_overruns();
+    stats.erasures = reader.erasures;
+    stats.erasure_blocks = reader.erasure_blocks;
+    stats.soft_blocks = reader.soft_blocks;
+
+    return stats;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+// firmware objects and internals for host programs
+
+#include <cstdint>
+#include <vector>
+
+#include "hardware/pio.h"
+#include "bitstream.h"
+#include "readloop.h"
+#include "sectors.h"
+
+// bitstream.cpp
+extern PIO pio;
+extern uint sm_tx, sm_rx;
+PIO channel_pio(int n);
+uint channel_sm_tx(int n);
+uint channel_sm_rx(int n);
+extern SectorReader * core1_reader;
+void core1_entry();
+uint32_t bitsampler_pio();
+bool bitsampler_pio_word(uint32_t * word);
+readloop_params_t bitstream_readloop_params(uint8_t modulation);
+
+// tapeshnik.cpp
+extern Bitstream bstream;
+
+// the default tuning from config.h, of the modulation
+readloop_params_t default_readloop_params(readloop_bit_sampler_t sampler,
+        uint8_t modulation = MODULATION);
+readloop_params_t default_readloop_params(readloop_word_sampler_t sampler,
+        uint8_t modulation = MODULATION);
+
+// words that Bitstream::write_sector() pushes into the tx fifo for
+// sectors first..first+count-1, after a short leader
+// payload is taken from plaintext.cpp
+constexpr size_t record_leader_words = 64;
+std::vector<uint32_t> record_sectors(int first, int count,
+        uint8_t format = SECTOR_FORMAT, uint8_t profile = FEC_PROFILE,
+        uint8_t modulation = MODULATION);
+
+// the same striped over head channels, the words of each channel's tx fifo
+std::vector<std::vector<uint32_t>> record_channels(int first, int count,
+        uint8_t format, uint8_t profile, int channels,
+        uint8_t modulation = MODULATION);
+
+struct reader_stats_t {
+    int found;
+    int done;
+    int errors;
+    uint64_t wall_us;
+    uint64_t core1_ns;
+    uint32_t rx_overruns;   // rxring_overruns()
+    uint32_t erasures;      // SectorReader::erasures
+    uint32_t erasure_blocks;
+    uint32_t soft_blocks;
+};
+
+// run the firmware core1 reader until it terminates, nsectors are read
+// (if > 0) or nothing arrives for timeout_us; with channels > 1 the words
+// come from params.channel_sampler; modulation as recorded
+reader_stats_t run_reader(readloop_params_t params, int nsectors,
+        uint64_t timeout_us = 1000000, int channels = 1,
+        uint8_t modulation = MODULATION);
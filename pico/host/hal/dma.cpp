@@ -0,0 +1,376 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+#include "hardware/dma.h"
+#include "hal_host.h"
+#include "hal_internal.h"
+
+dma_hw_t hal_dma_hw = {};
+
+struct hal_dma_channel_t {
+    bool claimed = false;
+    dma_channel_config config = {};
+    uintptr_t read_addr = 0;
+    uintptr_t write_addr = 0;
+    uint32_t reload = 0;            // TRANS_COUNT as written
+    bool busy = false;
+    bool irq_enabled[2] = {};
+    bool irq_status[2] = {};
+};
+
+// the engine runs channel transfers and "interrupt handlers" with the
+// lock held, handlers may call back into the dma api
+// never destroyed, the engine may still be waiting at exit
+static std::recursive_mutex & dma_mutex = *new std::recursive_mutex;
+static std::condition_variable_any & dma_cv = *new std::condition_variable_any;
+static hal_dma_channel_t channels[NUM_DMA_CHANNELS];
+static std::thread engine_thread;
+
+static void trigger(uint ch)
+{
+    hal_dma_channel_t & c = channels[ch];
+    if (!c.config.enable) {
+        return;
+    }
+    c.busy = c.reload != 0;
+    dma_hw->ch[ch].transfer_count = c.reload;
+    dma_cv.notify_one();
+}
+
+static uintptr_t advance(uintptr_t addr, bool incr, bool ring, uint ring_bits,
+        size_t size)
+{
+    if (!incr) {
+        return addr;
+    }
+    if (ring && ring_bits) {
+        uintptr_t mask = ((uintptr_t)1 << ring_bits) - 1;
+        return (addr & ~mask) | ((addr + size) & mask);
+    }
+    return addr + size;
+}
+
+// one transfer, false if a pio fifo on either side is not ready
+static bool transfer(hal_dma_channel_t & c)
+{
+    size_t size = 1u << c.config.size;
+    volatile void * src = (volatile void *)c.read_addr;
+    volatile void * dst = (volatile void *)c.write_addr;
+
+    uint32_t word = 0;
+    bool ready = true;
+    if (!hal_pio_dma_read(src, word, ready)) {
+        memcpy(&word, (const void *)src, size);
+    }
+    if (!ready) {
+        return false;
+    }
+    if (hal_pio_dma_write(dst, word, ready)) {
+        if (!ready) {
+            // the word is already popped, real dma would not have read it:
+            // this can only happen fifo to fifo, which nobody does
+            return false;
+        }
+    }
+    else {
+        memcpy((void *)dst, &word, size);
+    }
+
+    c.read_addr = advance(c.read_addr, c.config.read_increment,
+            !c.config.ring_write, c.config.ring_size_bits, size);
+    c.write_addr = advance(c.write_addr, c.config.write_increment,
+            c.config.ring_write, c.config.ring_size_bits, size);
+    return true;
+}
+
+static void complete(uint ch)
+{
+    hal_dma_channel_t & c = channels[ch];
+    c.busy = false;
+
+    if (!c.config.irq_quiet) {
+        for (int line = 0; line < 2; ++line) {
+            if (c.irq_enabled[line]) {
+                c.irq_status[line] = true;
+                hal_irq_raise(line ? DMA_IRQ_1 : DMA_IRQ_0);
+            }
+        }
+    }
+    if (c.config.chain_to != ch) {
+        trigger(c.config.chain_to);
+    }
+}
+
+static void engine_entry()
+{
+    std::unique_lock<std::recursive_mutex> lock(dma_mutex);
+    for (;;) {
+        bool any_busy = false;
+        bool progress = false;
+        for (uint ch = 0; ch < NUM_DMA_CHANNELS; ++ch) {
+            hal_dma_channel_t & c = channels[ch];
+            // a burst at a time, so that the other channels get a go
+            for (int n = 0; n < 64 && c.busy; ++n) {
+                if (!transfer(c)) {
+                    break;
+                }
+                progress = true;
+                // data before count, the firmware polls transfer_count
+                std::atomic_thread_fence(std::memory_order_release);
+                uint32_t left = dma_hw->ch[ch].transfer_count - 1;
+                dma_hw->ch[ch].transfer_count = left;
+                if (left == 0) {
+                    complete(ch);
+                }
+            }
+        }
+        // completions may have chained to channels already passed
+        for (uint ch = 0; ch < NUM_DMA_CHANNELS; ++ch) {
+            any_busy |= channels[ch].busy;
+        }
+
+        if (!any_busy) {
+            dma_cv.wait(lock);
+        }
+        else {
+            // let the cpu side in; waiting for a dreq, a pio fifo is only
+            // a few words deep so keep polling without sleeping
+            lock.unlock();
+            if (!progress) {
+                std::this_thread::yield();
+            }
+            lock.lock();
+        }
+    }
+}
+
+static void start_engine()
+{
+    if (!engine_thread.joinable()) {
+        engine_thread = std::thread(engine_entry);
+        engine_thread.detach();
+    }
+}
+
+void dma_channel_claim(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].claimed = true;
+}
+
+int dma_claim_unused_channel(bool required)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ++ch) {
+        if (!channels[ch].claimed) {
+            channels[ch].claimed = true;
+            return ch;
+        }
+    }
+    if (required) {
+        fprintf(stderr, "dma_claim_unused_channel: no channels left\n");
+        abort();
+    }
+    return -1;
+}
+
+void dma_channel_unclaim(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].claimed = false;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+    dma_channel_config c = {};
+    c.enable = true;
+    c.size = DMA_SIZE_32;
+    c.read_increment = true;
+    c.write_increment = false;
+    c.dreq = DREQ_FORCE;
+    c.chain_to = channel;
+    return c;
+}
+
+dma_channel_config dma_get_channel_config(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    return channels[channel].config;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+    c->read_increment = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+    c->write_increment = incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+    c->dreq = dreq;
+}
+
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to)
+{
+    c->chain_to = chain_to;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c,
+        enum dma_channel_transfer_size size)
+{
+    c->size = size;
+}
+
+void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits)
+{
+    c->ring_write = write;
+    c->ring_size_bits = size_bits;
+}
+
+void channel_config_set_irq_quiet(dma_channel_config *c, bool irq_quiet)
+{
+    c->irq_quiet = irq_quiet;
+}
+
+void channel_config_set_enable(dma_channel_config *c, bool enable)
+{
+    c->enable = enable;
+}
+
+void dma_channel_set_config(uint channel, const dma_channel_config *config,
+        bool trigger_now)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].config = *config;
+    if (trigger_now) {
+        start_engine();
+        trigger(channel);
+    }
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr,
+        bool trigger_now)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].read_addr = (uintptr_t)read_addr;
+    dma_hw->ch[channel].read_addr = (uintptr_t)read_addr;
+    if (trigger_now) {
+        start_engine();
+        trigger(channel);
+    }
+}
+
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr,
+        bool trigger_now)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].write_addr = (uintptr_t)write_addr;
+    dma_hw->ch[channel].write_addr = (uintptr_t)write_addr;
+    if (trigger_now) {
+        start_engine();
+        trigger(channel);
+    }
+}
+
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count,
+        bool trigger_now)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].reload = trans_count;
+    if (trigger_now) {
+        start_engine();
+        trigger(channel);
+    }
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config,
+        volatile void *write_addr, const volatile void *read_addr,
+        uint transfer_count, bool trigger_now)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    dma_channel_set_read_addr(channel, read_addr, false);
+    dma_channel_set_write_addr(channel, write_addr, false);
+    dma_channel_set_trans_count(channel, transfer_count, false);
+    dma_channel_set_config(channel, config, trigger_now);
+}
+
+void dma_channel_start(uint channel)
+{
+    dma_start_channel_mask(1u << channel);
+}
+
+void dma_start_channel_mask(uint32_t chan_mask)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    start_engine();
+    for (uint ch = 0; ch < NUM_DMA_CHANNELS; ++ch) {
+        if (chan_mask & (1u << ch)) {
+            trigger(ch);
+        }
+    }
+}
+
+void dma_channel_abort(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].busy = false;
+    dma_hw->ch[channel].transfer_count = 0;
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    return channels[channel].busy;
+}
+
+void dma_channel_wait_for_finish_blocking(uint channel)
+{
+    unsigned spins = 0;
+    while (dma_channel_is_busy(channel)) {
+        hal_spin(spins);
+    }
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].irq_enabled[0] = enabled;
+}
+
+void dma_channel_set_irq1_enabled(uint channel, bool enabled)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].irq_enabled[1] = enabled;
+}
+
+bool dma_channel_get_irq0_status(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    return channels[channel].irq_status[0];
+}
+
+bool dma_channel_get_irq1_status(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    return channels[channel].irq_status[1];
+}
+
+void dma_channel_acknowledge_irq0(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].irq_status[0] = false;
+}
+
+void dma_channel_acknowledge_irq1(uint channel)
+{
+    std::lock_guard<std::recursive_mutex> lock(dma_mutex);
+    channels[channel].irq_status[1] = false;
+}
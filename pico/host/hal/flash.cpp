@@ -0,0 +1,44 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+uint8_t hal_flash_image[PICO_FLASH_SIZE_BYTES];
+
+static struct flash_init {
+    flash_init() { memset(hal_flash_image, 0xff, sizeof(hal_flash_image)); }
+} erased;
+
+static void check_range(const char * what, uint32_t offs, size_t count, size_t align)
+{
+    if (offs % align || count % align || offs + count > PICO_FLASH_SIZE_BYTES) {
+        fprintf(stderr, "%s: bad range %x+%zx\n", what, offs, count);
+        abort();
+    }
+}
+
+void flash_range_erase(uint32_t flash_offs, size_t count)
+{
+    check_range("flash_range_erase", flash_offs, count, FLASH_SECTOR_SIZE);
+    memset(hal_flash_image + flash_offs, 0xff, count);
+}
+
+// programming only clears bits, like nor flash
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count)
+{
+    check_range("flash_range_program", flash_offs, count, FLASH_PAGE_SIZE);
+    for (size_t i = 0; i < count; ++i) {
+        hal_flash_image[flash_offs + i] &= data[i];
+    }
+}
+
+uint32_t save_and_disable_interrupts(void)
+{
+    return 0;
+}
+
+void restore_interrupts(uint32_t status)
+{
+}
@@ -0,0 +1,94 @@
+#include <atomic>
+
+#include "hardware/gpio.h"
+#include "hal_host.h"
+
+struct hal_gpio_t {
+    std::atomic<bool> level{false};
+    bool out = false;
+    enum gpio_function function = GPIO_FUNC_NULL;
+    uint32_t irq_mask = 0;
+};
+
+static hal_gpio_t gpios[NUM_BANK0_GPIOS];
+static gpio_irq_callback_t irq_callback = nullptr;
+
+void gpio_init(uint gpio)
+{
+    gpios[gpio].out = false;
+    gpios[gpio].level = false;
+    gpios[gpio].function = GPIO_FUNC_SIO;
+}
+
+void gpio_set_function(uint gpio, enum gpio_function fn)
+{
+    gpios[gpio].function = fn;
+}
+
+void gpio_set_dir(uint gpio, bool out)
+{
+    gpios[gpio].out = out;
+}
+
+void gpio_put(uint gpio, bool value)
+{
+    gpios[gpio].level = value;
+}
+
+bool gpio_get(uint gpio)
+{
+    return gpios[gpio].level;
+}
+
+void gpio_pull_up(uint gpio)
+{
+    if (!gpios[gpio].out) {
+        gpios[gpio].level = true;
+    }
+}
+
+void gpio_pull_down(uint gpio)
+{
+    if (!gpios[gpio].out) {
+        gpios[gpio].level = false;
+    }
+}
+
+void gpio_disable_pulls(uint gpio)
+{
+}
+
+void gpio_set_input_hysteresis_enabled(uint gpio, bool enabled)
+{
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled)
+{
+    if (enabled) {
+        gpios[gpio].irq_mask |= event_mask;
+    }
+    else {
+        gpios[gpio].irq_mask &= ~event_mask;
+    }
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask,
+        bool enabled, gpio_irq_callback_t callback)
+{
+    gpio_set_irq_enabled(gpio, event_mask, enabled);
+    irq_callback = callback;
+}
+
+void hal_gpio_drive(uint gpio, bool value)
+{
+    hal_gpio_t & g = gpios[gpio];
+    bool prev = g.level.exchange(value);
+    uint32_t events = 0;
+    if (prev != value) {
+        events = value ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+    }
+    events &= g.irq_mask;
+    if (events && irq_callback) {
+        irq_callback(gpio, events);
+    }
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+// thrown at a blocking HAL call on core1 after multicore_reset_core1()
+struct hal_core1_reset {};
+
+// polite spin used by every blocking call: checks for core1 reset,
+// yields at first, then backs off to short sleeps
+void hal_spin(unsigned & spins);
+
+// dma access to pio fifo registers (&pio->rxf[sm], &pio->txf[sm])
+// return false if addr is not one; ready is false while the fifo is
+// empty (read) or full (write), i.e. when the dreq would be low
+bool hal_pio_dma_read(const volatile void * addr, uint32_t & word, bool & ready);
+bool hal_pio_dma_write(volatile void * addr, uint32_t word, bool & ready);
+
+// raise an irq line from a peripheral thread, runs the handler if enabled
+void hal_irq_raise(unsigned num);
+
+// single producer single consumer word fifo, stands in for
+// PIO and SIO FIFOs
+class HalFifo {
+private:
+    std::vector<uint32_t> buf;
+    size_t mask = 0;
+    size_t depth = 0;
+    std::atomic<size_t> head{0}; // written by consumer
+    std::atomic<size_t> tail{0}; // written by producer
+
+public:
+    HalFifo(size_t depth = 4) { set_depth(depth); }
+
+    // not thread safe, only while both sides are idle
+    void set_depth(size_t new_depth)
+    {
+        size_t capacity = 1;
+        while (capacity < new_depth) {
+            capacity <<= 1;
+        }
+        buf.assign(capacity, 0);
+        mask = capacity - 1;
+        depth = new_depth;
+        head = 0;
+        tail = 0;
+    }
+
+    size_t get_depth() const { return depth; }
+
+    size_t level() const
+    {
+        return tail.load(std::memory_order_acquire) 
+            - head.load(std::memory_order_acquire);
+    }
+
+    bool push(uint32_t word)
+    {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) >= depth) {
+            return false;
+        }
+        buf[t & mask] = word;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(uint32_t & word)
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        word = buf[h & mask];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer side
+    void clear()
+    {
+        head.store(tail.load(std::memory_order_acquire),
+                std::memory_order_release);
+    }
+};
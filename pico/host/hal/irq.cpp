@@ -0,0 +1,36 @@
+#include <atomic>
+
+#include "hardware/irq.h"
+#include "hal_internal.h"
+
+static std::atomic<irq_handler_t> handlers[NUM_IRQS];
+static std::atomic<bool> enabled[NUM_IRQS];
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler)
+{
+    handlers[num] = handler;
+}
+
+void irq_remove_handler(uint num, irq_handler_t handler)
+{
+    irq_handler_t expected = handler;
+    handlers[num].compare_exchange_strong(expected, nullptr);
+}
+
+void irq_set_enabled(uint num, bool enable)
+{
+    enabled[num] = enable;
+}
+
+bool irq_is_enabled(uint num)
+{
+    return enabled[num];
+}
+
+void hal_irq_raise(unsigned num)
+{
+    irq_handler_t handler = handlers[num];
+    if (enabled[num] && handler) {
+        handler();
+    }
+}
@@ -0,0 +1,155 @@
+#include <thread>
+#include <atomic>
+#include <ctime>
+#include <pthread.h>
+
+#include "pico/multicore.h"
+#include "pico/time.h"
+#include "hal_host.h"
+#include "hal_internal.h"
+
+// SIO mailboxes, 8 words each way
+static HalFifo fifo_to_core1(8);
+static HalFifo fifo_to_core0(8);
+
+static std::thread core1_thread;
+static std::atomic<bool> core1_reset_request{false};
+static std::atomic<bool> core1_alive{false};
+static std::atomic<clockid_t> core1_clock{0};
+static std::atomic<uint64_t> core1_last_cpu_ns{0};
+
+static thread_local bool on_core1 = false;
+
+static uint64_t thread_cpu_ns(clockid_t clock)
+{
+    timespec ts;
+    if (clock_gettime(clock, &ts) != 0) {
+        return 0;
+    }
+    return (uint64_t)ts.tv_sec * 1000000000ull + ts.tv_nsec;
+}
+
+void hal_core1_checkpoint(void)
+{
+    if (on_core1 && core1_reset_request.load(std::memory_order_relaxed)) {
+        throw hal_core1_reset();
+    }
+}
+
+void hal_spin(unsigned & spins)
+{
+    hal_core1_checkpoint();
+    if (++spins < 64) {
+        std::this_thread::yield();
+    }
+    else {
+        std::this_thread::sleep_for(std::chrono::microseconds(20));
+    }
+}
+
+bool hal_on_core1(void)
+{
+    return on_core1;
+}
+
+bool hal_core1_running(void)
+{
+    return core1_alive;
+}
+
+uint64_t hal_core1_cpu_time_ns(void)
+{
+    if (core1_alive) {
+        return thread_cpu_ns(core1_clock);
+    }
+    return core1_last_cpu_ns;
+}
+
+static void core1_trampoline(void (*entry)(void))
+{
+    on_core1 = true;
+    clockid_t clock;
+    pthread_getcpuclockid(pthread_self(), &clock);
+    core1_clock = clock;
+    core1_alive = true;
+    try {
+        entry();
+    }
+    catch (const hal_core1_reset &) {
+    }
+    core1_last_cpu_ns = thread_cpu_ns(clock);
+    core1_alive = false;
+}
+
+void multicore_reset_core1(void)
+{
+    if (core1_thread.joinable()) {
+        core1_reset_request = true;
+        core1_thread.join();
+    }
+    core1_reset_request = false;
+}
+
+void multicore_launch_core1(void (*entry)(void))
+{
+    multicore_reset_core1();
+    // the launch handshake drains core0's mailbox
+    multicore_fifo_drain();
+    core1_thread = std::thread(core1_trampoline, entry);
+}
+
+static HalFifo & rx_fifo()
+{
+    return on_core1 ? fifo_to_core1 : fifo_to_core0;
+}
+
+static HalFifo & tx_fifo()
+{
+    return on_core1 ? fifo_to_core0 : fifo_to_core1;
+}
+
+bool multicore_fifo_rvalid(void)
+{
+    return rx_fifo().level() > 0;
+}
+
+bool multicore_fifo_wready(void)
+{
+    return tx_fifo().level() < tx_fifo().get_depth();
+}
+
+void multicore_fifo_push_blocking(uint32_t data)
+{
+    unsigned spins = 0;
+    while (!tx_fifo().push(data)) {
+        hal_spin(spins);
+    }
+}
+
+uint32_t multicore_fifo_pop_blocking(void)
+{
+    uint32_t data;
+    unsigned spins = 0;
+    while (!rx_fifo().pop(data)) {
+        hal_spin(spins);
+    }
+    return data;
+}
+
+bool multicore_fifo_pop_timeout_us(uint64_t timeout_us, uint32_t *out)
+{
+    uint64_t deadline = time_us_64() + timeout_us;
+    unsigned spins = 0;
+    while (!rx_fifo().pop(*out)) {
+        if (time_us_64() >= deadline) {
+            return false;
+        }
+        hal_spin(spins);
+    }
+    return true;
+}
+
+void multicore_fifo_drain(void)
+{
+    rx_fifo().clear();
+}
@@ -0,0 +1,313 @@
+#include <cstdio>
+#include <cstdlib>
+#include <atomic>
+
+#include "hardware/pio.h"
+#include "pico/time.h"
+#include "hal_host.h"
+#include "hal_internal.h"
+
+pio_hw_t hal_pio_hw[NUM_PIOS] = {};
+
+struct hal_sm_t {
+    pio_sm_config config = pio_get_default_sm_config();
+    bool enabled = false;
+    size_t depth_override = 0;
+    HalFifo txf;
+    HalFifo rxf;
+    std::atomic<uint32_t> rx_overflows{0};
+};
+
+struct hal_pio_t {
+    uint32_t used_instructions = 0;     // bitmap
+    hal_sm_t sm[NUM_PIO_STATE_MACHINES];
+};
+
+static hal_pio_t pios[NUM_PIOS];
+
+static hal_sm_t & get_sm(PIO pio, uint sm)
+{
+    return pios[pio_get_index(pio)].sm[sm];
+}
+
+static void apply_depth(hal_sm_t & s)
+{
+    size_t tx_depth = 4, rx_depth = 4;
+    if (s.config.join == PIO_FIFO_JOIN_TX) {
+        tx_depth = 8;
+        rx_depth = 0;
+    }
+    else if (s.config.join == PIO_FIFO_JOIN_RX) {
+        tx_depth = 0;
+        rx_depth = 8;
+    }
+    if (s.depth_override) {
+        tx_depth = rx_depth = s.depth_override;
+    }
+    s.txf.set_depth(tx_depth);
+    s.rxf.set_depth(rx_depth);
+}
+
+uint pio_get_index(PIO pio)
+{
+    return pio == pio1 ? 1 : 0;
+}
+
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx)
+{
+    return pio_get_index(pio) * 8 + (is_tx ? 0 : 4) + sm;
+}
+
+pio_sm_config pio_get_default_sm_config(void)
+{
+    pio_sm_config c = {};
+    c.clkdiv = 1.0f;
+    c.wrap = 31;
+    c.pull_threshold = 32;
+    c.push_threshold = 32;
+    c.out_shift_right = true;
+    c.in_shift_right = true;
+    return c;
+}
+
+void sm_config_set_wrap(pio_sm_config *c, uint wrap_target, uint wrap)
+{
+    c->wrap_target = wrap_target;
+    c->wrap = wrap;
+}
+
+void sm_config_set_out_pins(pio_sm_config *c, uint out_base, uint out_count)
+{
+    c->out_base = out_base;
+    c->out_count = out_count;
+}
+
+void sm_config_set_in_pins(pio_sm_config *c, uint in_base)
+{
+    c->in_base = in_base;
+}
+
+void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull,
+        uint pull_threshold)
+{
+    c->out_shift_right = shift_right;
+    c->autopull = autopull;
+    c->pull_threshold = pull_threshold;
+}
+
+void sm_config_set_in_shift(pio_sm_config *c, bool shift_right, bool autopush,
+        uint push_threshold)
+{
+    c->in_shift_right = shift_right;
+    c->autopush = autopush;
+    c->push_threshold = push_threshold;
+}
+
+void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join)
+{
+    c->join = join;
+}
+
+void sm_config_set_clkdiv(pio_sm_config *c, float div)
+{
+    c->clkdiv = div;
+}
+
+uint pio_add_program(PIO pio, const pio_program_t *program)
+{
+    hal_pio_t & p = pios[pio_get_index(pio)];
+    uint32_t mask = (1u << program->length) - 1;
+    for (int offset = PIO_INSTRUCTION_COUNT - program->length; offset >= 0; --offset) {
+        if ((p.used_instructions & (mask << offset)) == 0) {
+            p.used_instructions |= mask << offset;
+            return offset;
+        }
+    }
+    fprintf(stderr, "pio_add_program: no program space\n");
+    abort();
+}
+
+void pio_remove_program(PIO pio, const pio_program_t *program, uint loaded_offset)
+{
+    uint32_t mask = ((1u << program->length) - 1) << loaded_offset;
+    pios[pio_get_index(pio)].used_instructions &= ~mask;
+}
+
+void pio_clear_instruction_memory(PIO pio)
+{
+    pios[pio_get_index(pio)].used_instructions = 0;
+}
+
+void pio_gpio_init(PIO pio, uint pin)
+{
+    gpio_set_function(pin, pio == pio1 ? GPIO_FUNC_PIO1 : GPIO_FUNC_PIO0);
+}
+
+void pio_sm_set_pins_with_mask(PIO pio, uint sm, uint32_t pin_values,
+        uint32_t pin_mask)
+{
+}
+
+void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base,
+        uint pin_count, bool is_out)
+{
+}
+
+void pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    s.enabled = false;
+    s.config = *config;
+    s.rx_overflows = 0;
+    apply_depth(s);
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+    get_sm(pio, sm).enabled = enabled;
+}
+
+void pio_sm_clear_fifos(PIO pio, uint sm)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    s.txf.clear();
+    s.rxf.clear();
+}
+
+bool pio_sm_is_rx_fifo_empty(PIO pio, uint sm)
+{
+    return get_sm(pio, sm).rxf.level() == 0;
+}
+
+bool pio_sm_is_tx_fifo_full(PIO pio, uint sm)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    return s.txf.level() >= s.txf.get_depth();
+}
+
+uint pio_sm_get_rx_fifo_level(PIO pio, uint sm)
+{
+    return get_sm(pio, sm).rxf.level();
+}
+
+uint pio_sm_get_tx_fifo_level(PIO pio, uint sm)
+{
+    return get_sm(pio, sm).txf.level();
+}
+
+void pio_sm_put(PIO pio, uint sm, uint32_t data)
+{
+    get_sm(pio, sm).txf.push(data);
+}
+
+uint32_t pio_sm_get(PIO pio, uint sm)
+{
+    uint32_t data = 0;
+    get_sm(pio, sm).rxf.pop(data);
+    return data;
+}
+
+void pio_sm_put_blocking(PIO pio, uint sm, uint32_t data)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    unsigned spins = 0;
+    while (!s.txf.push(data)) {
+        hal_spin(spins);
+    }
+}
+
+uint32_t pio_sm_get_blocking(PIO pio, uint sm)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    uint32_t data;
+    unsigned spins = 0;
+    while (!s.rxf.pop(data)) {
+        hal_spin(spins);
+    }
+    return data;
+}
+
+// ---- dma side ----
+
+bool hal_pio_dma_read(const volatile void * addr, uint32_t & word, bool & ready)
+{
+    for (uint i = 0; i < NUM_PIOS; ++i) {
+        for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm) {
+            if (addr == &hal_pio_hw[i].rxf[sm]) {
+                ready = pios[i].sm[sm].rxf.pop(word);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool hal_pio_dma_write(volatile void * addr, uint32_t word, bool & ready)
+{
+    for (uint i = 0; i < NUM_PIOS; ++i) {
+        for (uint sm = 0; sm < NUM_PIO_STATE_MACHINES; ++sm) {
+            if (addr == &hal_pio_hw[i].txf[sm]) {
+                ready = pios[i].sm[sm].txf.push(word);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+// ---- host side ----
+
+bool hal_pio_tx_pop(PIO pio, uint sm, uint32_t *word, uint64_t timeout_us)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    uint64_t deadline = time_us_64() + timeout_us;
+    unsigned spins = 0;
+    while (!s.txf.pop(*word)) {
+        if (time_us_64() >= deadline) {
+            return false;
+        }
+        hal_spin(spins);
+    }
+    return true;
+}
+
+bool hal_pio_rx_push(PIO pio, uint sm, uint32_t word)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    if (!s.rxf.push(word)) {
+        ++s.rx_overflows;
+        return false;
+    }
+    return true;
+}
+
+void hal_pio_rx_push_blocking(PIO pio, uint sm, uint32_t word)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    unsigned spins = 0;
+    while (!s.rxf.push(word)) {
+        hal_spin(spins);
+    }
+}
+
+uint32_t hal_pio_rx_overflows(PIO pio, uint sm)
+{
+    return get_sm(pio, sm).rx_overflows;
+}
+
+void hal_pio_set_fifo_depth(PIO pio, uint sm, size_t depth)
+{
+    hal_sm_t & s = get_sm(pio, sm);
+    s.depth_override = depth;
+    apply_depth(s);
+}
+
+bool hal_pio_sm_enabled(PIO pio, uint sm)
+{
+    return get_sm(pio, sm).enabled;
+}
+
+pio_sm_config hal_pio_sm_config(PIO pio, uint sm)
+{
+    return get_sm(pio, sm).config;
+}
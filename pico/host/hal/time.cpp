@@ -0,0 +1,232 @@
+#include <chrono>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <map>
+#include <deque>
+
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hal_host.h"
+#include "hal_internal.h"
+
+// ---- time ----
+
+static const auto boot_time = std::chrono::steady_clock::now();
+
+uint64_t time_us_64(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - boot_time).count();
+}
+
+uint32_t time_us_32(void)
+{
+    return (uint32_t)time_us_64();
+}
+
+absolute_time_t get_absolute_time(void)
+{
+    return time_us_64();
+}
+
+uint64_t to_us_since_boot(absolute_time_t t)
+{
+    return t;
+}
+
+uint32_t to_ms_since_boot(absolute_time_t t)
+{
+    return t / 1000;
+}
+
+int64_t absolute_time_diff_us(absolute_time_t from, absolute_time_t to)
+{
+    return (int64_t)(to - from);
+}
+
+void sleep_us(uint64_t us)
+{
+    uint64_t deadline = time_us_64() + us;
+    for (;;) {
+        hal_core1_checkpoint();
+        uint64_t now = time_us_64();
+        if (now >= deadline) {
+            break;
+        }
+        // short slices so that a core1 reset is noticed
+        std::this_thread::sleep_for(std::chrono::microseconds(
+                    std::min<uint64_t>(deadline - now, 1000)));
+    }
+}
+
+void sleep_ms(uint32_t ms)
+{
+    sleep_us((uint64_t)ms * 1000);
+}
+
+void tight_loop_contents(void)
+{
+    hal_core1_checkpoint();
+    std::this_thread::yield();
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index)
+{
+    return 125000000;
+}
+
+// ---- alarms, serviced by one timer thread that plays the alarm irq ----
+
+struct hal_alarm_t {
+    uint64_t when;
+    alarm_callback_t callback;
+    void * user_data;
+    repeating_timer_t * rt;
+};
+
+static std::mutex alarm_mutex;
+static std::condition_variable alarm_cv;
+static std::map<alarm_id_t, hal_alarm_t> alarms;
+static alarm_id_t next_alarm_id = 1;
+static std::thread alarm_thread;
+
+static void alarm_thread_entry()
+{
+    std::unique_lock<std::mutex> lock(alarm_mutex);
+    for (;;) {
+        if (alarms.empty()) {
+            alarm_cv.wait(lock);
+            continue;
+        }
+        auto next = alarms.begin();
+        for (auto it = alarms.begin(); it != alarms.end(); ++it) {
+            if (it->second.when < next->second.when) {
+                next = it;
+            }
+        }
+        uint64_t now = time_us_64();
+        if (next->second.when > now) {
+            alarm_cv.wait_for(lock, std::chrono::microseconds(next->second.when - now));
+            continue;
+        }
+
+        alarm_id_t id = next->first;
+        hal_alarm_t alarm = next->second;
+        alarms.erase(next);
+
+        lock.unlock();
+        int64_t reschedule_us = 0;
+        if (alarm.rt) {
+            if (alarm.rt->callback(alarm.rt)) {
+                reschedule_us = alarm.rt->delay_us;
+            }
+        }
+        else {
+            reschedule_us = alarm.callback(id, alarm.user_data);
+        }
+        lock.lock();
+
+        // sdk semantics: >0 from the alarm time, <0 from now
+        if (reschedule_us != 0 && (!alarm.rt || alarm.rt->alarm_id == id)) {
+            alarm.when = reschedule_us > 0 ? alarm.when + reschedule_us
+                                           : time_us_64() - reschedule_us;
+            alarms[id] = alarm;
+        }
+    }
+}
+
+static alarm_id_t schedule_alarm(uint64_t us, alarm_callback_t callback,
+        void * user_data, repeating_timer_t * rt)
+{
+    std::lock_guard<std::mutex> lock(alarm_mutex);
+    if (!alarm_thread.joinable()) {
+        alarm_thread = std::thread(alarm_thread_entry);
+        alarm_thread.detach();
+    }
+    alarm_id_t id = next_alarm_id++;
+    alarms[id] = hal_alarm_t{time_us_64() + us, callback, user_data, rt};
+    if (rt) {
+        rt->alarm_id = id;
+    }
+    alarm_cv.notify_one();
+    return id;
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback,
+        void *user_data, bool fire_if_past)
+{
+    return schedule_alarm(us, callback, user_data, nullptr);
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback,
+        void *user_data, bool fire_if_past)
+{
+    return add_alarm_in_us((uint64_t)ms * 1000, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t alarm_id)
+{
+    std::lock_guard<std::mutex> lock(alarm_mutex);
+    return alarms.erase(alarm_id) > 0;
+}
+
+bool add_repeating_timer_us(int64_t delay_us, repeating_timer_callback_t callback,
+        void *user_data, repeating_timer_t *out)
+{
+    out->delay_us = delay_us < 0 ? -delay_us : delay_us;
+    out->callback = callback;
+    out->user_data = user_data;
+    schedule_alarm(out->delay_us, nullptr, user_data, out);
+    return true;
+}
+
+bool add_repeating_timer_ms(int32_t delay_ms, repeating_timer_callback_t callback,
+        void *user_data, repeating_timer_t *out)
+{
+    return add_repeating_timer_us((int64_t)delay_ms * 1000, callback, user_data, out);
+}
+
+bool cancel_repeating_timer(repeating_timer_t *timer)
+{
+    std::lock_guard<std::mutex> lock(alarm_mutex);
+    bool found = alarms.erase(timer->alarm_id) > 0;
+    timer->alarm_id = 0;
+    return found;
+}
+
+// ---- stdio ----
+
+static std::mutex stdin_mutex;
+static std::deque<int> stdin_queue;
+
+bool stdio_init_all(void)
+{
+    return true;
+}
+
+void hal_stdin_push(int c)
+{
+    std::lock_guard<std::mutex> lock(stdin_mutex);
+    stdin_queue.push_back(c);
+}
+
+int getchar_timeout_us(uint32_t timeout_us)
+{
+    uint64_t deadline = time_us_64() + timeout_us;
+    unsigned spins = 0;
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(stdin_mutex);
+            if (!stdin_queue.empty()) {
+                int c = stdin_queue.front();
+                stdin_queue.pop_front();
+                return c;
+            }
+        }
+        if (time_us_64() >= deadline) {
+            return PICO_ERROR_TIMEOUT;
+        }
+        hal_spin(spins);
+    }
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+// Host side of the HAL: what the outside world does to the emulated pico.
+// Firmware sources never include this, only host benches and simulators.
+
+#include "pico/types.h"
+#include "hardware/pio.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// ---- PIO pin side ----
+
+// take a word that the tx state machine would shift out, false on timeout
+bool hal_pio_tx_pop(PIO pio, uint sm, uint32_t *word, uint64_t timeout_us);
+
+// put a word that the rx state machine would have autopushed
+// non-blocking: returns false and counts an overflow when the fifo is full,
+// the state machine stalls and the samples are lost as on the real thing
+bool hal_pio_rx_push(PIO pio, uint sm, uint32_t word);
+
+// lossless variant for faster-than-realtime runs: waits for the consumer
+void hal_pio_rx_push_blocking(PIO pio, uint sm, uint32_t word);
+
+uint32_t hal_pio_rx_overflows(PIO pio, uint sm);
+
+// override fifo depth (0 = hardware depth, 4 or 8 when joined)
+// e.g. to prefill a whole capture before launching core1
+void hal_pio_set_fifo_depth(PIO pio, uint sm, size_t depth);
+
+bool hal_pio_sm_enabled(PIO pio, uint sm);
+pio_sm_config hal_pio_sm_config(PIO pio, uint sm);
+
+// ---- gpio ----
+
+// drive an input pin from outside, fires the irq callback on edges
+void hal_gpio_drive(uint gpio, bool value);
+
+// ---- stdio ----
+
+// queue a character for getchar_timeout_us()
+void hal_stdin_push(int c);
+
+// ---- cores ----
+
+bool hal_on_core1(void);
+bool hal_core1_running(void);
+
+// unwind core1 here if multicore_reset_core1() is pending,
+// for host code that loops on core1 without calling into the HAL
+void hal_core1_checkpoint(void);
+
+// cpu time spent by the current (or last) core1 thread
+uint64_t hal_core1_cpu_time_ns(void);
+
+#ifdef __cplusplus
+}
+#endif
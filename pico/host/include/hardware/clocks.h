@@ -0,0 +1,30 @@
+#pragma once
+
+// host stand-in for pico-sdk hardware/clocks.h
+
+#include "pico/types.h"
+
+enum clock_index {
+    clk_gpout0 = 0,
+    clk_gpout1,
+    clk_gpout2,
+    clk_gpout3,
+    clk_ref,
+    clk_sys,
+    clk_peri,
+    clk_usb,
+    clk_adc,
+    clk_rtc,
+    CLK_COUNT
+};
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// the stock 125MHz
+uint32_t clock_get_hz(enum clock_index clk_index);
+
+#ifdef __cplusplus
+}
+#endif
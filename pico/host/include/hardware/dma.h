@@ -0,0 +1,112 @@
+#pragma once
+
+// host stand-in for pico-sdk hardware/dma.h
+// channels are serviced by one engine thread. PIO fifo addresses (&pio->txf[sm],
+// &pio->rxf[sm]) pace the transfers the way their DREQs would, anything
+// else is memory. Address registers are pointer sized on the host, so the
+// "dma writes another channel's registers" tricks are not supported.
+
+#include "pico/types.h"
+#include "hardware/irq.h"
+
+#define NUM_DMA_CHANNELS 12
+
+#define DREQ_PIO0_TX0   0
+#define DREQ_PIO0_RX0   4
+#define DREQ_PIO1_TX0   8
+#define DREQ_PIO1_RX0   12
+#define DREQ_FORCE      0x3f
+
+enum dma_channel_transfer_size {
+    DMA_SIZE_8 = 0,
+    DMA_SIZE_16 = 1,
+    DMA_SIZE_32 = 2,
+};
+
+typedef struct {
+    bool enable;
+    enum dma_channel_transfer_size size;
+    bool read_increment;
+    bool write_increment;
+    uint dreq;
+    uint chain_to;
+    bool ring_write;
+    uint ring_size_bits;
+    bool irq_quiet;
+} dma_channel_config;
+
+typedef struct {
+    volatile uintptr_t read_addr;
+    volatile uintptr_t write_addr;
+    io_rw_32 transfer_count;    // live count, reads as 0 when finished
+} dma_channel_hw_t;
+
+typedef struct {
+    dma_channel_hw_t ch[NUM_DMA_CHANNELS];
+} dma_hw_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern dma_hw_t hal_dma_hw;
+
+#ifdef __cplusplus
+}
+#endif
+
+#define dma_hw (&hal_dma_hw)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void dma_channel_claim(uint channel);
+int dma_claim_unused_channel(bool required);
+void dma_channel_unclaim(uint channel);
+
+dma_channel_config dma_channel_get_default_config(uint channel);
+dma_channel_config dma_get_channel_config(uint channel);
+void channel_config_set_read_increment(dma_channel_config *c, bool incr);
+void channel_config_set_write_increment(dma_channel_config *c, bool incr);
+void channel_config_set_dreq(dma_channel_config *c, uint dreq);
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to);
+void channel_config_set_transfer_data_size(dma_channel_config *c,
+        enum dma_channel_transfer_size size);
+void channel_config_set_ring(dma_channel_config *c, bool write, uint size_bits);
+void channel_config_set_irq_quiet(dma_channel_config *c, bool irq_quiet);
+void channel_config_set_enable(dma_channel_config *c, bool enable);
+
+void dma_channel_set_config(uint channel, const dma_channel_config *config,
+        bool trigger);
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr,
+        bool trigger);
+void dma_channel_set_write_addr(uint channel, volatile void *write_addr,
+        bool trigger);
+void dma_channel_set_trans_count(uint channel, uint32_t trans_count,
+        bool trigger);
+void dma_channel_configure(uint channel, const dma_channel_config *config,
+        volatile void *write_addr, const volatile void *read_addr,
+        uint transfer_count, bool trigger);
+
+void dma_channel_start(uint channel);
+void dma_start_channel_mask(uint32_t chan_mask);
+void dma_channel_abort(uint channel);
+bool dma_channel_is_busy(uint channel);
+void dma_channel_wait_for_finish_blocking(uint channel);
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled);
+void dma_channel_set_irq1_enabled(uint channel, bool enabled);
+bool dma_channel_get_irq0_status(uint channel);
+bool dma_channel_get_irq1_status(uint channel);
+void dma_channel_acknowledge_irq0(uint channel);
+void dma_channel_acknowledge_irq1(uint channel);
+
+static inline dma_channel_hw_t *dma_channel_hw_addr(uint channel)
+{
+    return &dma_hw->ch[channel];
+}
+
+#ifdef __cplusplus
+}
+#endif
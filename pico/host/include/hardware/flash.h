@@ -0,0 +1,26 @@
+#pragma once
+
+// host stand-in for pico-sdk hardware/flash.h
+// flash is a memory image that starts erased, mapped at XIP_BASE like on
+// the pico; it does not survive the process
+
+#include "pico/types.h"
+
+#define FLASH_PAGE_SIZE         (1u << 8)
+#define FLASH_SECTOR_SIZE       (1u << 12)
+#define PICO_FLASH_SIZE_BYTES   (2 * 1024 * 1024)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+extern uint8_t hal_flash_image[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE ((uintptr_t)hal_flash_image)
+
+// offsets and sizes must be sector (erase) and page (program) aligned
+void flash_range_erase(uint32_t flash_offs, size_t count);
+void flash_range_program(uint32_t flash_offs, const uint8_t *data, size_t count);
+
+#ifdef __cplusplus
+}
+#endif
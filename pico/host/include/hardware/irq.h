@@ -0,0 +1,27 @@
+#pragma once
+
+// host stand-in for pico-sdk hardware/irq.h
+// only the lines the HAL raises itself (DMA) are dispatched, the handler
+// runs on the thread that plays the peripheral
+
+#include "pico/types.h"
+
+#define DMA_IRQ_0   11
+#define DMA_IRQ_1   12
+
+#define NUM_IRQS    32
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef void (*irq_handler_t)(void);
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_remove_handler(uint num, irq_handler_t handler);
+void irq_set_enabled(uint num, bool enabled);
+bool irq_is_enabled(uint num);
+
+#ifdef __cplusplus
+}
+#endif
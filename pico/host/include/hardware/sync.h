@@ -0,0 +1,17 @@
+#pragma once
+
+// host stand-in for pico-sdk hardware/sync.h
+// there are no interrupts to mask, the irq threads keep running
+
+#include "pico/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
+
+#ifdef __cplusplus
+}
+#endif
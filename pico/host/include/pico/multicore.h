@@ -0,0 +1,25 @@
+#pragma once
+
+// host stand-in for pico-sdk pico/multicore.h
+// core1 is a thread, the inter-core mailboxes are 8-deep FIFOs.
+// multicore_reset_core1() unwinds core1 at its next blocking HAL call.
+
+#include "pico/types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void multicore_launch_core1(void (*entry)(void));
+void multicore_reset_core1(void);
+
+bool multicore_fifo_rvalid(void);
+bool multicore_fifo_wready(void);
+void multicore_fifo_push_blocking(uint32_t data);
+uint32_t multicore_fifo_pop_blocking(void);
+bool multicore_fifo_pop_timeout_us(uint64_t timeout_us, uint32_t *out);
+void multicore_fifo_drain(void);
+
+#ifdef __cplusplus
+}
+#endif
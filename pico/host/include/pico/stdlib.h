@@ -0,0 +1,27 @@
+#pragma once
+
+// host stand-in for pico-sdk pico/stdlib.h
+
+#include <stdio.h>
+
+#include "pico/types.h"
+#include "pico/time.h"
+#include "hardware/gpio.h"
+
+#define PICO_ERROR_TIMEOUT  (-1)
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+bool stdio_init_all(void);
+
+// characters come from hal_stdin_push(), see hal_host.h
+int getchar_timeout_us(uint32_t timeout_us);
+
+// busy-wait hint; on the host it is also a reset point for core1
+void tight_loop_contents(void);
+
+#ifdef __cplusplus
+}
+#endif
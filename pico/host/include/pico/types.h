@@ -0,0 +1,15 @@
+#pragma once
+
+// host stand-in for pico-sdk pico/types.h
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef unsigned int uint;
+
+typedef uint64_t absolute_time_t;
+
+typedef volatile uint32_t io_rw_32;
+typedef const volatile uint32_t io_ro_32;
+typedef volatile uint32_t io_wo_32;
@@ -0,0 +1,12 @@
+// host stand-ins for what tapeshnik.cpp provides on the pico
+
+#include "mainloop.h"
+
+#define ML_NO_REQUEST   0
+#define ML_STOP_REQUEST ' '
+volatile int mainloop_request = ML_NO_REQUEST;
+
+void request_wheel_stop()
+{
+    mainloop_request = ML_STOP_REQUEST;
+}
@@ -0,0 +1,70 @@
+# Poor man's pioasm for the host build: cmake -DPIO=x.pio -DOUT=x.pio.h -P pioheader.cmake
+#
+# The host HAL does not execute PIO code, so only the program layout is
+# needed: instruction count, wrap points and the "% c-sdk" blocks verbatim.
+
+file(STRINGS ${PIO} lines)
+
+set(header "// generated from ${PIO} by pioheader.cmake, do not edit\n\n#pragma once\n\n#include \"hardware/pio.h\"\n")
+set(program "")
+set(in_sdk FALSE)
+
+macro(emit_program)
+    if (NOT program STREQUAL "")
+        if (wrap STREQUAL "")
+            math(EXPR wrap "${count} - 1")
+        endif()
+        string(APPEND header
+            "\nstatic const uint16_t ${program}_program_instructions[] = {\n"
+            "    ${instructions}\n};\n\n"
+            "static const struct pio_program ${program}_program = {\n"
+            "    .instructions = ${program}_program_instructions,\n"
+            "    .length = ${count},\n"
+            "    .origin = -1,\n};\n\n"
+            "#define ${program}_wrap_target ${wrap_target}\n"
+            "#define ${program}_wrap ${wrap}\n\n"
+            "static inline pio_sm_config ${program}_program_get_default_config(uint offset) {\n"
+            "    pio_sm_config c = pio_get_default_sm_config();\n"
+            "    sm_config_set_wrap(&c, offset + ${program}_wrap_target, offset + ${program}_wrap);\n"
+            "    return c;\n}\n")
+        set(program "")
+    endif()
+endmacro()
+
+foreach(line IN LISTS lines)
+    if (in_sdk)
+        if (line MATCHES "^%}")
+            set(in_sdk FALSE)
+        else()
+            string(APPEND header "${line}\n")
+        endif()
+        continue()
+    endif()
+
+    string(REGEX REPLACE ";.*$" "" code "${line}")
+    string(STRIP "${code}" code)
+
+    if (code MATCHES "^% *c-sdk *{")
+        emit_program()
+        set(in_sdk TRUE)
+        string(APPEND header "\n")
+    elseif (code MATCHES "^\\.program +([A-Za-z0-9_]+)")
+        emit_program()
+        set(program ${CMAKE_MATCH_1})
+        set(count 0)
+        set(instructions "")
+        set(wrap_target 0)
+        set(wrap "")
+    elseif (code MATCHES "^\\.wrap_target")
+        set(wrap_target ${count})
+    elseif (code MATCHES "^\\.wrap")
+        math(EXPR wrap "${count} - 1")
+    elseif (NOT program STREQUAL "" AND NOT code STREQUAL ""
+            AND NOT code MATCHES "^\\." AND NOT code MATCHES ":$")
+        string(APPEND instructions "0x0000, ")
+        math(EXPR count "${count} + 1")
+    endif()
+endforeach()
+emit_program()
+
+file(WRITE ${OUT} "${header}")
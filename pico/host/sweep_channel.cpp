@@ -0,0 +1,180 @@
+// Sweep density and DLL gains over a simulated tape.
+//
+// Sectors are recorded once, exactly as the firmware writes them, then
+// played back through TapeChannel at every mod_freq and read by the
+// firmware core1 reader with every combination of Kp, Ki, alpha, phase
+// spike threshold and soft decisions on or off. -m records with another
+// modulation, mod_freq stays the highest reversal frequency.
+//
+//   sweep_channel -f 6000:12000:1000 -p 0.02,0.0333,0.05 -n 16 --noise 0.15
+//
+// Lists are comma separated or first:last:step.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <getopt.h>
+
+#include "config.h"
+#include "firmware.h"
+#include "tapesim.h"
+
+static std::vector<double> parse_list(const char * arg)
+{
+    std::vector<double> values;
+    double first, last, step;
+    if (sscanf(arg, "%lf:%lf:%lf", &first, &last, &step) == 3 && step > 0) {
+        for (double v = first; v <= last + step * 1e-6; v += step) {
+            values.push_back(v);
+        }
+        return values;
+    }
+    std::string s(arg);
+    for (size_t pos = 0; pos <= s.size(); ) {
+        size_t comma = s.find(',', pos);
+        if (comma == std::string::npos) comma = s.size();
+        values.push_back(atof(s.substr(pos, comma - pos).c_str()));
+        pos = comma + 1;
+    }
+    return values;
+}
+
+static void usage()
+{
+    printf("usage: sweep_channel [options]\n"
+           "  -n N            sectors to record (16)\n"
+           "  -f LIST         mod_freq, Hz (MOD_FREQ)\n"
+           "  -p LIST         Kp (DLL_KP, DLL_KP_RLL with rll(2,7))\n"
+           "  -i LIST         Ki (DLL_KI)\n"
+           "  -a LIST         alpha (DLL_ALPHA)\n"
+           "  -s LIST         phase spike erasure threshold, bit cells (DLL_PHASE_SPIKE)\n"
+           "  -S LIST         dll soft decisions, 0 or 1 (DLL_SOFT)\n"
+           "  -m N            modulation, modulation_t (MODULATION)\n"
+           "  --ideal         start from a clean channel instead of the default\n"
+           "  --pw50 US       readback step width\n"
+           "  --jitter US     rms write jitter\n"
+           "  --wow PCT       --flutter PCT\n"
+           "  --dc FRAC       peak dc drift\n"
+           "  --noise FRAC    rms noise\n"
+           "  --dropouts N    per second, --dropout-ms MS\n"
+           "  --seed N\n"
+           "  --bitwise       one sample per sampler call instead of packed words\n");
+}
+
+int main(int argc, char ** argv)
+{
+    int nsectors = 16;
+    std::vector<double> freqs = { MOD_FREQ };
+    std::vector<double> kps;
+    std::vector<double> kis = { DLL_KI };
+    std::vector<double> alphas = { DLL_ALPHA };
+    std::vector<double> spikes = { DLL_PHASE_SPIKE };
+    std::vector<double> softs = { DLL_SOFT };
+    uint8_t modulation = MODULATION;
+
+    tape_channel_params_t params = tape_channel_default();
+    bool bitwise = RX_SAMPLES_PER_WORD != 32;
+
+    enum { O_IDEAL = 256, O_PW50, O_JITTER, O_WOW, O_FLUTTER, O_DC, O_NOISE,
+        O_DROPOUTS, O_DROPOUT_MS, O_SEED, O_BITWISE };
+    static const option longopts[] = {
+        { "ideal",      no_argument,        0, O_IDEAL },
+        { "pw50",       required_argument,  0, O_PW50 },
+        { "jitter",     required_argument,  0, O_JITTER },
+        { "wow",        required_argument,  0, O_WOW },
+        { "flutter",    required_argument,  0, O_FLUTTER },
+        { "dc",         required_argument,  0, O_DC },
+        { "noise",      required_argument,  0, O_NOISE },
+        { "dropouts",   required_argument,  0, O_DROPOUTS },
+        { "dropout-ms", required_argument,  0, O_DROPOUT_MS },
+        { "seed",       required_argument,  0, O_SEED },
+        { "bitwise",    no_argument,        0, O_BITWISE },
+        { "help",       no_argument,        0, 'h' },
+        { 0, 0, 0, 0 }
+    };
+
+    int c;
+    while ((c = getopt_long(argc, argv, "n:f:p:i:a:s:S:m:h", longopts, 0)) != -1) {
+        switch (c) {
+            case 'n': nsectors = atoi(optarg); break;
+            case 'f': freqs = parse_list(optarg); break;
+            case 'p': kps = parse_list(optarg); break;
+            case 'i': kis = parse_list(optarg); break;
+            case 'a': alphas = parse_list(optarg); break;
+            case 's': spikes = parse_list(optarg); break;
+            case 'S': softs = parse_list(optarg); break;
+            case 'm': modulation = atoi(optarg) % MOD_COUNT; break;
+            case O_IDEAL: params = tape_channel_ideal(); break;
+            case O_PW50: params.pw50_us = atof(optarg); break;
+            case O_JITTER: params.jitter_us = atof(optarg); break;
+            case O_WOW: params.wow_pct = atof(optarg); break;
+            case O_FLUTTER: params.flutter_pct = atof(optarg); break;
+            case O_DC: params.dc_drift = atof(optarg); break;
+            case O_NOISE: params.noise_rms = atof(optarg); break;
+            case O_DROPOUTS: params.dropouts_per_s = atof(optarg); break;
+            case O_DROPOUT_MS: params.dropout_ms = atof(optarg); break;
+            case O_SEED: params.seed = strtoull(optarg, 0, 0); break;
+            case O_BITWISE: bitwise = true; break;
+            default: usage(); return c == 'h' ? 0 : 1;
+        }
+    }
+
+    if (kps.empty()) {
+        kps = { modulation_dll_kp(modulation) };
+    }
+
+    TapeChannel tape(params);
+    tape.record(record_sectors(0, nsectors, SECTOR_FORMAT, FEC_PROFILE, modulation));
+    tape.make_current();
+
+    printf("pw50 %.1fus jitter %.1fus wow %.2f%% flutter %.2f%% dc %.2f "
+           "noise %.2f dropouts %.2f/s x %.1fms, %s\n",
+            params.pw50_us, params.jitter_us, params.wow_pct, params.flutter_pct,
+            params.dc_drift, params.noise_rms, params.dropouts_per_s,
+            params.dropout_ms, modulation_name(modulation));
+    printf("%8s %8s %10s %8s %6s %4s %6s %6s %6s %8s %6s %6s %8s %8s %8s\n",
+            "freq", "Kp", "Ki", "alpha", "spike", "soft", "found", "read", "error",
+            "erased", "eblk", "sblk", "tape_s", "wall_s", "net_cps");
+
+    double total_tape_s = 0, total_wall_s = 0;
+    for (double freq : freqs) {
+        // TapeChannel's cells go at twice its mod_freq
+        params.mod_freq = (int)freq * modulation_cells(modulation) / 2;
+        for (double kp : kps) {
+            for (double ki : kis) {
+                for (double alpha : alphas) {
+                for (double spike : spikes) {
+                for (double soft : softs) {
+                    tape.set_params(params);
+
+                    readloop_params_t rp = bitwise
+                        ? default_readloop_params(TapeChannel::sampler, modulation)
+                        : default_readloop_params(TapeChannel::word_sampler, modulation);
+                    rp.Kp = kp;
+                    rp.Ki = ki;
+                    rp.alpha = alpha;
+                    rp.phase_spike = spike;
+                    rp.soft = soft != 0;
+                    reader_stats_t st = run_reader(rp, 0, 1000000, 1, modulation);
+
+                    double tape_s = tape.tape_seconds();
+                    double wall_s = st.wall_us * 1e-6;
+                    total_tape_s += tape_s;
+                    total_wall_s += wall_s;
+                    printf("%8d %8.4f %10.7f %8.4f %6.2f %4d %6d %6d %6d %8u %6u %6u %8.1f %8.2f %8.0f\n",
+                            (int)freq, kp, ki, alpha, spike, rp.soft,
+                            st.found, st.done, st.errors, st.erasures,
+                            st.erasure_blocks, st.soft_blocks, tape_s, wall_s,
+                            st.done * sector_user_data_sz / tape_s);
+                }
+                }
+                }
+            }
+        }
+    }
+    printf("%.0f s of tape in %.1f s\n", total_tape_s, total_wall_s);
+
+    return 0;
+}
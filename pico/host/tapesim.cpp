@@ -0,0 +1,226 @@
+#include <cmath>
+#include <limits>
+
+#include "config.h"
+#include "readloop.h"
+#include "tapesim.h"
+
+static TapeChannel * current_channel = nullptr;
+
+tape_channel_params_t tape_channel_ideal()
+{
+    tape_channel_params_t p = {};
+    p.mod_freq = MOD_FREQ;
+    p.samples_per_cell = MOD_HALFPERIOD;
+    p.wow_hz = 0.5;
+    p.flutter_hz = 10;
+    p.dc_drift_hz = 0.2;
+    p.dropout_ms = 2;
+    p.dropout_depth = 0.1;
+    p.hysteresis = 0.1;
+    p.seed = 1;
+    return p;
+}
+
+tape_channel_params_t tape_channel_default()
+{
+    tape_channel_params_t p = tape_channel_ideal();
+    p.pw50_us = 55;
+    p.jitter_us = 2;
+    p.wow_pct = 0.2;
+    p.flutter_pct = 0.1;
+    p.dc_drift = 0.05;
+    p.noise_rms = 0.12;
+    p.dropouts_per_s = 0.02;
+    p.dropout_ms = 3;
+    return p;
+}
+
+TapeChannel::TapeChannel(const tape_channel_params_t & params)
+{
+    set_params(params);
+}
+
+void TapeChannel::set_params(const tape_channel_params_t & params)
+{
+    p = params;
+
+    double cell_us = 1e6 / (2.0 * p.mod_freq);
+    double pw50 = p.pw50_us / cell_us;
+    jitter_cells = p.jitter_us / cell_us;
+
+    // arctan step normalised to reach exactly 0 and 1 at the window edges,
+    // so that transitions leave the window without a glitch
+    window = std::max(2.0, 6 * pw50) + 4 * jitter_cells;
+    lut.resize(2048);
+    lut_scale = (lut.size() - 1) / (2 * window);
+    double norm = pw50 > 0 ? std::atan(2 * window / pw50) : 1;
+    for (size_t i = 0; i < lut.size(); ++i) {
+        double u = i / lut_scale - window;
+        if (pw50 > 0) {
+            lut[i] = 0.5 + 0.5 * std::atan(2 * u / pw50) / norm;
+        }
+        else {
+            lut[i] = u >= 0 ? 1 : 0;
+        }
+    }
+
+    rewind();
+}
+
+void TapeChannel::record(const uint32_t * words, size_t count)
+{
+    for (size_t i = 0; i < count; ++i) {
+        for (int b = 31; b >= 0; --b) {
+            int level = (words[i] >> b) & 1;
+            if (ncells == 0) {
+                first_level = level;
+                last_level = level;
+            }
+            else if (level != last_level) {
+                transitions.push_back(transition_t{(uint32_t)ncells,
+                        (float)gaussian(), level ? 2.0f : -2.0f});
+                last_level = level;
+            }
+            ++ncells;
+        }
+    }
+}
+
+void TapeChannel::rewind()
+{
+    x = 0;
+    t = 0;
+    dt = 1.0 / (2.0 * p.mod_freq * p.samples_per_cell);
+    first = 0;
+    base = first_level ? 1 : -1;
+    out = first_level;
+    speed = 1;
+    dc = 0;
+    nsamples = 0;
+    rng = p.seed * 0x9E3779B97F4A7C15ull + 1;
+    next_dropout();
+}
+
+double TapeChannel::tape_seconds() const
+{
+    return ncells / (2.0 * p.mod_freq);
+}
+
+// xorshift64*
+double TapeChannel::uniform()
+{
+    rng ^= rng >> 12;
+    rng ^= rng << 25;
+    rng ^= rng >> 27;
+    return ((rng * 0x2545F4914F6CDD1Dull) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+// Irwin-Hall, good enough and cheap
+double TapeChannel::gaussian()
+{
+    return (uniform() + uniform() + uniform() + uniform() - 2.0) * 1.7320508;
+}
+
+double TapeChannel::exponential(double mean)
+{
+    return -mean * std::log(1.0 - uniform());
+}
+
+void TapeChannel::next_dropout()
+{
+    if (p.dropouts_per_s <= 0) {
+        dropout_start = dropout_end = std::numeric_limits<double>::infinity();
+        return;
+    }
+    dropout_start = t + exponential(1.0 / p.dropouts_per_s);
+    dropout_end = dropout_start + exponential(p.dropout_ms * 1e-3);
+}
+
+float TapeChannel::step_response(double u) const
+{
+    return lut[(size_t)((u + window) * lut_scale)];
+}
+
+uint32_t TapeChannel::sample()
+{
+    if (x >= ncells) {
+        return RL_BREAK;
+    }
+
+    // slow stuff is updated every 64 samples
+    if ((nsamples & 63) == 0) {
+        speed = 1 + p.wow_pct * 0.01 * std::sin(2 * M_PI * p.wow_hz * t)
+                  + p.flutter_pct * 0.01 * std::sin(2 * M_PI * p.flutter_hz * t + 1);
+        dc = p.dc_drift * std::sin(2 * M_PI * p.dc_drift_hz * t);
+    }
+    x += speed / p.samples_per_cell;
+    t += dt;
+    ++nsamples;
+
+    // transitions behind the window are fully developed
+    while (first < transitions.size() && position(first) < x - window) {
+        base += transitions[first].step;
+        ++first;
+    }
+    float level = base;
+    for (size_t k = first; k < transitions.size(); ++k) {
+        double u = x - position(k);
+        if (u <= -window) {
+            break;
+        }
+        level += transitions[k].step * step_response(u);
+    }
+
+    double s = level;
+    if (t >= dropout_start) {
+        if (t < dropout_end) {
+            s *= p.dropout_depth;
+        }
+        else {
+            next_dropout();
+        }
+    }
+    s += dc;
+    if (p.noise_rms > 0) {
+        s += p.noise_rms * gaussian();
+    }
+
+    if (out) {
+        if (s < -0.5 * p.hysteresis) out = 0;
+    }
+    else {
+        if (s > 0.5 * p.hysteresis) out = 1;
+    }
+
+    return out;
+}
+
+bool TapeChannel::sample_word(uint32_t * word)
+{
+    uint32_t w = 0;
+    for (int i = 0; i < 32; ++i) {
+        uint32_t bit = sample();
+        if (bit & RL_BREAK) {
+            return false;
+        }
+        w = (w << 1) | bit;
+    }
+    *word = w;
+    return true;
+}
+
+void TapeChannel::make_current()
+{
+    current_channel = this;
+}
+
+uint32_t TapeChannel::sampler()
+{
+    return current_channel->sample();
+}
+
+bool TapeChannel::word_sampler(uint32_t * word)
+{
+    return current_channel->sample_word(word);
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+// Simulated tape channel: takes the words that the firmware pushes into the
+// tx fifo and plays back the 1-bit oversampled stream that bitstream_rx
+// would sample from the read head.
+//
+// Readback model, in tape coordinates (cells as written):
+//   - every flux transition reads back as a Lorentzian step (arctan) of
+//     width pw50, neighbouring transitions interfere -> pattern bit-shift
+//   - transitions are jittered when written
+//   - playback speed wobbles with wow and flutter
+//   - dropouts attenuate the signal, DC drift and gaussian noise are added
+//   - a comparator with hysteresis makes it digital again
+//
+// Physical parameters are in microseconds of nominal tape time, so that the
+// same tape can be played at any mod_freq to find the density ceiling.
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+
+struct tape_channel_params_t {
+    int mod_freq;           // max flux reversal frequency, Hz (MOD_FREQ)
+    int samples_per_cell;   // rx samples per written bit (MOD_HALFPERIOD)
+
+    double pw50_us;         // readback step width, 0 = ideal
+    double jitter_us;       // rms random shift of written transitions
+    double wow_pct;         // peak speed deviation, %
+    double wow_hz;
+    double flutter_pct;
+    double flutter_hz;
+    double dc_drift;        // peak comparator offset, fraction of amplitude
+    double dc_drift_hz;
+    double noise_rms;       // fraction of amplitude
+    double dropouts_per_s;
+    double dropout_ms;      // mean dropout length
+    double dropout_depth;   // residual amplitude in a dropout
+    double hysteresis;      // comparator hysteresis, fraction of amplitude
+    uint64_t seed;
+};
+
+// a clean channel at MOD_FREQ
+tape_channel_params_t tape_channel_ideal();
+
+// hand-picked numbers that look plausible for a cassette deck, not
+// measured on the real thing
+tape_channel_params_t tape_channel_default();
+
+class TapeChannel {
+private:
+    struct transition_t {
+        uint32_t cell;  // where it was written
+        float jitter;   // normalised write jitter
+        float step;     // +2 or -2
+    };
+
+    tape_channel_params_t p;
+    std::vector<transition_t> transitions;
+    size_t ncells = 0;
+    int first_level = 0;
+    int last_level = 0;
+    double jitter_cells = 0;
+
+    // readback step, tabulated over the interference window
+    double window = 0;          // cells each side
+    double lut_scale = 0;
+    std::vector<float> lut;
+
+    // playback state
+    double x;                   // head position, cells
+    double t;                   // playback time, s
+    double dt;
+    size_t first;               // first transition in the window
+    float base;                 // level before the window
+    int out;                    // comparator output
+    double speed;               // relative to nominal
+    double dc;
+    double dropout_start, dropout_end;
+    uint64_t rng;
+    uint64_t nsamples;
+
+    double uniform();
+    double gaussian();
+    double exponential(double mean);
+    void next_dropout();
+    float step_response(double u) const;
+
+    double position(size_t k) const
+    {
+        return transitions[k].cell + transitions[k].jitter * jitter_cells;
+    }
+
+public:
+    TapeChannel(const tape_channel_params_t & params);
+
+    // append words as pushed into the tx fifo, msb first
+    void record(const uint32_t * words, size_t count);
+    void record(const std::vector<uint32_t> & words)
+    {
+        record(words.data(), words.size());
+    }
+
+    // start playback from the beginning, optionally at another density
+    void rewind();
+    void set_params(const tape_channel_params_t & params);
+    const tape_channel_params_t & params() const { return p; }
+
+    bool eot() const { return x >= ncells; }
+    uint64_t samples() const { return nsamples; }
+    double tape_seconds() const;
+    double playback_seconds() const { return t; }
+
+    // next sample, 0 or 1; RL_BREAK past the end of tape
+    uint32_t sample();
+
+    // next 32 samples packed msb first, as with RX_SAMPLES_PER_WORD 32;
+    // false past the end of tape
+    bool sample_word(uint32_t * word);
+
+    // readloop_bit_sampler_t and readloop_word_sampler_t playing the
+    // current channel
+    void make_current();
+    static uint32_t sampler();
+    static bool word_sampler(uint32_t * word);
+};
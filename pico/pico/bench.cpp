@@ -0,0 +1,222 @@
+#include <cstdio>
+#include <cstdint>
+#include <array>
+
+#include "pico/stdlib.h"
+#include "pico/time.h"
+
+#include "config.h"
+#include "bench.h"
+#include "mfm.h"
+#include "modulation.h"
+
+typedef uint32_t (*encode_t)(uint8_t, uint8_t, uint8_t *, uint8_t *);
+typedef void (*decode_t)(uint32_t, uint8_t *, uint8_t *, uint8_t *);
+typedef uint32_t (*violations_t)(uint32_t, uint32_t);
+
+struct codec_pair_t {
+    const char * name;
+    encode_t encode, encode_ref;
+    decode_t decode, decode_ref;
+    violations_t violations;
+};
+
+static const codec_pair_t codecs[] = {
+    { "mfm", mfm_encode_twobyte, mfm_encode_twobyte_bitwise,
+        mfm_decode_twobyte, mfm_decode_twobyte_bitwise, mfm_word_violations },
+    { "fm", fm_encode_twobyte, fm_encode_twobyte_bitwise,
+        fm_decode_twobyte, fm_decode_twobyte_bitwise, fm_word_violations },
+};
+
+// one sector worth of data
+constexpr size_t bench_bytes = 1024;
+static std::array<uint8_t, bench_bytes> bench_data;
+static std::array<uint32_t, bench_bytes / 2> bench_words;
+// a sector's stream in any modulation, with its flush words
+static std::array<uint32_t, bench_bytes / 2 + modulation_flush_max> sector_words;
+
+static uint32_t xorshift32(uint32_t & x)
+{
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+// every byte pair from every state, encoded and decoded back
+static bool check(const codec_pair_t & c)
+{
+    for (int state = 0; state < 4; ++state) {
+        // a word that ends in this state: last level and last data bit
+        uint32_t prev = (state & 1) | (((state & 1) ^ (state >> 1)) << 1);
+        for (int v = 0; v < 65536; ++v) {
+            uint8_t l1 = state & 1, p1 = state >> 1;
+            uint8_t l2 = l1, p2 = p1;
+            uint32_t w1 = c.encode(v >> 8, v & 255, &l1, &p1);
+            uint32_t w2 = c.encode_ref(v >> 8, v & 255, &l2, &p2);
+            if (w1 != w2 || l1 != l2 || (c.encode == mfm_encode_twobyte && p1 != p2)) {
+                printf("%s encode mismatch: %04x state %d: %08x %08x\n",
+                        c.name, v, state, w1, w2);
+                return false;
+            }
+            if (c.violations(prev, w1)) {
+                printf("%s clock violation: %04x state %d: %08x\n",
+                        c.name, v, state, w1);
+                return false;
+            }
+            uint8_t a1, a2, b1, b2;
+            uint8_t pl1 = state & 1, pl2 = state & 1;
+            c.decode(w1, &a1, &a2, &pl1);
+            c.decode_ref(w1, &b1, &b2, &pl2);
+            if (a1 != b1 || a2 != b2 || pl1 != pl2 || ((a1 << 8) | a2) != v) {
+                printf("%s decode mismatch: %04x -> %02x%02x %02x%02x\n",
+                        c.name, v, a1, a2, b1, b2);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// each measurement runs for this long
+constexpr uint64_t bench_us = 100000;
+
+static double time_encode(encode_t encode)
+{
+    uint64_t t0 = time_us_64(), t1;
+    int rounds = 0;
+    do {
+        uint8_t level = 1, prev_bit = 1;
+        for (size_t i = 0; i < bench_bytes; i += 2) {
+            bench_words[i / 2] = encode(bench_data[i], bench_data[i + 1],
+                    &level, &prev_bit);
+        }
+        ++rounds;
+        t1 = time_us_64();
+    } while (t1 - t0 < bench_us);
+    return (double)bench_bytes * rounds / (t1 - t0);
+}
+
+static double time_decode(decode_t decode)
+{
+    uint64_t t0 = time_us_64(), t1;
+    int rounds = 0;
+    uint8_t c1, c2;
+    do {
+        uint8_t prev_level = 1;
+        for (size_t i = 0; i < bench_bytes; i += 2) {
+            decode(bench_words[i / 2], &c1, &c2, &prev_level);
+            bench_data[i] = c1;
+            bench_data[i + 1] = c2;
+        }
+        ++rounds;
+        t1 = time_us_64();
+    } while (t1 - t0 < bench_us);
+    return (double)bench_bytes * rounds / (t1 - t0);
+}
+
+static double time_decode_bulk()
+{
+    uint64_t t0 = time_us_64(), t1;
+    int rounds = 0;
+    do {
+        mfm_decode_words(bench_words.begin(), bench_words.size(),
+                bench_data.begin());
+        ++rounds;
+        t1 = time_us_64();
+    } while (t1 - t0 < bench_us);
+    return (double)bench_bytes * rounds / (t1 - t0);
+}
+
+// whole sectors through a modulation's policy, as Bitstream and
+// SectorReader run them
+template <class M>
+static void encode_sector()
+{
+    typename M::encoder_t e;
+    M::encode_start(e, M::sync_data);
+    uint32_t * out = sector_words.begin();
+    for (size_t i = 0; i < bench_bytes; i += 2) {
+        out += M::encode_word(e, bench_data[i] << 8 | bench_data[i + 1], out);
+    }
+    M::encode_flush(e, out);
+}
+
+template <class M>
+static void decode_sector()
+{
+    M::decode_words(sector_words.begin(), bench_bytes / 2, 1, M::sync_data,
+            bench_data.begin(), 0);
+}
+
+static double time_sector(void (*f)())
+{
+    uint64_t t0 = time_us_64(), t1;
+    int rounds = 0;
+    do {
+        f();
+        ++rounds;
+        t1 = time_us_64();
+    } while (t1 - t0 < bench_us);
+    return (double)bench_bytes * rounds / (t1 - t0);
+}
+
+void bench_modulation()
+{
+
+    uint32_t seed = 0x1234567;
+    for (auto & b : bench_data) {
+        b = xorshift32(seed);
+    }
+
+    printf("%-6s %10s %10s %10s %10s   bytes/us\n", "codec",
+            "enc table", "enc bits", "dec table", "dec bits");
+    for (const auto & c : codecs) {
+        if (!check(c)) {
+            continue;
+        }
+        double et = time_encode(c.encode);
+        double eb = time_encode(c.encode_ref);
+        double dt = time_decode(c.decode);
+        double db = time_decode(c.decode_ref);
+        printf("%-6s %10.2f %10.2f %10.2f %10.2f   x%.1f x%.1f\n", c.name,
+                et, eb, dt, db, et / eb, dt / db);
+    }
+
+    // whole sector at once, as SectorReader does it
+    uint8_t level = 1, prev_bit = 1;
+    for (size_t i = 0; i < bench_bytes; i += 2) {
+        bench_words[i / 2] = mfm_encode_twobyte(bench_data[i], bench_data[i + 1],
+                &level, &prev_bit);
+    }
+    std::array<uint8_t, bench_bytes> expect = bench_data;
+    mfm_decode_words(bench_words.begin(), bench_words.size(), bench_data.begin());
+    if (bench_data != expect) {
+        printf("bulk decode mismatch\n");
+        return;
+    }
+    double dt = time_decode(mfm_decode_twobyte);
+    double dk = time_decode_bulk();
+    printf("sector decode: %.2f bytes/us per word, %.2f bulk  x%.1f\n",
+            dt, dk, dk / dt);
+
+    // every modulation, whole sectors both ways, and the raw bytes per
+    // second of tape at MOD_FREQ
+    printf("%-9s %10s %10s %10s\n", "sector", "encode", "decode", "raw B/s");
+    for (uint8_t m = 0; m < MOD_COUNT; ++m) {
+        bench_data = expect;
+        with_modulation(m, [&](auto mod) {
+            typedef decltype(mod) M;
+            encode_sector<M>();
+            decode_sector<M>();
+            if (bench_data != expect) {
+                printf("%-9s decode mismatch\n", M::name);
+                return;
+            }
+            double e = time_sector(encode_sector<M>);
+            double d = time_sector(decode_sector<M>);
+            printf("%-9s %10.2f %10.2f %10d\n", M::name, e, d,
+                    MOD_FREQ * M::cells / M::bits_per_byte);
+        });
+    }
+}
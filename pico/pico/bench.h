@@ -0,0 +1,7 @@
+#pragma once
+
+// on-target benchmarks, also built on the host
+
+// modulation codecs: table driven vs bit by bit, bytes per microsecond;
+// whole sectors in every modulation
+void bench_modulation();
@@ -1,5 +1,7 @@
 #include <cstdio>
 #include <cstdint>
+#include <cstring>
+#include <cmath>
 #include <array>
 #include <algorithm>
 #include <string>
@@ -13,7 +15,13 @@
 
 #include "bitstream.h"
 #include "readloop.h"
+#include "rxring.h"
+#include "txdma.h"
 #include "sectors.h"
+#include "sectorindex.h"
+#include "sectorcache.h"
+#include "writequeue.h"
+#include "reel.h"
 #include "tacho.h"
 
 #include "config.h"
@@ -38,12 +46,41 @@ volatile bool enable_print_sector_info = false;
 PIO pio = pio0;
 uint sm_tx = 0, sm_rx = 1;
 
+// head channel n: the state machine pair after channel n - 1's, two on a
+// pio; channel 0 is pio, sm_tx and sm_rx
+PIO channel_pio(int n)
+{
+    return n < 2 ? pio : pio1;
+}
+
+uint channel_sm_tx(int n)
+{
+    return sm_tx + 2 * (n & 1);
+}
+
+uint channel_sm_rx(int n)
+{
+    return sm_rx + 2 * (n & 1);
+}
+
+static const int channel_wrhead[] = {
+    GPIO_WRHEAD, GPIO_WRHEAD_1, GPIO_WRHEAD_2, GPIO_WRHEAD_3
+};
+static const int channel_rdhead[] = {
+    GPIO_RDHEAD, GPIO_RDHEAD_1, GPIO_RDHEAD_2, GPIO_RDHEAD_3
+};
+static_assert(sector_channels_max <= sizeof(channel_wrhead) / sizeof(channel_wrhead[0]),
+        "a gpio pair per head channel");
+
 int64_t start_time, end_time;
 
 
 //std::array<uint8_t, sector_data_sz> sector_buf;
 sector_data_t sector_buf;
-std::array<uint8_t, sector_payload_sz> decoded_buf;
+std::array<uint8_t, record_payload_max> decoded_buf;
+
+// rendered sectors, one is being written while the next one is prepared
+sector_words_t tx_words[2];
 
 // will it make it to flash?
 constexpr std::array<uint8_t, sector_payload_sz> zero_payload{};
@@ -58,6 +95,38 @@ uint32_t bitsampler_pio()
     return bitsampler_or | pio_sm_get_blocking(pio, sm_rx); // take next sample
 }
 
+// 32 samples at a time, needs RX_SAMPLES_PER_WORD 32
+bool bitsampler_pio_word(uint32_t * word)
+{
+    *word = pio_sm_get_blocking(pio, sm_rx);
+    return !(bitsampler_or & RL_BREAK);
+}
+
+readloop_params_t bitstream_readloop_params(uint8_t modulation)
+{
+    readloop_params_t params = {
+        .bitwidth = MOD_HALFPERIOD,
+        .Kp = modulation_dll_kp(modulation),
+        .Ki = DLL_KI,
+        .alpha = DLL_ALPHA,
+        .phase_spike = DLL_PHASE_SPIKE,
+        .soft = DLL_SOFT,
+    };
+    static_assert(!RX_DMA || RX_SAMPLES_PER_WORD == 32,
+            "RX_DMA needs packed samples");
+    if (RX_DMA) {
+        params.word_sampler = rxring_get;
+        params.channel_sampler = rxring_get_channel;
+    }
+    else if (RX_SAMPLES_PER_WORD == 32) {
+        params.word_sampler = bitsampler_pio_word;
+    }
+    else {
+        params.sampler = bitsampler_pio;
+    }
+    return params;
+}
+
 int count_errors(uint8_t * uncorrected, uint8_t * corrected, size_t sz)
 {
     int result = 0;
@@ -76,7 +145,15 @@ int count_errors(uint8_t * uncorrected, uint8_t * corrected, size_t sz)
 void core1_entry()
 {
     //printf("core1_entry\n");
-    readloop_delaylocked(SectorReader::readloop_callback_s, core1_reader);
+    core1_reader->restart();
+    int channels = core1_reader->get_channels();
+    if (channels == 1) {
+        readloop_delaylocked(core1_reader->readloop_callback(), core1_reader);
+    }
+    else {
+        readloop_delaylocked_channels(core1_reader->channel_callback(),
+                core1_reader->channel_users(), channels);
+    }
 
     multicore_fifo_push_blocking(TS_TERMINATE);
 }
@@ -116,23 +193,31 @@ void insanity_check()
 void Bitstream::init()
 {
     if (!initialized) {
-        // load pio programs
+        // load pio programs, into pio1 as well for channels 2 and 3
         // tx program loads 32-bit words and sends them 1 bit at a time every 8 clock cycles
-        this->offset_tx = pio_add_program(pio, &bitstream_tx_program);
-        printf("Transmit program loaded at %d\n", offset_tx);
-
         // rx program samples input on every clock cycle and outputs a word
-        this->offset_rx = pio_add_program(pio, &bitstream_rx_program);
-        printf("Receive program loaded at %d\n", offset_rx);
+        // every RX_SAMPLES_PER_WORD samples
+        for (int i = 0; i < (channels > 2 ? 2 : 1); ++i) {
+            PIO p = i ? pio1 : pio;
+            this->offset_tx[i] = pio_add_program(p, &bitstream_tx_program);
+            this->offset_rx[i] = pio_add_program(p, &bitstream_rx_program);
+            printf("pio%d: transmit program loaded at %d, receive at %d\n",
+                    pio_get_index(p), offset_tx[i], offset_rx[i]);
+        }
 
         uint32_t f_cpu = clock_get_hz(clk_sys);
 
         // calculate clkdiv to match desired MOD_FREQ
         // Fpio = MOD_FREQ * 2 * MOD_HALFPERIOD
         // Fsmp = Fpio / (8 / 2), e.g. 56000 for MOD_FREQ = 7000 for raw import
-        const float clkdiv = (float)f_cpu/(MOD_FREQ * 2 * MOD_HALFPERIOD);
+        // that is for mfm, 2 cells to the shortest interval: fm has 1 and
+        // rll(2,7) 3, the cells go slower or faster and the samples with
+        // them, the dll doesn't know
+        const float clkdiv = (float)f_cpu/(MOD_FREQ * modulation_cells(modulation)
+                * MOD_HALFPERIOD);
 
-        printf("CPU frequency: %d clkdiv=%f\n", f_cpu, clkdiv);
+        printf("CPU frequency: %d clkdiv=%f %s\n", f_cpu, clkdiv,
+                modulation_name(modulation));
 
         //printf("TESTING GPIO_WRHEAD\n");
         //gpio_init(this->gpio_wrhead);
@@ -142,9 +227,17 @@ void Bitstream::init()
         //gpio_put(this->gpio_wrhead, 0);
         //printf("DONE\n");
 
-
-        bitstream_tx_program_init(pio, sm_tx, offset_tx, gpio_wrhead, clkdiv);
-        bitstream_rx_program_init(pio, sm_rx, offset_rx, gpio_rdhead, clkdiv);
+        for (int ch = 0; ch < channels; ++ch) {
+            PIO p = channel_pio(ch);
+            int i = pio_get_index(p) != pio_get_index(pio);
+            bitstream_tx_program_init(p, channel_sm_tx(ch), offset_tx[i],
+                    ch ? channel_wrhead[ch] : gpio_wrhead, clkdiv);
+            bitstream_rx_program_init(p, channel_sm_rx(ch), offset_rx[i],
+                    ch ? channel_rdhead[ch] : gpio_rdhead, clkdiv, RX_SAMPLES_PER_WORD);
+            if (TX_DMA) {
+                txdma_init(p, channel_sm_tx(ch), ch);
+            }
+        }
 
         gpio_init(this->gpio_wren);
         gpio_put(this->gpio_wren, 0); // 0 = read
@@ -164,20 +257,70 @@ void Bitstream::init()
     bitsampler_or = 0;
 }
 
+Bitstream::~Bitstream()
+{
+    deinit();
+}
+
 void Bitstream::deinit()
 {
     if (initialized) {
+        rxring_stop();
+        txdma_deinit();
+
         // shut down PIO
-        pio_sm_set_enabled(pio, sm_tx, false);
-        pio_sm_set_enabled(pio, sm_rx, false);
-        pio_remove_program(pio, &bitstream_tx_program, offset_tx);
-        pio_remove_program(pio, &bitstream_rx_program, offset_rx);
-        pio_clear_instruction_memory(pio);
+        for (int ch = 0; ch < channels; ++ch) {
+            pio_sm_set_enabled(channel_pio(ch), channel_sm_tx(ch), false);
+            pio_sm_set_enabled(channel_pio(ch), channel_sm_rx(ch), false);
+        }
+        for (int i = 0; i < (channels > 2 ? 2 : 1); ++i) {
+            PIO p = i ? pio1 : pio;
+            pio_remove_program(p, &bitstream_tx_program, offset_tx[i]);
+            pio_remove_program(p, &bitstream_rx_program, offset_rx[i]);
+            pio_clear_instruction_memory(p);
+        }
 
         initialized = false;
     }
 }
 
+void Bitstream::set_channels(int channels)
+{
+    // the rx state machines of other channels are read from their rings
+    channels = RX_DMA ? std::min(std::max(channels, 1), sector_channels_max) : 1;
+    if (channels != this->channels) {
+        deinit();
+        this->channels = channels;
+    }
+}
+
+void Bitstream::set_modulation(uint8_t modulation)
+{
+    modulation = modulation < MOD_COUNT ? modulation : (uint8_t)MOD_MFM;
+    if (modulation != this->modulation) {
+        deinit();
+        this->modulation = modulation;
+    }
+}
+
+void Bitstream::rx_start()
+{
+    for (int ch = 0; ch < channels; ++ch) {
+        pio_sm_set_enabled(channel_pio(ch), channel_sm_rx(ch), true);
+        pio_sm_clear_fifos(channel_pio(ch), channel_sm_rx(ch));
+        if (RX_DMA) {
+            rxring_start(channel_pio(ch), channel_sm_rx(ch), ch, channels);
+        }
+    }
+}
+
+void Bitstream::tx_start()
+{
+    for (int ch = 0; ch < channels; ++ch) {
+        pio_sm_set_enabled(channel_pio(ch), channel_sm_tx(ch), true);
+    }
+}
+
 // switch on write head
 void Bitstream::write_enable(bool enable)
 {
@@ -193,45 +336,145 @@ void Bitstream::read_led(bool on)
 
 void Bitstream::write_bot()
 {
-    for (size_t i = 0; i < BOT_LEADER_LEN; ++i) {
-        pio_sm_put_blocking(pio, sm_tx, LEADER);
-        pio_sm_put_blocking(pio, sm_tx, LEADER);
-        pio_sm_put_blocking(pio, sm_tx, LEADER);
-        pio_sm_put_blocking(pio, sm_tx, LEADER);
+    uint32_t leader = modulation_leader(modulation);
+    if (TX_DMA) {
+        txdma_fill(leader, BOT_LEADER_LEN * 4, channels);
+        return;
+    }
+    for (size_t i = 0; i < BOT_LEADER_LEN * 4; ++i) {
+        for (int ch = 0; ch < channels; ++ch) {
+            pio_sm_put_blocking(channel_pio(ch), channel_sm_tx(ch), leader);
+        }
+    }
+}
+
+void Bitstream::write_words(const uint32_t * words, size_t count)
+{
+    size_t stride = channel_words_max(channels);
+    if (TX_DMA) {
+        txdma_write(words, count, channels, stride);
+        return;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        for (int ch = 0; ch < channels; ++ch) {
+            pio_sm_put_blocking(channel_pio(ch), channel_sm_tx(ch), words[ch * stride + i]);
+        }
     }
 }
 
-void Bitstream::write_sector_data(SectorWriter& writer, const uint8_t * data,
-        size_t data_sz)
+void Bitstream::write_wait()
+{
+    if (TX_DMA) {
+        txdma_wait();
+    }
+}
+
+template <class M>
+size_t Bitstream::render_sector_data_m(SectorWriter& writer, const uint8_t * data,
+        size_t data_sz, uint32_t * words)
 {
     // copy source data to sector buffer and compute parity
+    writer.set_format(format, profile);
     writer.prepare(data, data_sz);
 
-    // data leader
-    for (size_t i = 0; i < DATA_LEADER_LEN; ++i) {
-        pio_sm_put_blocking(pio, sm_tx, LEADER);
+    // data word w goes to channel w % channels, a channel with a word less
+    // makes up for it in the trailer
+    size_t stride = channel_words_max(channels);
+    size_t data_words = writer.size() / 2;
+    size_t nwords = sector_channel_words(data_words, channels, 0);
+
+    for (int ch = 0; ch < channels; ++ch) {
+        uint32_t * out = words + ch * stride;
+
+        // data leader
+        for (size_t i = 0; i < DATA_LEADER_LEN; ++i) {
+            *out++ = M::leader;
+        }
+        // data sync E3
+        *out++ = M::sync_data;
+
+        // the meat of the sector and the flush words
+        typename M::encoder_t enc;
+        M::encode_start(enc, M::sync_data);
+        for (size_t i = 2 * ch; i < writer.size(); i += 2 * channels) {
+            out += M::encode_word(enc, writer[i] << 8 | writer[i + 1], out);
+        }
+        out += M::encode_flush(enc, out);
+
+        for (size_t i = sector_channel_words(data_words, channels, ch);
+                i < nwords + SECTOR_TRAILER_LEN; ++i) {
+            *out++ = M::leader;
+        }
     }
-    // data sync E3
-    pio_sm_put_blocking(pio, sm_tx, SYNC_DATA);
 
-    // the meat of the sector
-    uint8_t mfm_cur_level = 1, mfm_prev_bit = 1;
-    for (size_t i = 0; i < writer.size(); i += 2) {
-        uint32_t mfm_encoded = modulate(writer[i], writer[i + 1],
-                &mfm_cur_level, &mfm_prev_bit);
-        pio_sm_put_blocking(pio, sm_tx, mfm_encoded);
+    return DATA_LEADER_LEN + 1 + nwords + M::flush_words + SECTOR_TRAILER_LEN;
+}
+
+size_t Bitstream::render_sector_data(SectorWriter& writer, const uint8_t * data,
+        size_t data_sz, uint32_t * words)
+{
+    return with_modulation(modulation, [&](auto m) {
+        return render_sector_data_m<decltype(m)>(writer, data, data_sz, words);
+    });
+}
+
+template <class M>
+size_t Bitstream::render_sector_m(SectorWriter & writer, uint16_t sector_num,
+        const uint8_t * data, size_t data_sz, uint32_t * words)
+{
+    // sector header: profile, format and sector number, repeated
+    // SECTOR_NUM_REPEATS times as one stream, the same on every channel
+    static_assert(M::flush_words <= modulation_flush_max, "header words");
+    uint16_t header = sector_header(format, profile, sector_num);
+    std::array<uint32_t, SECTOR_NUM_REPEATS + modulation_flush_max> header_words;
+    typename M::encoder_t enc;
+    M::encode_start(enc, M::sync_sector);
+    uint32_t * hout = header_words.begin();
+    for (size_t i = 0; i < SECTOR_NUM_REPEATS; ++i) {
+        hout += M::encode_word(enc, header, hout);
     }
+    hout += M::encode_flush(enc, hout);
+    size_t nheader = hout - header_words.begin();
+
+    size_t stride = channel_words_max(channels);
+    for (int ch = 0; ch < channels; ++ch) {
+        uint32_t * out = words + ch * stride;
+
+        // sector leader
+        for (size_t i = 0; i < SECTOR_LEADER_LEN; ++i) {
+            *out++ = M::leader;
+        }
+        // sector sync C7
+        *out++ = M::sync_sector;
 
-    for (size_t i = 0; i < SECTOR_TRAILER_LEN; ++i) {
-        pio_sm_put_blocking(pio, sm_tx, LEADER);
+        out = std::copy_n(header_words.begin(), nheader, out);
     }
+
+    size_t nwords = SECTOR_LEADER_LEN + 1 + nheader;
+    return nwords + render_sector_data_m<M>(writer, data, data_sz, words + nwords);
+}
+
+size_t Bitstream::render_sector(SectorWriter & writer, uint16_t sector_num,
+        const uint8_t * data, size_t data_sz, uint32_t * words)
+{
+    return with_modulation(modulation, [&](auto m) {
+        return render_sector_m<decltype(m)>(writer, sector_num, data, data_sz, words);
+    });
+}
+
+void Bitstream::write_sector(SectorWriter & writer, uint16_t sector_num,
+        const uint8_t * data, size_t data_sz)
+{
+    uint32_t * words = tx_words[0].begin();
+    write_words(words, render_sector(writer, sector_num, data, data_sz, words));
+    write_wait();
 }
 
 void Bitstream::llformat()
 {
 
     init();
-    pio_sm_set_enabled(pio, sm_tx, true);
+    tx_start();
 
     sanity_check();
     insanity_check();
@@ -258,6 +501,18 @@ void Bitstream::llformat()
         }
     }
 
+    // the edge at EOT is where the format before ended, unknown the first
+    // time; the profile goes back to the chosen one at the end
+    int end_sectors = sector_index_count();
+    uint8_t chosen = profile;
+    auto edge = [&](int sector_num) {
+        return sector_num < FEC_EDGE_SECTORS
+            || (end_sectors > 0 && sector_num >= end_sectors - FEC_EDGE_SECTORS);
+    };
+
+    printf("Sector format: %s, fec %s, %s at the ends, %d head channel%s\n",
+            sector_format_name(format), fec_profile_name(chosen),
+            fec_profile_name(FEC_EDGE_PROFILE), channels, channels > 1 ? "s" : "");
     printf("Press any key to abort...\n");
     tacho_set_counter(0);
     wheel.play();
@@ -276,32 +531,39 @@ void Bitstream::llformat()
     write_enable(true);
     write_bot();
 
+    // a new format, sectors are wherever they get written now
+    sector_index_clear();
+    sector_cache_clear();
+    reel_fit_begin();
+
+    // double buffered: sector n goes out while n + 1 is encoded
+    int buf = 0;
+    profile = edge(0) ? (uint8_t)FEC_EDGE_PROFILE : chosen;
+    size_t nwords = render_sector(writer, 0, zero_payload.begin(),
+            zero_payload.size(), tx_words[buf].begin());
+
     for (uint16_t sector_num = 0; ; ++sector_num) {
         printf("Counter: %d Sector: %d\n", tacho_get_counter(),
                 sector_num);
+        sector_index_update(sector_num, tacho_get_counter());
+        reel_fit_add(sector_num, tacho_get_counter());
 
-        // sector leader
-        for (size_t i = 0; i < SECTOR_LEADER_LEN; ++i) {
-            pio_sm_put_blocking(pio, sm_tx, LEADER);
-        }
-        // sector sync C7
-        pio_sm_put_blocking(pio, sm_tx, SYNC_SECTOR);
+        write_words(tx_words[buf].begin(), nwords);
 
-        // 16-bit sector number repeated SECTOR_NUM_REPEATS times
-        uint8_t mfm_cur_level = 1, mfm_prev_bit = 1;
-        uint32_t mfm_encoded = modulate(sector_num >> 8, sector_num & 255,
-                &mfm_cur_level, &mfm_prev_bit);
-        for (size_t i = 0; i < SECTOR_NUM_REPEATS; ++i) {
-            pio_sm_put_blocking(pio, sm_tx, mfm_encoded);
-        }
-
-        write_sector_data(writer, zero_payload.begin(), zero_payload.size());
+        buf ^= 1;
+        profile = edge(sector_num + 1) ? (uint8_t)FEC_EDGE_PROFILE : chosen;
+        nwords = render_sector(writer, sector_num + 1, zero_payload.begin(),
+                zero_payload.size(), tx_words[buf].begin());
 
         // check end conditions
         if (wheel.get_position() != WP_PLAY) {
             printf("EOT\n");
             break;
         }
+        if (sector_num + 1 == sector_num_max) {
+            printf("out of sector numbers\n");
+            break;
+        }
 
         int c = getchar_timeout_us(0); 
         if (c != PICO_ERROR_TIMEOUT) {
@@ -310,9 +572,18 @@ void Bitstream::llformat()
         }
     }
 
+    write_wait();
     write_enable(false);
+    profile = chosen;
 
     deinit();
+
+    if (reel_fit_end()) {
+        printf("reel model: sector %.1f at 0, %.1f at %d\n", reel_position(0),
+                reel_position(tacho_get_counter()), tacho_get_counter());
+    }
+    sector_index_save();
+    reel_save();
 }
 
 void sizeof_checks()
@@ -324,67 +595,586 @@ void sizeof_checks()
     printf("sector_payload_sz: %d\n", sector_payload_sz);
 }
 
-void Bitstream::replace_sector_data(uint16_t sector_num, const uint8_t * data, size_t data_sz)
+bool Bitstream::wind_to(int counter)
+{
+    int dir = counter > tacho_get_counter() ? 1 : -1;
+
+    mainloop_request = 0;
+    if ((dir > 0 ? wheel.ff() : wheel.rew()) != 0) {
+        return false;
+    }
+
+    int start_ctr = tacho_get_counter();
+    uint32_t start_ms = to_ms_since_boot(get_absolute_time());
+
+    while ((counter - tacho_get_counter()) * dir > 0) {
+        // autostop: the reel stopped turning, that's the end of tape
+        if (mainloop_request == ' ') {
+            wheel.stop();
+            return false;
+        }
+        if (getchar_timeout_us(0) != PICO_ERROR_TIMEOUT) {
+            wheel.stop();
+            return false;
+        }
+        sleep_ms(1);
+    }
+
+    int stop_ctr = tacho_get_counter();
+    uint32_t ms = to_ms_since_boot(get_absolute_time()) - start_ms;
+
+    // play() puts reel_backlash() on the counter, the coast is without it
+    wheel.play();
+    wound = dir;
+    int coast = (tacho_get_counter() - reel_backlash(dir) - stop_ctr) * dir;
+    reel_wind_observe(dir, (stop_ctr - start_ctr) * dir, ms, coast);
+
+    return true;
+}
+
+bool Bitstream::seek(uint16_t sector_num)
+{
+    int target;
+    if (!sector_index_predict(sector_num, &target)) {
+        warning_println("seek %d: not in the sector index", sector_num);
+        return false;
+    }
+
+    int ctr = tacho_get_counter();
+    reel_plan_t plan = reel_plan(ctr, target);
+    info_println("seek %d: counter %d, sector at %d, %s to %d, %d ms", sector_num,
+            ctr, target, plan.wind > 0 ? "ff" : plan.wind < 0 ? "rew" : "play",
+            plan.counter, plan.ms);
+
+    if (plan.wind != 0) {
+        if (!wind_to(plan.counter)) {
+            warning_println("seek %d: stopped at %d", sector_num, tacho_get_counter());
+            return false;
+        }
+    }
+    else {
+        wheel.play();
+    }
+
+    return true;
+}
+
+void Bitstream::sector_found(uint16_t sector_num)
+{
+    int ctr = tacho_get_counter();
+    int expected;
+
+    // right after a wind the counter is only as good as the backlash
+    // estimate, the first known sector tells how far off it is and puts
+    // it right; the sector index learns from the sectors after that
+    if (wound != 0 && sector_index_predict(sector_num, &expected)) {
+        reel_backlash_observe(wound, ctr - expected);
+        tacho_set_counter(expected);
+        wound = 0;
+        return;
+    }
+
+    sector_index_update(sector_num, ctr);
+}
+
+// the readers of write_pass() and write_track() only look at headers, the
+// writer has sector_buf to itself
+size_t Bitstream::render_data(const uint8_t * data, size_t data_sz, uint8_t sector_format,
+        uint8_t fec_profile, uint32_t * words)
 {
-    SectorReader reader(sector_buf, decoded_buf.begin());
     SectorWriter writer(sector_buf);
+    uint8_t saved_format = format, saved_profile = profile;
+    format = sector_format;
+    profile = fec_profile;
+    size_t nwords = render_sector_data(writer, data, data_sz, words);
+    format = saved_format;
+    profile = saved_profile;
+    return nwords;
+}
 
-    writer.prepare(data, data_sz);
+size_t Bitstream::render_queued(const write_queue_entry_t * e, uint8_t sector_format,
+        uint8_t fec_profile, uint32_t * words)
+{
+    return render_data(e->data, e->data_sz, sector_format, fec_profile, words);
+}
 
-    bool write = false;
+int Bitstream::write_pass()
+{
+    SectorReader reader(sector_buf, decoded_buf.begin(), channels, modulation);
+    reader.set_headers_only(true);
+
+    const write_queue_entry_t * target = write_queue_at(0);
+    if (!target) {
+        return 0;
+    }
+
+    // rendered ahead: the data leader starts right after the header, there
+    // is no time for encoding once the sector is found; in the layout of
+    // the last header that came by, llformat wrote regions of the same
+    int buf = 0;
+    int target_num = target->sector_num;
+    uint8_t guess_format = format, guess_profile = profile;
+    size_t nwords = render_queued(target, guess_format, guess_profile,
+            tx_words[buf].begin());
+    uint8_t rendered_format = guess_format, rendered_profile = guess_profile;
 
     init();
 
-    pio_sm_set_enabled(pio, sm_rx, true);
-    pio_sm_set_enabled(pio, sm_tx, true);
-    pio_sm_clear_fifos(pio, sm_rx);
+    rx_start();
+    tx_start();
     read_led(true);
 
-    readloop_setparams(
-            {
-            .bitwidth = MOD_HALFPERIOD,
-            .Kp = 0.0333,
-            .Ki = 0.000001,
-            .alpha = 0.1,
-            .sampler = bitsampler_pio
-            });
+    readloop_setparams(bitstream_readloop_params(modulation));
+
+    if (!seek(target_num)) {
+        wheel.play();
+    }
 
     core1_reader = &reader;
     multicore_launch_core1(core1_entry);
-    sleep_ms(10);
 
+    constexpr uint64_t pop_timeout_us = 100 * 1000;
+    constexpr uint32_t timeout_max = 4000000 / pop_timeout_us;
+    uint32_t timeout_ctr = 0;
+
+    int written = 0;
     uint32_t out;
-    int c;
-    for(int i = 0; i < 45*60*10; ++i) {
-        if (multicore_fifo_pop_timeout_us(100000ULL, &out)) {
-            if (out == TS_TERMINATE) {
-                break;
+    while (target && timeout_ctr < timeout_max) {
+        if (!multicore_fifo_pop_timeout_us(pop_timeout_us, &out)) {
+            ++timeout_ctr;
+            continue;
+        }
+        timeout_ctr = 0;
+
+        if (out == TS_TERMINATE) {
+            break;
+        }
+        if ((out & 0xffff0000) != MSG_SECTOR_FOUND) {
+            continue;
+        }
+
+        uint16_t found_num = out & 0xffff;
+        sector_found(found_num);
+
+        // core1 is on to the data part, the next header is a sector away
+        uint8_t found_format = reader.sector_format, found_profile = reader.sector_profile;
+        bool sector = found_format < SF_COUNT && found_format != SF_TRACK;
+        if (sector) {
+            guess_format = found_format;
+            guess_profile = found_profile;
+        }
+
+        if (found_num == target_num) {
+            multicore_reset_core1();
+
+            // the data goes in the layout that the header says; track
+            // records are written by write_track()
+            bool write = sector;
+            if (write && (found_format != rendered_format || found_profile != rendered_profile)) {
+                warning_println("sector %d format %d fec %d, rendering again", target_num,
+                        found_format, found_profile);
+                nwords = render_queued(target, found_format, found_profile,
+                        tx_words[buf].begin());
             }
-            else if ((out & 0xffff0000) == MSG_SECTOR_FOUND) {
-                uint16_t found_num = out & 0xffff;
-                printf("found: %d\n", found_num);
 
-                if (found_num == sector_num) {
-                    write = true;
-                    break;
+            if (write) {
+                write_enable(true);
+                write_words(tx_words[buf].begin(), nwords);
+            }
+
+            // the next one is encoded while this one goes out; one that
+            // isn't written stays queued, flush_writes() tells
+            if (write) {
+                write_queue_remove(target_num);
+            }
+            target = write_queue_next(target_num + 1);
+            buf ^= 1;
+            if (target) {
+                target_num = target->sector_num;
+                nwords = render_queued(target, guess_format, guess_profile,
+                        tx_words[buf].begin());
+                rendered_format = guess_format;
+                rendered_profile = guess_profile;
+            }
+
+            if (write) {
+                write_wait();
+                write_enable(false);
+                sector_cache_invalidate(found_num);
+                info_println("written: %d", found_num);
+                ++written;
+            }
+            else {
+                error_println("sector %d: bad header or a track record, not written, "
+                        "still queued", found_num);
+            }
+
+            if (target) {
+                if (RX_DMA) {
+                    rxring_flush();
                 }
+                multicore_launch_core1(core1_entry);
             }
         }
-        c = getchar_timeout_us(0);
-        if (c != PICO_ERROR_TIMEOUT) {
+        else if (found_num > target_num) {
+            // missed it, it waits for the next pass
+            target = write_queue_next(found_num);
+            if (target) {
+                target_num = target->sector_num;
+                nwords = render_queued(target, guess_format, guess_profile,
+                        tx_words[buf].begin());
+                rendered_format = guess_format;
+                rendered_profile = guess_profile;
+            }
+        }
+        else if (guess_format != rendered_format || guess_profile != rendered_profile) {
+            // coming up to it through another region, there's time now
+            nwords = render_queued(target, guess_format, guess_profile,
+                    tx_words[buf].begin());
+            rendered_format = guess_format;
+            rendered_profile = guess_profile;
+        }
+
+        if (getchar_timeout_us(0) != PICO_ERROR_TIMEOUT) {
             break;
-        }        
+        }
     }
+
+    wheel.stop();
+    read_led(false);
     multicore_reset_core1();
+    deinit();
+
+    return written;
+}
+
+bool Bitstream::write_track(uint16_t track_num, const uint8_t * data)
+{
+    if (!record_format_built(SF_TRACK)) {
+        error_println("track records are not built, see RECORD_FORMATS");
+        return false;
+    }
+
+    SectorReader reader(sector_buf, decoded_buf.begin(), channels, modulation);
+    reader.set_headers_only(true);
+
+    // rendered ahead like in write_pass()
+    size_t nwords = render_data(data, track_user_data_sz, SF_TRACK, profile,
+            tx_words[0].begin());
+
+    init();
+
+    rx_start();
+    tx_start();
+    read_led(true);
+
+    readloop_setparams(bitstream_readloop_params(modulation));
+
+    if (!seek(track_num)) {
+        wheel.play();
+    }
+
+    core1_reader = &reader;
+    multicore_launch_core1(core1_entry);
+
+    constexpr uint64_t pop_timeout_us = 100 * 1000;
+    constexpr uint32_t timeout_max = 4000000 / pop_timeout_us;
+    uint32_t timeout_ctr = 0;
+
+    bool written = false;
+    int retries = 2;
+    uint32_t out;
+    while (timeout_ctr < timeout_max) {
+        if (!multicore_fifo_pop_timeout_us(pop_timeout_us, &out)) {
+            ++timeout_ctr;
+            continue;
+        }
+        timeout_ctr = 0;
+
+        if (out == TS_TERMINATE) {
+            break;
+        }
+        if ((out & 0xffff0000) != MSG_SECTOR_FOUND) {
+            continue;
+        }
+
+        uint16_t found_num = out & 0xffff;
+        sector_found(found_num);
+
+        if (found_num == track_num) {
+            multicore_reset_core1();
+            if (reader.sector_format == SF_TRACK) {
+                if (reader.sector_profile != profile) {
+                    warning_println("track %d fec %d, rendering again", track_num,
+                            reader.sector_profile);
+                    nwords = render_data(data, track_user_data_sz, SF_TRACK,
+                            reader.sector_profile, tx_words[0].begin());
+                }
+                write_enable(true);
+                write_words(tx_words[0].begin(), nwords);
+                write_wait();
+                write_enable(false);
+                info_println("written: track %d", found_num);
+                written = true;
+            }
+            else {
+                error_println("%d is not a track record, not written", found_num);
+            }
+            break;
+        }
+        else if (found_num > track_num) {
+            if (retries-- == 0) {
+                break;
+            }
+            multicore_reset_core1();
+            multicore_fifo_drain();
+            seek(track_num);
+            if (RX_DMA) {
+                rxring_flush();
+            }
+            multicore_launch_core1(core1_entry);
+        }
+
+        if (getchar_timeout_us(0) != PICO_ERROR_TIMEOUT) {
+            break;
+        }
+    }
+
+    wheel.stop();
     read_led(false);
+    multicore_reset_core1();
+    deinit();
+
+    sector_index_save();
+    reel_save();
+
+    return written;
+}
+
+bool Bitstream::queue_write(uint16_t sector_num, const uint8_t * data, size_t data_sz)
+{
+    if (write_queue_full() && !write_queue_find(sector_num)) {
+        flush_writes();
+    }
+    return write_queue_put(sector_num, data, data_sz);
+}
+
+int Bitstream::flush_writes()
+{
+    int written = 0;
+    for (int pass = 0; pass < 3 && write_queue_size() > 0; ++pass) {
+        written += write_pass();
+    }
+    if (write_queue_size() > 0) {
+        error_println("%d sectors not written", write_queue_size());
+    }
+
+    // not between sectors: no interrupts and no reading while flash is written
+    sector_index_save();
+    reel_save();
+
+    return written;
+}
+
+bool Bitstream::replace_sector_data(uint16_t sector_num, const uint8_t * data, size_t data_sz)
+{
+    if (!queue_write(sector_num, data, data_sz)) {
+        error_println("sector %d: write queue full", sector_num);
+        return false;
+    }
+    flush_writes();
+    return !write_queue_find(sector_num);
+}
+
+bool Bitstream::read_sector(uint16_t sector_num, uint8_t * payload, int read_ahead)
+{
+    // not on tape yet, but that's what it will read like
+    if (const write_queue_entry_t * e = write_queue_find(sector_num)) {
+        chunk_payload_t * chunks = reinterpret_cast<chunk_payload_t *>(payload);
+        for (size_t i = 0; i < FEC_BLOCKS_PER_SECTOR; ++i) {
+            size_t from = std::min(e->data_sz, i * payload_data_sz);
+            size_t n = std::min(e->data_sz - from, payload_data_sz);
+            memcpy(chunks[i].data, e->data + from, n);
+            memset(chunks[i].data + n, 0, payload_data_sz - n);
+            chunks[i].crc16 = calculate_crc(chunks[i].data, payload_data_sz);
+        }
+        return true;
+    }
+
+    if (sector_cache_get(sector_num, payload)) {
+        return true;
+    }
+
+    return read_record(sector_num, payload, false, read_ahead);
+}
+
+bool Bitstream::read_track(uint16_t track_num, uint8_t * data)
+{
+    if (!record_format_built(SF_TRACK)) {
+        error_println("track records are not built, see RECORD_FORMATS");
+        return false;
+    }
+    return read_record(track_num, data, true, 0);
+}
+
+bool Bitstream::read_record(uint16_t sector_num, uint8_t * payload, bool track,
+        int read_ahead)
+{
+    SectorReader reader(sector_buf, decoded_buf.begin(), channels, modulation);
+    init();
+
+    rx_start();
+    read_led(true);
+
+    readloop_setparams(bitstream_readloop_params(modulation));
+
+    // no index: read from wherever the tape is
+    if (!seek(sector_num)) {
+        wheel.play();
+    }
+
+    core1_reader = &reader;
+    multicore_launch_core1(core1_entry);
+
+    constexpr uint64_t pop_timeout_us = 100 * 1000;
+    constexpr uint32_t timeout_max = 4000000 / pop_timeout_us;
+    uint32_t timeout_ctr = 0;
+
+    bool done = false;
+    int retries = 2;
+    uint32_t out;
+    while (timeout_ctr < timeout_max) {
+        if (!multicore_fifo_pop_timeout_us(pop_timeout_us, &out)) {
+            ++timeout_ctr;
+            continue;
+        }
+        timeout_ctr = 0;
+
+        bool reseek = false;
+        if (out == TS_TERMINATE) {
+            break;
+        }
+        else if ((out & 0xffff0000) == MSG_SECTOR_FOUND) {
+            sector_found(out & 0xffff);
+        }
+        else if ((out & 0xffff0000) == MSG_SECTOR_READ_DONE) {
+            uint16_t num = out & 0xffff;
+            bool is_track = reader.record_format == SF_TRACK;
+            if (!is_track) {
+                sector_cache_put(num, decoded_buf.begin());
+            }
+            if (num == sector_num && is_track != track) {
+                error_println("%d is a %s", num, is_track ? "track" : "sector");
+                break;
+            }
+            if (num == sector_num) {
+                memcpy(payload, decoded_buf.begin(),
+                        track ? track_user_data_sz : sector_payload_sz);
+                done = true;
+            }
+            else if (num > sector_num && !done) {
+                reseek = true;  // went past it
+            }
+            // read-ahead: sectors after it come almost for free
+            if (done && (track || num >= sector_num + read_ahead)) {
+                break;
+            }
+        }
+        else if ((out & 0xffff0000) == MSG_SECTOR_READ_ERROR) {
+            uint16_t num = out & 0xffff;
+            if (done) {
+                break;          // no retries for read-ahead
+            }
+            reseek = num >= sector_num;
+        }
 
-    if (write) {
-        write_enable(true);
-        write_sector_data(writer, data, data_sz);
-        write_enable(false);
+        if (reseek) {
+            if (retries-- == 0) {
+                break;
+            }
+            multicore_reset_core1();
+            multicore_fifo_drain();
+            seek(sector_num);
+            if (RX_DMA) {
+                rxring_flush();
+            }
+            multicore_launch_core1(core1_entry);
+        }
+
+        if (getchar_timeout_us(0) != PICO_ERROR_TIMEOUT) {
+            break;
+        }
     }
 
+    wheel.stop();
+    read_led(false);
+    multicore_reset_core1();
     deinit();
+
+    return done;
+}
+
+int Bitstream::serve(IoScheduler & sched)
+{
+    static io_dispatch_t batch[IOSCHED_QUEUE_LEN];
+
+    int failed = 0;
+    io_run_t run;
+    for (int n; (n = sched.next(lroundf(reel_position(tacho_get_counter())),
+                    &run, batch)) > 0; ) {
+        info_println("run %d..%d: %d requests, seek %d%s", run.first, run.last, n,
+                run.seek, run.forced ? ", starving" : "");
+
+        // the read and write paths are separate, a piece of the run with
+        // both takes a write pass and then a play for the reads; a sector
+        // that is read and written ends a piece, see io_piece_end()
+        for (int from = 0, to; from < n; from = to) {
+            to = io_piece_end(batch, from, n);
+
+            bool writes = false;
+            for (int i = from; i < to; ++i) {
+                const io_request_t & r = batch[i].req;
+                if (r.op == IO_WRITE) {
+                    if (!queue_write(r.sector_num, r.buf, r.data_sz)) {
+                        error_println("sector %d: write queue full", r.sector_num);
+                        ++failed;
+                        continue;
+                    }
+                    writes = true;
+                }
+            }
+            if (writes) {
+                flush_writes();
+                // still queued after the passes: not on tape
+                for (int i = from; i < to; ++i) {
+                    const io_request_t & r = batch[i].req;
+                    if (r.op == IO_WRITE && write_queue_find(r.sector_num)) {
+                        ++failed;
+                    }
+                }
+            }
+
+            // read-ahead to the end of the run, later reads are cache hits
+            for (int i = from; i < to; ++i) {
+                const io_request_t & r = batch[i].req;
+                if (r.op == IO_READ && !read_sector(r.sector_num, r.buf,
+                            std::min(run.last - r.sector_num, SECTOR_CACHE_SECTORS - 1))) {
+                    ++failed;
+                }
+            }
+        }
+    }
+
+    const io_sched_stats_t & st = sched.stats();
+    if (st.requests) {
+        info_println("served %d requests in %d runs (%d starving), depth %d, "
+                "seek %d sectors, wait %d runs max %d", (int)st.requests, (int)st.runs,
+                (int)st.forced, (int)(st.depth_sum / st.requests),
+                (int)(st.seek_sum / st.requests), (int)(st.wait_sum / st.requests),
+                st.max_wait);
+    }
+
+    return failed;
 }
 
 void Bitstream::dump_raw_sector_data()
@@ -414,21 +1204,13 @@ void Bitstream::sector_scan(uint16_t sector_num)
 
     sizeof_checks();
 
-    SectorReader reader(sector_buf, decoded_buf.begin());
+    SectorReader reader(sector_buf, decoded_buf.begin(), channels, modulation);
     init();
 
-    pio_sm_set_enabled(pio, sm_rx, true);
-    pio_sm_clear_fifos(pio, sm_rx);
+    rx_start();
     read_led(true);
 
-    readloop_setparams(
-            {
-            .bitwidth = MOD_HALFPERIOD,
-            .Kp = 0.0333,
-            .Ki = 0.000001,
-            .alpha = 0.1,
-            .sampler = bitsampler_pio
-            });
+    readloop_setparams(bitstream_readloop_params(modulation));
 
     core1_reader = &reader;
     multicore_launch_core1(core1_entry);
@@ -461,6 +1243,7 @@ void Bitstream::sector_scan(uint16_t sector_num)
                 info_println("found: %d (%d) ctr: %d sector_time: %d", 
                         found_num, retry_sector, ctr, ctr - prev_ctr);
 
+                sector_found(found_num);
                 prev_ctr = ctr;
             }
             else if ((out & 0xffff0000) == MSG_SECTOR_READ_DONE) {
@@ -483,6 +1266,10 @@ void Bitstream::sector_scan(uint16_t sector_num)
                     }
                 }
 
+                if (reader.record_format != SF_TRACK) {
+                    sector_cache_put(sector_num, decoded_buf.begin());
+                }
+
                 // if all is well, be happy abou tit
                 if (retry_sector == -1) {
                     info_println("read_done: %d", sector_num);
@@ -519,8 +1306,12 @@ void Bitstream::sector_scan(uint16_t sector_num)
                     sleep_ms(1);
                 }
                 wheel.play();
+                wound = -1;
 
-                // relaunch core1 reader
+                // relaunch core1 reader, without what was read while winding
+                if (RX_DMA) {
+                    rxring_flush();
+                }
                 multicore_launch_core1(core1_entry);
             }
         }
@@ -544,12 +1335,24 @@ void Bitstream::sector_scan(uint16_t sector_num)
     if (c == 'd') {
         readloop_dump_debugbuf();
     }
+    if (RX_DMA) {
+        info_println("rx ring overruns: %d", rxring_overruns());
+    }
+    if (RS_ERASURES) {
+        info_println("erasures: %d bytes, %d blocks decoded with them, %d on soft decisions",
+                (int)reader.erasures, (int)reader.erasure_blocks, (int)reader.soft_blocks);
+    }
 
     wheel.stop();
 
     read_led(false);
     multicore_reset_core1();
     deinit();
+
+    if (sector_index_save()) {
+        info_println("sector index saved, %d sectors", sector_index_count());
+    }
+    reel_save();
 }
 
 void Bitstream::test_write()
@@ -563,11 +1366,15 @@ void Bitstream::test_write()
 
     uint16_t sector_num = 1;
     while (data_sz > 0) {
-        replace_sector_data(sector_num, data, data_sz);
-        data += payload_data_sz * FEC_BLOCKS_PER_SECTOR;
-        data_sz -= payload_data_sz * FEC_BLOCKS_PER_SECTOR;
+        if (!queue_write(sector_num, data, std::min<ssize_t>(data_sz, sector_user_data_sz))) {
+            printf("sector %d: write queue full\n", sector_num);
+            break;
+        }
+        data += sector_user_data_sz;
+        data_sz -= sector_user_data_sz;
         ++sector_num;
     }
+    flush_writes();
 
     printf("done\n");
 }
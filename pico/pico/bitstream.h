@@ -4,6 +4,8 @@
 #include "wheel.h"
 #include "correct.h"
 #include "sectors.h"
+#include "writequeue.h"
+#include "iosched.h"
 
 // for testing
 constexpr int BS_TX = 1;
@@ -20,16 +22,72 @@ private:
     int gpio_read_led;
     int gpio_write_led;
     bool initialized;
-    uint offset_tx, offset_rx;
+    uint offset_tx[2], offset_rx[2];    // on pio0 and pio1
+    uint8_t format;     // sector_format_t written by llformat and render_sector
+    uint8_t profile;    // fec_profile_t the same, llformat puts FEC_EDGE_PROFILE
+                        // at the ends of the tape
+    int wound;          // direction of the last wind until a sector is found
+    int channels;       // head channels in use, see set_channels()
+    uint8_t modulation; // modulation_t written and read, see set_modulation()
 
     // switch to write mode
     void write_enable(bool enable);
     void read_led(bool on);
 
+    // start the state machines of all channels: rx with their rings, tx
+    // waiting for words
+    void rx_start();
+    void tx_start();
+
     void write_bot();
 
-    // write the inner part of a sector: LEADER, DATA SYNC, DATA + PARITY
-    void write_sector_data(SectorWriter & writer, const uint8_t * data, size_t data_sz);
+    // send words to tx: by dma with TX_DMA, returns when the transfer is
+    // started; words must stay untouched until the next write_words().
+    // count words on each channel, channel n's channel_words_max() * n
+    // words further on
+    void write_words(const uint32_t * words, size_t count);
+    void write_wait();
+
+    // render the inner part of a sector: LEADER, DATA SYNC, DATA + PARITY
+    // into sector_data_words words, returns the number of words; with
+    // several channels each gets its share of the data words, at
+    // channel_words_max() apart, the count is of each
+    size_t render_sector_data(SectorWriter & writer, const uint8_t * data,
+            size_t data_sz, uint32_t * words);
+
+    // the same and render_sector() in modulation M, see modulation.h; the
+    // public ones pick it from modulation once per sector
+    template <class M> size_t render_sector_data_m(SectorWriter & writer,
+            const uint8_t * data, size_t data_sz, uint32_t * words);
+    template <class M> size_t render_sector_m(SectorWriter & writer,
+            uint16_t sector_num, const uint8_t * data, size_t data_sz,
+            uint32_t * words);
+
+    // ff or rew until the tacho counter reaches counter, then play; false
+    // if the wheel stopped on its own (tape end) or a key was pressed
+    bool wind_to(int counter);
+
+    // MSG_SECTOR_FOUND: refine the sector index, or after a wind correct
+    // the counter and the backlash estimate
+    void sector_found(uint16_t sector_num);
+
+    // render the data part of a record in sector_format and fec_profile
+    size_t render_data(const uint8_t * data, size_t data_sz, uint8_t sector_format,
+            uint8_t fec_profile, uint32_t * words);
+
+    // render the data part of a queued sector in sector_format and fec_profile
+    size_t render_queued(const write_queue_entry_t * e, uint8_t sector_format,
+            uint8_t fec_profile, uint32_t * words);
+
+    // one pass from the first queued sector on: the data part of every
+    // queued sector that comes by is written after its header, missed ones
+    // stay in the queue; returns the number written
+    int write_pass();
+
+    // read_sector() and read_track() from tape: a sector's payload or the
+    // user data of a track record into payload
+    bool read_record(uint16_t sector_num, uint8_t * payload, bool track,
+            int read_ahead);
 
     void dump_raw_sector_data();
     void dump_decoded_sector_data();
@@ -39,7 +97,9 @@ public:
             int gpio_read_led, int gpio_write_led)
       : wheel(wheel), gpio_rdhead(gpio_rdhead), gpio_wrhead(gpio_wrhead),
         gpio_wren(gpio_wren), gpio_read_led(gpio_read_led),
-        gpio_write_led(gpio_write_led), initialized(false) {}
+        gpio_write_led(gpio_write_led), initialized(false),
+        format(SECTOR_FORMAT), profile(FEC_PROFILE), wound(0),
+        channels(TAPE_CHANNELS), modulation(MODULATION) {}
     ~Bitstream();
 
     void init();   // prepare hardware and algorithms
@@ -50,8 +110,78 @@ public:
     //void test_sector_rewrite();
     void llformat();
 
+    // sector layout for llformat and render_sector, see sector_format_t;
+    // replace_sector_data follows whatever the sector on tape has. One
+    // that isn't built (RECORD_FORMATS) is ignored
+    void set_format(uint8_t format) {
+        if (record_format_built(format)) {
+            this->format = format;
+        }
+    }
+    uint8_t get_format() const { return format; }
+
+    // fec profile the same way, see fec_profile_t and RECORD_PROFILES
+    void set_profile(uint8_t profile) {
+        if (fec_profile_built(profile)) {
+            this->profile = profile;
+        }
+    }
+    uint8_t get_profile() const { return profile; }
+
+    // head channels that every record is striped over, a state machine
+    // pair each: a tape is read with as many as it was written with; more
+    // than one takes RX_DMA
+    void set_channels(int channels);
+    int get_channels() const { return channels; }
+
+    // modulation of everything written and read, see modulation_t: the
+    // cell clock goes with it, a tape is read with the one it was written
+    // with; takes effect at the next init()
+    void set_modulation(uint8_t modulation);
+    uint8_t get_modulation() const { return modulation; }
+
+    // render a complete sector: LEADER, SECTOR SYNC, sector number, then
+    // the data part as in render_sector_data(), into sector_words words
+    size_t render_sector(SectorWriter & writer, uint16_t sector_num,
+            const uint8_t * data, size_t data_sz, uint32_t * words);
+
+    // render and write a complete sector, returns when it is in the tx
+    // fifo; tx must be running
+    void write_sector(SectorWriter & writer, uint16_t sector_num,
+            const uint8_t * data, size_t data_sz);
+
+    // wind to a little before sector_num using the sector index and play,
+    // reading is left to the caller; false if the index has no idea where
+    // the sector is or winding was cut short
+    bool seek(uint16_t sector_num);
+
+    // payload of sector_num, sector_payload_sz bytes: from the sector cache
+    // or from tape, then read_ahead sectors after it are read into the
+    // cache while the tape is moving anyway; false if it can't be read
+    bool read_sector(uint16_t sector_num, uint8_t * payload,
+            int read_ahead = SECTOR_READ_AHEAD);
+
+    // SF_TRACK records, track_user_data_sz bytes of data: one record at a
+    // time, not cached or queued; the record must be formatted as a track
+    bool read_track(uint16_t track_num, uint8_t * data);
+    bool write_track(uint16_t track_num, const uint8_t * data);
+
+    // run everything pending in sched: reads of a run in one play, writes
+    // in one write pass; returns the number of requests that failed, a
+    // write that isn't on tape stays queued
+    int serve(IoScheduler & sched);
+
     void sector_scan(uint16_t sector_num);
-    void replace_sector_data(uint16_t sector_num, const uint8_t * data, size_t data_sz);
+
+    // write-back: queue_write() only keeps the data, flushing first if the
+    // queue is full, false if it's still full; flush_writes() writes the
+    // queue in sector order in as few tape passes as it can, returns the
+    // number of sectors written, the rest stays queued
+    bool queue_write(uint16_t sector_num, const uint8_t * data, size_t data_sz);
+    int flush_writes();
+
+    // queue_write() and flush_writes() for one sector; true once it's on tape
+    bool replace_sector_data(uint16_t sector_num, const uint8_t * data, size_t data_sz);
 
     void test_write();
 };
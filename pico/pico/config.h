@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstdint>
+
 /* time in milliseconds before motor turns off after STOP */
 #define MOTOR_OFF_DELAY 1500
 
@@ -16,6 +18,14 @@
 #define GPIO_RDHEAD 17  // pi pico pin 22, yellow wire
 #define GPIO_WREN   18  // 1 = write, 0 = read
 
+// heads of the other channels of a stereo or 4-track head, see TAPE_CHANNELS
+#define GPIO_WRHEAD_1   10
+#define GPIO_RDHEAD_1   11
+#define GPIO_WRHEAD_2   12
+#define GPIO_RDHEAD_2   13
+#define GPIO_WRHEAD_3   14
+#define GPIO_RDHEAD_3   15
+
 #define GPIO_TACHO 19
 
 #define MOD_HALFPERIOD  8     // number of clocks per half-period in modulation
@@ -28,8 +38,58 @@
                               //      8000 feels good until it isn't
                               // fm:  6600 ok
                               // debugbuf raw-to-samplerate = MOD_FREQ*4
+#define RX_SAMPLES_PER_WORD 32  // rx autopush threshold: 32 = packed samples,
+                                // 1 = one sample per fifo word (old way)
+#define RX_DMA          1       // drain rx by dma into a ring, see rxring.h
+                                // needs RX_SAMPLES_PER_WORD 32
+#define RX_RING_WORDS   2048    // power of two, 0.58s at MOD_FREQ 7000
+#define TX_DMA          1       // feed tx by dma from rendered sectors, see txdma.h
+// delay-locked loop tuning, see readloop_delaylocked()
+#define DLL_KP          0.0333
+#define DLL_KP_RLL      0.006   // rll(2,7): reversals up to 8 cells apart, a
+                                // stiffer loop slips a cell after the long runs
+#define DLL_KI          0.000001
+#define DLL_ALPHA       0.1
+#define DLL_PHASE_SPIKE 0.45    // phase error in bit cells that flags a byte
+                                // as an erasure, 0 = off
+#define RS_ERASURES     1       // decode with erasures: bytes with mfm/fm clock
+                                // violations or dll phase spikes
+#define DLL_SOFT        1       // dll soft decisions: blocks that fail to decode
+                                // are retried erasing their least confident bytes
+
 #define SOLENOID_PULSE_MS 25
 
+// sector index, reel model and seek, see sectorindex.h, reel.h and
+// Bitstream::seek()
+#define SECTOR_INDEX_FLASH_OFFSET (PICO_FLASH_SIZE_BYTES - 16 * 1024)
+#define REEL_FLASH_OFFSET   (PICO_FLASH_SIZE_BYTES - 4 * 1024)
+#define SEEK_LEAD_SECTORS   2   // land this many sectors before the target
+#define REEL_COUNTS_PER_SECTOR 9    // until fitted, a C60 is ~13270 counts
+#define REEL_WIND_RATE      150 // ff/rew counts per second until measured
+#define REEL_SWITCH_MS      1500 // play -> ff/rew -> stop -> play overhead
+#define REEL_FIT_MIN_SECTORS 16
+
+// static buffers that grow with the settings here: debugbuf, the rx ring,
+// the record buffers, the write queue, the usb stages and the sector cache,
+// checked in sectorcache.cpp; the rest of the 264 KB is the sdk, tinyusb,
+// the sector index, the stacks and the heap
+#define RAM_BUFFERS_BUDGET  (200 * 1024)
+
+// decoded sectors kept in ram, 892 bytes each, see sectorcache.h
+#define SECTOR_CACHE_SECTORS 16
+#define SECTOR_READ_AHEAD   4   // sectors read past the one asked for
+#define WRITE_QUEUE_SECTORS 8   // write-back queue, 884 bytes each, see writequeue.h;
+                                // a full one is flushed before the next write
+#define IOSCHED_COALESCE_GAP 4  // sectors closer than this are read in one run
+#define IOSCHED_MAX_RUN     32  // sectors in a run
+#define IOSCHED_MAX_WAIT    64  // runs before a request jumps the queue
+
+// usb mass storage, see usbmsc.h
+#define MSC_STAGE_SECTORS   4   // sectors the usb callbacks can see, 884 bytes of
+                                // user data each and a 892 byte payload to load it
+#define MSC_WRITEBACK_MS    2000 // staged writes go to tape after this long without writes
+#define MSC_REPORT_MS       1000 // stats on the second cdc this often
+
 #define GPIO_READ_LED   8
 #define GPIO_WRITE_LED  7
 #define GPIO_ACT_LED    9
@@ -39,31 +99,39 @@
 #define DATA_LEADER_LEN     8
 #define SECTOR_TRAILER_LEN  8
 
-#define CODEC_MFM 1
-
-#ifdef CODEC_MFM
-#define modulate    mfm_encode_twobyte
-#define demodulate  mfm_decode_twobyte
-#endif
-
-#ifdef CODEC_FM
-#define modulate    fm_encode_twobyte
-#define demodulate  fm_decode_twobyte
+#define SECTOR_NUM_REPEATS  4
+#define SECTOR_FORMAT   SF_LINEAR       // layout written by llformat, see
+                                        // sector_format_t in sectors.h; the
+                                        // layout of old tapes, SF_INTERLEAVED
+                                        // takes bursts better
+#define MODULATION      MOD_MFM         // written and read, see modulation_t
+                                        // in modulation.h
+#define FEC_PROFILE     FEC_STANDARD    // fec strength written by llformat, see
+                                        // fec_profile_t in sectors.h; (255, 223)
+                                        // as on old tapes
+#define FEC_EDGE_PROFILE FEC_PROFILE    // ...in the first and last FEC_EDGE_SECTORS,
+#define FEC_EDGE_SECTORS 24             // where tape is stretched and creased:
+                                        // FEC_STRONG there for worn tapes
+// records the buffers have room for, a bit per sector_format_t and per
+// fec_profile_t; others are read as bad records and can't be written.
+// SF_TRACK takes ~40 KB more ram, FEC_CONCAT ~10 KB
+#ifndef RECORD_FORMATS
+#define RECORD_FORMATS  ((1 << SF_LINEAR) | (1 << SF_INTERLEAVED) | (1 << SECTOR_FORMAT))
 #endif
-
-// not modulated, these words are written bit by bit
-#ifdef CODEC_FM
-constexpr uint32_t LEADER = 0xAAAAAAAA;
-constexpr uint32_t SYNC   = 0xAAA1A1A1;
+#ifndef RECORD_PROFILES
+#define RECORD_PROFILES ((1 << FEC_STANDARD) | (1 << FEC_LIGHT) | (1 << FEC_PROFILE) \
+                        | (1 << FEC_EDGE_PROFILE))
 #endif
-
-#ifdef CODEC_MFM
-constexpr uint32_t LEADER       = 0xCCCCCCCC;
-constexpr uint32_t SYNC_SECTOR  = 0xCCCCCCC7;
-constexpr uint32_t SYNC_DATA    = 0xCCCCCCE3;
+#define TAPE_CHANNELS   1               // head channels a sector is striped over,
+                                        // 2 on a stereo head, up to 4: a pio state
+                                        // machine pair each; see sector_channel_words()
+#ifndef TAPE_CHANNELS_MAX
+#define TAPE_CHANNELS_MAX TAPE_CHANNELS // set_channels() goes up to this, the tx
+                                        // buffers and per-channel state are sized
+                                        // for it
 #endif
 
-#define SECTOR_NUM_REPEATS  4
-
 // number of subblocks in sector
 constexpr uint32_t FEC_BLOCKS_PER_SECTOR = 4;
+// ...in a SF_TRACK record: 23 * 223 = 5129 bytes hold a 5 * 1024 MicroDOS track
+constexpr uint32_t FEC_BLOCKS_PER_TRACK = 23;
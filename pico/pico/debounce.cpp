@@ -17,7 +17,7 @@ alarm_id_t alarm_id;
 
 int64_t alarm_callback(alarm_id_t id, void * user_data)
 {
-    uint32_t gpio = (uint32_t)user_data;
+    uint32_t gpio = (uint32_t)(uintptr_t)user_data;
     uint32_t mask = ~(1 << gpio);
 
     debob.value = (debob.value & mask) | (gpio_get(gpio) << gpio);
@@ -39,7 +39,7 @@ void debounce_gpio_cb(uint gpio, uint32_t events)
     // see gpio_irq_level
     switch (1 & (debob.state >> gpio)) {
         case 0:
-            alarm_id = add_alarm_in_ms(10, alarm_callback, (void *)gpio, false);
+            alarm_id = add_alarm_in_ms(10, alarm_callback, (void *)(uintptr_t)gpio, false);
             debob.state |= 1 << gpio;
             break;
         case 1:
@@ -0,0 +1,106 @@
+#include <cstdint>
+#include <cstdlib>
+#include <algorithm>
+
+#include "iosched.h"
+
+int io_piece_end(const io_dispatch_t * out, int from, int n)
+{
+    // out is in sector order, a sector's requests are next to each other
+    int to = from + 1;
+    while (to < n && !(out[to].req.sector_num == out[to - 1].req.sector_num
+                && out[to].req.op != out[to - 1].req.op)) {
+        ++to;
+    }
+    return to;
+}
+
+bool IoScheduler::submit(const io_request_t & req)
+{
+    if (count == IOSCHED_QUEUE_LEN) {
+        return false;
+    }
+    queue[count] = entry_t{req, runs, count + 1};
+    ++count;
+    st.max_depth = std::max(st.max_depth, count);
+    return true;
+}
+
+int IoScheduler::lowest_from(int from) const
+{
+    int best = -1;
+    for (int i = 0; i < count; ++i) {
+        int s = queue[i].req.sector_num;
+        if (s >= from && (best < 0 || s < queue[best].req.sector_num)) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+int IoScheduler::next(int head, io_run_t * run, io_dispatch_t * out)
+{
+    if (count == 0) {
+        return 0;
+    }
+
+    // oldest first in the queue: entries keep submit order
+    int start = -1;
+    bool forced = runs - queue[0].arrival >= (uint32_t)params.max_wait;
+    if (forced) {
+        start = 0;
+    }
+    else {
+        start = lowest_from(head);
+        if (start < 0) {
+            start = lowest_from(0);     // end of sweep, rewind
+        }
+    }
+
+    int first = queue[start].req.sector_num;
+    int last = first;
+    for (int i; (i = lowest_from(last + 1)) >= 0; ) {
+        int s = queue[i].req.sector_num;
+        if (s - last > params.coalesce_gap || s - first >= params.max_run) {
+            break;
+        }
+        last = s;
+    }
+
+    *run = io_run_t{first, last, first - head, forced};
+
+    // take the run's requests out, the rest keep their order
+    int n = 0, kept = 0;
+    for (int i = 0; i < count; ++i) {
+        const entry_t & e = queue[i];
+        if (e.req.sector_num >= first && e.req.sector_num <= last) {
+            int wait = runs - e.arrival;
+            out[n++] = io_dispatch_t{e.req, e.depth, wait, 0};
+            st.depth_sum += e.depth;
+            st.wait_sum += wait;
+            st.max_wait = std::max(st.max_wait, wait);
+        }
+        else {
+            queue[kept++] = e;
+        }
+    }
+    count = kept;
+
+    std::stable_sort(out, out + n, [](const io_dispatch_t & a, const io_dispatch_t & b) {
+            return a.req.sector_num < b.req.sector_num;
+        });
+
+    int pos = head;
+    for (int i = 0; i < n; ++i) {
+        out[i].seek = out[i].req.sector_num - pos;
+        pos = out[i].req.sector_num;
+        st.seek_sum += std::abs(out[i].seek);
+    }
+
+    st.requests += n;
+    st.runs += 1;
+    st.forced += forced;
+    ++runs;
+
+    return n;
+}
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <array>
+
+// sector i/o request scheduler
+//
+// the tape reads and writes in one direction only, so requests are served
+// C-LOOK style: in sector order from wherever the head is, then one rewind
+// to the lowest pending sector; pending sectors close to each other are
+// coalesced into one run that is played through without stopping
+// a request that has waited max_wait runs goes next whatever its position
+//
+// knows nothing about the hardware: positions are sector numbers, time is
+// counted in runs; Bitstream::serve() executes the runs, bench_sched on the
+// host runs synthetic workloads through it
+
+#ifndef IOSCHED_QUEUE_LEN
+#define IOSCHED_QUEUE_LEN 32
+#endif
+
+enum io_op_t : uint8_t {
+    IO_READ = 0,
+    IO_WRITE,
+};
+
+struct io_request_t {
+    int sector_num;
+    io_op_t op;
+    uint32_t id;        // caller's
+    uint8_t * buf;      // read: sector_payload_sz bytes, write: data
+    size_t data_sz;     // write data size
+};
+
+// a request handed out by next(), with what it cost
+struct io_dispatch_t {
+    io_request_t req;
+    int depth;          // queue depth when it was submitted, itself included
+    int wait;           // runs dispatched before this one
+    int seek;           // sectors the head went from the request before, < 0 back
+};
+
+// sectors first..last played through in one go
+struct io_run_t {
+    int first;
+    int last;
+    int seek;           // first - head
+    bool forced;        // started at a starving request
+};
+
+struct io_sched_params_t {
+    int coalesce_gap;   // pending sectors at most this far apart share a run
+    int max_run;        // sectors in a run, at most
+    int max_wait;       // starvation bound in runs
+};
+
+struct io_sched_stats_t {
+    uint32_t requests;  // served
+    uint32_t runs;
+    uint32_t forced;    // runs started by the starvation bound
+    uint64_t depth_sum;
+    uint64_t seek_sum;  // |seek| of every request, the whole way the head went
+    uint64_t wait_sum;
+    int max_depth;
+    int max_wait;
+};
+
+// where the piece of out[from..n) that can go in one write pass and one
+// play ends: the writes of a piece go to tape before its reads, so a
+// sector that is read and written in a run ends the piece where its op
+// changes, reads see what was written before them and not after
+int io_piece_end(const io_dispatch_t * out, int from, int n);
+
+class IoScheduler {
+private:
+    struct entry_t {
+        io_request_t req;
+        uint32_t arrival;   // runs at submit
+        int depth;
+    };
+
+    io_sched_params_t params;
+    std::array<entry_t, IOSCHED_QUEUE_LEN> queue;
+    int count = 0;
+    uint32_t runs = 0;
+    io_sched_stats_t st = {};
+
+    // pending entry with the lowest sector >= from, -1 if none
+    int lowest_from(int from) const;
+
+public:
+    IoScheduler(io_sched_params_t params) : params(params) {}
+
+    // false if the queue is full
+    bool submit(const io_request_t & req);
+
+    // take the next run for the head at sector head: fills run, and out
+    // with the requests in it in sector order (reads and writes of the same
+    // sector in submit order); returns their number, 0 if nothing is pending
+    // out must have room for IOSCHED_QUEUE_LEN
+    int next(int head, io_run_t * run, io_dispatch_t * out);
+
+    int pending() const { return count; }
+    const io_sched_stats_t & stats() const { return st; }
+};
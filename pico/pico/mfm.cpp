@@ -1,8 +1,180 @@
 #include <cstdint>
 #include <cstdio>
+#include <array>
+
+#include "mfm.h"
+
+// Table driven codecs. Levels are symmetric: encoding from level 1 gives
+// the complement of encoding from level 0, so the encoder tables are built
+// for level 0 and the result is flipped. A data bit is decoded from the
+// pair (clock, data) of levels alone, every byte of the encoded word holds
+// two whole pairs, so the decoder does not need prev_level at all.
+
+// [prev_bit][byte] -> 16 mfm levels starting from level 0
+static constexpr std::array<std::array<uint16_t, 256>, 2> mfm_encode_table = [] {
+    std::array<std::array<uint16_t, 256>, 2> t{};
+    for (int prev_bit = 0; prev_bit < 2; ++prev_bit) {
+        for (int c = 0; c < 256; ++c) {
+            int level = 0, lastbit = prev_bit;
+            uint16_t mfm = 0;
+            for (int i = 7; i >= 0; --i) {
+                int bit = (c >> i) & 1;
+                int clock = level;
+                if (bit == 0 && lastbit == 0) {
+                    clock = 1 - level;
+                }
+                level = bit ? 1 - clock : clock;
+                mfm = (mfm << 2) | (clock << 1) | level;
+                lastbit = bit;
+            }
+            t[prev_bit][c] = mfm;
+        }
+    }
+    return t;
+}();
+
+// [byte] -> 16 fm levels starting from level 0
+static constexpr std::array<uint16_t, 256> fm_encode_table = [] {
+    std::array<uint16_t, 256> t{};
+    for (int c = 0; c < 256; ++c) {
+        int level = 0;
+        uint16_t fm = 0;
+        for (int i = 7; i >= 0; --i) {
+            int clock = 1 - level;
+            level = (c >> i) & 1 ? clock ^ 1 : clock;
+            fm = (fm << 2) | (clock << 1) | level;
+        }
+        t[c] = fm;
+    }
+    return t;
+}();
+
+// [4 level pairs] -> 4 data bits, same for fm and mfm
+static constexpr std::array<uint8_t, 256> decode_table = [] {
+    std::array<uint8_t, 256> t{};
+    for (int b = 0; b < 256; ++b) {
+        uint8_t nib = 0;
+        for (int i = 3; i >= 0; --i) {
+            int pair = (b >> (i * 2)) & 3;
+            nib = (nib << 1) | (pair == 1 || pair == 2);
+        }
+        t[b] = nib;
+    }
+    return t;
+}();
+
+static inline uint32_t decode_word(uint32_t w)
+{
+    return (decode_table[w >> 24] << 12) | (decode_table[(w >> 16) & 255] << 8)
+        | (decode_table[(w >> 8) & 255] << 4) | decode_table[w & 255];
+}
+
+uint32_t mfm_encode_twobyte(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit)
+{
+    uint32_t flip = *cur_level ? 0xffff : 0;
+    uint32_t hi = mfm_encode_table[*prev_bit][c1] ^ flip;
+    flip = (hi & 1) ? 0xffff : 0;
+    uint32_t lo = mfm_encode_table[c1 & 1][c2] ^ flip;
+
+    *prev_bit = c2 & 1;
+    *cur_level = lo & 1;
+    return (hi << 16) | lo;
+}
+
+void mfm_decode_twobyte(uint32_t mfm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level)
+{
+    uint32_t tb = decode_word(mfm);
+    *prev_level = mfm & 1;
+    *c1 = tb >> 8;
+    *c2 = tb & 0xff;
+}
 
-// fm doesn't need prev_bit, but nice to have it for uniformity
 uint32_t fm_encode_twobyte(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit)
+{
+    uint32_t flip = *cur_level ? 0xffff : 0;
+    uint32_t hi = fm_encode_table[c1] ^ flip;
+    flip = (hi & 1) ? 0xffff : 0;
+    uint32_t lo = fm_encode_table[c2] ^ flip;
+
+    *cur_level = lo & 1;
+    return (hi << 16) | lo;
+}
+
+void fm_decode_twobyte(uint32_t fm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level)
+{
+    uint32_t tb = decode_word(fm);
+    *prev_level = fm & 1;
+    *c1 = tb >> 8;
+    *c2 = tb & 0xff;
+}
+
+// Bulk decode: reversals between clock and data cells land on the even
+// bits, which are then squeezed together. No tables and no dependency
+// between words, so the host compiler vectorises it; unrolled for the M0+.
+void mfm_decode_words(const uint32_t * words, size_t count, uint8_t * bytes)
+{
+#pragma GCC unroll 4
+    for (size_t i = 0; i < count; ++i) {
+        uint32_t w = words[i];
+        uint32_t x = (w ^ (w >> 1)) & 0x55555555;
+        x = (x | (x >> 1)) & 0x33333333;
+        x = (x | (x >> 2)) & 0x0f0f0f0f;
+        x = (x | (x >> 4)) & 0x00ff00ff;
+        bytes[i * 2] = x >> 16;
+        bytes[i * 2 + 1] = x;
+    }
+}
+
+void fm_decode_words(const uint32_t * words, size_t count, uint8_t * bytes)
+{
+    mfm_decode_words(words, count, bytes);
+}
+
+// mfm: a clock reversal goes between two data zeros and only there
+uint32_t mfm_word_violations(uint32_t prev, uint32_t word)
+{
+    uint32_t rev = word ^ ((word >> 1) | (prev << 31));
+    uint32_t data = rev & 0x55555555;
+    uint32_t prev_data = (prev ^ (prev >> 1)) << 31;
+    uint32_t clock = ~((data << 1) | (data >> 1) | prev_data) & 0xaaaaaaaa;
+    uint32_t v = (rev & 0xaaaaaaaa) ^ clock;
+    return (v >> 16 ? 2 : 0) | (v & 0xffff ? 1 : 0);
+}
+
+// fm: every clock cell is a reversal
+uint32_t fm_word_violations(uint32_t prev, uint32_t word)
+{
+    uint32_t rev = word ^ ((word >> 1) | (prev << 31));
+    uint32_t v = ~rev & 0xaaaaaaaa;
+    return (v >> 16 ? 2 : 0) | (v & 0xffff ? 1 : 0);
+}
+
+// worst of 16 cells of 2 bit confidence
+static inline uint32_t soft_min16(uint32_t cells)
+{
+    uint32_t hi = (cells >> 1) & 0x55555555;
+    uint32_t lo = cells & 0x55555555;
+    if (hi == 0x55555555) {
+        return lo == 0x55555555 ? 3 : 2;
+    }
+    return (~hi & ~lo & 0x55555555) ? 0 : 1;
+}
+
+// clock and data cells count alike, so the worst of the byte's 16 cells
+uint8_t mfm_soft_confidence(uint64_t soft)
+{
+    return (soft_min16(soft >> 32) << 4) | soft_min16(soft);
+}
+
+uint8_t fm_soft_confidence(uint64_t soft)
+{
+    return mfm_soft_confidence(soft);
+}
+
+// Bit by bit versions, the reference for the tables above
+
+// fm doesn't need prev_bit, but nice to have it for uniformity
+uint32_t fm_encode_twobyte_bitwise(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit)
 {
     uint16_t o = (c1 << 8) | c2;
     uint8_t level = *cur_level;
@@ -23,7 +195,7 @@ uint32_t fm_encode_twobyte(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *
 
 // input is levels, translate into flux reversals
 // drop all clock bits from mfm, resulting in two data bytes c1 and c2
-void fm_decode_twobyte(uint32_t fm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level)
+void fm_decode_twobyte_bitwise(uint32_t fm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level)
 {
     uint32_t tb = 0;
 
@@ -53,7 +225,7 @@ void fm_decode_twobyte(uint32_t fm, uint8_t * c1, uint8_t * c2, uint8_t *prev_le
 
 // 8 data bits -> 16 mfm-bits, updates cur_level and prev_bit for subsequent calling
 // the result is in terms of absolute values, flux reversals implied
-uint32_t mfm_encode_twobyte(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit)
+uint32_t mfm_encode_twobyte_bitwise(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit)
 {
     uint16_t o = (c1 << 8) | c2;
 
@@ -95,7 +267,7 @@ uint32_t mfm_encode_twobyte(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t
 
 // input is levels, translate into flux reversals
 // drop all clock bits from mfm, resulting in two data bytes c1 and c2
-void mfm_decode_twobyte(uint32_t mfm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level)
+void mfm_decode_twobyte_bitwise(uint32_t mfm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level)
 {
     uint32_t tb = 0;
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
 
 // 8 data bits -> 16 mfm-bits, updates prev_bit for subsequent calling
 uint32_t mfm_encode_twobyte(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit);
@@ -10,3 +11,26 @@ void mfm_decode_twobyte(uint32_t mfm, uint8_t * c1, uint8_t * c2, uint8_t *prev_
 
 uint32_t fm_encode_twobyte(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit);
 void fm_decode_twobyte(uint32_t fm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level);
+
+// demodulate count words into 2 * count bytes, first byte from the high
+// half; fm and mfm carry data bits the same way, polarity does not matter
+void mfm_decode_words(const uint32_t * words, size_t count, uint8_t * bytes);
+void fm_decode_words(const uint32_t * words, size_t count, uint8_t * bytes);
+
+// clock bit violations in a word of data given the word before it on tape
+// (sync for the first one); bit 1 flags the high byte, bit 0 the low byte
+uint32_t mfm_word_violations(uint32_t prev, uint32_t word);
+uint32_t fm_word_violations(uint32_t prev, uint32_t word);
+
+// confidence of the two bytes of a word from its soft decisions as from
+// readloop_soft_bits(): a data bit is as good as the worse of its clock and
+// data cell, a byte as its worst bit. High byte in bits 7..4, low in 3..0,
+// 0..READLOOP_SOFT_MAX each
+uint8_t mfm_soft_confidence(uint64_t soft);
+uint8_t fm_soft_confidence(uint64_t soft);
+
+// bit by bit reference implementations, the above are table driven
+uint32_t mfm_encode_twobyte_bitwise(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit);
+void mfm_decode_twobyte_bitwise(uint32_t mfm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level);
+uint32_t fm_encode_twobyte_bitwise(uint8_t c1, uint8_t c2, uint8_t *cur_level, uint8_t *prev_bit);
+void fm_decode_twobyte_bitwise(uint32_t fm, uint8_t * c1, uint8_t * c2, uint8_t *prev_level);
@@ -0,0 +1,98 @@
+#include <algorithm>
+#include <array>
+
+#include "correct.h"
+#include "readloop.h"
+#include "mfmviterbi.h"
+
+// the trellis: shift register of data bits, newest in bit 0; libcorrect
+// wants at least order 4, mfm only looks at the last two
+constexpr size_t ORDER = 4;
+
+// words decoded in one go, each with a word of context either side so the
+// paths have merged where the output starts
+constexpr size_t CHUNK_WORDS = 32;
+constexpr size_t CONTEXT_SETS = 16;     // a word, keeps the output byte aligned
+constexpr size_t TAIL_SETS = 8;         // erased, covers the decoder's flush
+constexpr size_t CHUNK_SETS = (CHUNK_WORDS + 2) * 16 + TAIL_SETS;
+
+constexpr uint8_t ERASED = 128;
+
+static correct_convolutional * conv = 0;
+
+static correct_convolutional * mfm_trellis()
+{
+    if (!conv) {
+        std::array<unsigned int, 1 << ORDER> table;
+        for (unsigned int reg = 0; reg < table.size(); ++reg) {
+            unsigned int data = reg & 1;
+            unsigned int clock = !(reg & 3);
+            table[reg] = clock | (data << 1);   // symbols on tape: clock, data
+        }
+        conv = correct_convolutional_create_table(2, ORDER, table.data());
+    }
+    return conv;
+}
+
+// soft symbol of a reversal between two cells or of none, by the worse of
+// their confidences
+static inline uint8_t soft_symbol(uint32_t reversal, uint32_t confidence)
+{
+    int offset = 32 + 32 * confidence;
+    return reversal ? std::min(127 + offset, 255) : std::max(128 - offset, 0);
+}
+
+struct cell_t {
+    uint32_t level;
+    uint32_t confidence;
+};
+
+// the 16 sets (clock, data) of a word on tape, prev is the cell before it
+static uint8_t * word_symbols(uint8_t * dst, uint32_t word, uint64_t soft, cell_t & prev)
+{
+    for (int i = 31; i > 0; i -= 2) {
+        cell_t clock = { (word >> i) & 1, (uint32_t)(soft >> (2 * i)) & 3 };
+        cell_t data = { (word >> (i - 1)) & 1, (uint32_t)(soft >> (2 * i - 2)) & 3 };
+        *dst++ = soft_symbol(prev.level ^ clock.level,
+                std::min(prev.confidence, clock.confidence));
+        *dst++ = soft_symbol(clock.level ^ data.level,
+                std::min(clock.confidence, data.confidence));
+        prev = data;
+    }
+    return dst;
+}
+
+void mfmviterbi_decode_words(const uint32_t * words, const uint64_t * soft,
+        size_t count, uint32_t prev, uint8_t * bytes)
+{
+    static std::array<uint8_t, CHUNK_SETS * 2> symbols;
+    static std::array<uint8_t, CHUNK_SETS / 8 + 1> decoded;
+    correct_convolutional * trellis = mfm_trellis();
+    auto soft_of = [soft](size_t i) { return soft ? soft[i] : ~0ull; };
+
+    for (size_t first = 0; first < count; first += CHUNK_WORDS) {
+        size_t n = std::min(CHUNK_WORDS, count - first);
+
+        // the word before, its first clock cell is unknown
+        cell_t cell = { 0, 0 };
+        uint8_t * dst = first
+            ? word_symbols(symbols.data(), words[first - 1], soft_of(first - 1), cell)
+            : word_symbols(symbols.data(), prev, ~0ull, cell);
+        symbols[0] = ERASED;
+        for (size_t i = first; i < first + n; ++i) {
+            dst = word_symbols(dst, words[i], soft_of(i), cell);
+        }
+        // the word after if there is one
+        if (first + n < count) {
+            dst = word_symbols(dst, words[first + n], soft_of(first + n), cell);
+        }
+        else {
+            dst = std::fill_n(dst, CONTEXT_SETS * 2, ERASED);
+        }
+        dst = std::fill_n(dst, TAIL_SETS * 2, ERASED);
+
+        correct_convolutional_decode_soft(trellis, symbols.data(),
+                dst - symbols.data(), decoded.data());
+        std::copy_n(decoded.data() + CONTEXT_SETS / 8, 2 * n, bytes + 2 * first);
+    }
+}
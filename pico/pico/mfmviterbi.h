@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// Maximum likelihood mfm detector: libcorrect's Viterbi decoder run over
+// the mfm trellis instead of a convolutional code. A data bit and the one
+// before it give the clock cell (a reversal only between two zeros) and
+// the data cell, so a path can't have clock violations and a doubtful cell
+// is decided by its neighbours. Cells come with the read loop's soft
+// decisions, see readloop_soft_bits().
+//
+// Not used by SectorReader: storing 64 bits of soft decisions per word of
+// a record costs 8k of ram. Host benches compare it to mfm_decode_words(),
+// the firmware doesn't build it.
+
+// words as the read loop gave them with readloop_soft_bits() of each (or
+// 0 for all at full confidence), prev the word before the first on tape,
+// the sync; demodulates into 2 * count bytes like mfm_decode_words()
+void mfmviterbi_decode_words(const uint32_t * words, const uint64_t * soft,
+        size_t count, uint32_t prev, uint8_t * bytes);
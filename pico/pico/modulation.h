@@ -0,0 +1,219 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "config.h"
+#include "mfm.h"
+#include "rll.h"
+
+// how cells carry the data, chosen at runtime: the cell clock goes with it
+// and syncs are only found at the right one, so a tape is read with the
+// modulation it was written with, see Bitstream::set_modulation()
+enum modulation_t : uint8_t {
+    MOD_MFM = 0,        // as on tapes from before
+    MOD_RLL27,          // rll(2,7), see rll.h: 1.5 times the data of mfm
+    MOD_FM,             // a clock reversal in every bit: half the data of mfm
+    MOD_COUNT
+};
+
+// A modulation is a policy class, Bitstream and SectorReader take one as
+// a template argument where they render or read a sector and pick it from
+// the runtime modulation_t once, with with_modulation(), outside their
+// loops. It has
+//
+//   id, name
+//   cells          in the shortest interval between reversals: the cell
+//                  clock is MOD_FREQ times this, MOD_FREQ stays the highest
+//                  frequency on tape
+//   bits_per_byte  cells a data byte takes on tape
+//   flush_words    tape words after the last data word, of each channel
+//   leader, sync_sector, sync_data
+//                  written as they are, not modulated; both syncs hold a
+//                  run the code doesn't have and are found in either
+//                  polarity
+//   dll_kp         the delay-locked loop's proportional gain
+//   encoder_t, encode_start(), encode_word(), encode_flush()
+//                  as rll27_encode_start() and so on
+//   decode_words() as rll27_decode_words(), flags may be 0
+//   soft_confidence()
+//                  as mfm_soft_confidence()
+
+// fm and mfm: every word stands on its own, flags are clock violations
+template <uint32_t (*violations)(uint32_t, uint32_t)>
+static inline void clocked_decode_words(const uint32_t * words, size_t count,
+        size_t stride, uint32_t prev, uint8_t * bytes, uint8_t * flags)
+{
+    if (stride == 1) {
+        mfm_decode_words(words, count, bytes);
+    }
+    else {
+        for (size_t i = 0; i < count; ++i) {
+            mfm_decode_words(words + i * stride, 1, bytes + 2 * i * stride);
+        }
+    }
+    if (!flags) {
+        return;
+    }
+    // the writer starts data as if after a one, at the level of the sync
+    prev = (prev & 1) | (((prev & 1) ^ 1) << 1);
+    for (size_t i = 0; i < count; ++i) {
+        flags[i * stride] |= violations(prev, words[i * stride]);
+        prev = words[i * stride];
+    }
+}
+
+struct MfmModulation {
+    static constexpr uint8_t id = MOD_MFM;
+    static constexpr const char * name = "mfm";
+    static constexpr int cells = 2;
+    static constexpr int bits_per_byte = 16;
+    static constexpr size_t flush_words = 0;
+    static constexpr uint32_t leader = 0xCCCCCCCC;
+    static constexpr uint32_t sync_sector = 0xCCCCCCC7;
+    static constexpr uint32_t sync_data = 0xCCCCCCE3;
+    static constexpr float dll_kp = DLL_KP;
+
+    struct encoder_t {
+        uint8_t level;
+        uint8_t prev_bit;
+    };
+
+    static void encode_start(encoder_t & e, uint32_t prev)
+    {
+        e.level = prev & 1;
+        e.prev_bit = 1;
+    }
+
+    static size_t encode_word(encoder_t & e, uint16_t data, uint32_t * out)
+    {
+        *out = mfm_encode_twobyte(data >> 8, data & 255, &e.level, &e.prev_bit);
+        return 1;
+    }
+
+    static size_t encode_flush(encoder_t &, uint32_t *) { return 0; }
+
+    static void decode_words(const uint32_t * words, size_t count, size_t stride,
+            uint32_t prev, uint8_t * bytes, uint8_t * flags)
+    {
+        clocked_decode_words<mfm_word_violations>(words, count, stride, prev,
+                bytes, flags);
+    }
+
+    static uint8_t soft_confidence(uint64_t soft) { return mfm_soft_confidence(soft); }
+};
+
+// the leader is all ones, the syncs miss a clock reversal each, 3 cells
+// where fm has 2 at most, and end in whole bits
+struct FmModulation {
+    static constexpr uint8_t id = MOD_FM;
+    static constexpr const char * name = "fm";
+    static constexpr int cells = 1;
+    static constexpr int bits_per_byte = 16;
+    static constexpr size_t flush_words = 0;
+    static constexpr uint32_t leader = 0xAAAAAAAA;
+    static constexpr uint32_t sync_sector = 0xAAAA2AAB;
+    static constexpr uint32_t sync_data = 0xAAAA32AB;
+    static constexpr float dll_kp = DLL_KP;
+
+    struct encoder_t {
+        uint8_t level;
+        uint8_t prev_bit;
+    };
+
+    static void encode_start(encoder_t & e, uint32_t prev)
+    {
+        e.level = prev & 1;
+        e.prev_bit = 1;
+    }
+
+    static size_t encode_word(encoder_t & e, uint16_t data, uint32_t * out)
+    {
+        *out = fm_encode_twobyte(data >> 8, data & 255, &e.level, &e.prev_bit);
+        return 1;
+    }
+
+    static size_t encode_flush(encoder_t &, uint32_t *) { return 0; }
+
+    static void decode_words(const uint32_t * words, size_t count, size_t stride,
+            uint32_t prev, uint8_t * bytes, uint8_t * flags)
+    {
+        clocked_decode_words<fm_word_violations>(words, count, stride, prev,
+                bytes, flags);
+    }
+
+    static uint8_t soft_confidence(uint64_t soft) { return fm_soft_confidence(soft); }
+};
+
+// a reversal every 4 cells in the leader, the syncs have two 9 and 11
+// cells apart where rll(2,7) data has 8 at most, and end 3 cells after one
+struct Rll27Modulation {
+    static constexpr uint8_t id = MOD_RLL27;
+    static constexpr const char * name = "rll(2,7)";
+    static constexpr int cells = 3;
+    static constexpr int bits_per_byte = 16;
+    static constexpr size_t flush_words = 1;
+    static constexpr uint32_t leader = 0xF0F0F0F0;
+    static constexpr uint32_t sync_sector = 0xF0F0FF8F;
+    static constexpr uint32_t sync_data = 0xF0E0038F;
+    static constexpr float dll_kp = DLL_KP_RLL;
+
+    typedef rll27_encoder_t encoder_t;
+
+    static void encode_start(encoder_t & e, uint32_t prev) { rll27_encode_start(e, prev); }
+
+    static size_t encode_word(encoder_t & e, uint16_t data, uint32_t * out)
+    {
+        return rll27_encode_word(e, data, out);
+    }
+
+    static size_t encode_flush(encoder_t & e, uint32_t * out)
+    {
+        return rll27_encode_flush(e, out);
+    }
+
+    static void decode_words(const uint32_t * words, size_t count, size_t stride,
+            uint32_t prev, uint8_t * bytes, uint8_t * flags)
+    {
+        rll27_decode_words(words, count, stride, prev, bytes, flags);
+    }
+
+    // the cells of data bit j are 2j and 2j + 1 as with mfm
+    static uint8_t soft_confidence(uint64_t soft) { return mfm_soft_confidence(soft); }
+};
+
+// f(M()) with the policy of modulation, mfm for what isn't one
+template <typename F>
+inline auto with_modulation(uint8_t modulation, F && f)
+{
+    switch (modulation) {
+        case MOD_RLL27: return f(Rll27Modulation());
+        case MOD_FM:    return f(FmModulation());
+        default:        return f(MfmModulation());
+    }
+}
+
+inline const char * modulation_name(uint8_t modulation)
+{
+    return modulation < MOD_COUNT
+        ? with_modulation(modulation, [](auto m) { return decltype(m)::name; })
+        : "unknown";
+}
+
+inline int modulation_cells(uint8_t modulation)
+{
+    return with_modulation(modulation, [](auto m) { return decltype(m)::cells; });
+}
+
+inline uint32_t modulation_leader(uint8_t modulation)
+{
+    return with_modulation(modulation, [](auto m) { return decltype(m)::leader; });
+}
+
+inline float modulation_dll_kp(uint8_t modulation)
+{
+    return with_modulation(modulation, [](auto m) { return decltype(m)::dll_kp; });
+}
+
+// the most flush words of any, for buffers
+constexpr size_t modulation_flush_max = 1;
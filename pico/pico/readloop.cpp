@@ -1,12 +1,18 @@
 #include <cstdint>
 #include <cmath>
+#include <cstdlib>
 #include <cstdio>
 #include <array>
+#include <algorithm>
 #include "readloop.h"
 
 static readloop_bit_sampler_t sample_one_bit = 0;
+static readloop_word_sampler_t sample_word = 0;
+static readloop_channel_sampler_t sample_channel_word = 0;
 
-static uint64_t mfm_bits = 0;
+static uint32_t spike_bits = 0;    // of the loop in its callback
+static uint64_t soft_bits = ~0ull;
+static bool keep_soft = false;
 
 static int bitwidth = 0;
 static int halfwidth = 0;
@@ -14,9 +20,10 @@ static int halfwidth = 0;
 static float Kp = 0;
 static float Ki = 0;
 static float alpha = 0;
+static float phase_spike = 0;
 
 static size_t debugbuf_index = 0;
-static std::array<uint8_t, 100000> debugbuf;
+static std::array<uint8_t, READLOOP_DEBUGBUF_LEN> debugbuf;
 
 void readloop_setparams(readloop_params_t args)
 {
@@ -26,59 +33,181 @@ void readloop_setparams(readloop_params_t args)
     Kp = args.Kp;
     Ki = args.Ki;
     alpha = args.alpha;
+    phase_spike = args.phase_spike;
+    keep_soft = args.soft;
 
     sample_one_bit = args.sampler;
+    sample_word = args.word_sampler;
+    sample_channel_word = args.channel_sampler;
 
     debugbuf_index = 0;
 }
 
-// delay-locked loop tracker with PI-tuning
-// borrows from https://github.com/carrotIndustries/redbook/ by Lukas K.
-uint32_t readloop_delaylocked(readloop_callback_t cb, void * user)
+// delay-locked loop state, kept between words so that the loops of
+// several head channels can take turns on one core
+struct dll_t {
+    readloop_callback_t cb;
+    void * user;
+    readloop_state_t state;
+
+    uint32_t lastbit;
+    int phase_delta;
+    int phase_delta_filtered;
+    int integ;
+    int iacc;
+    uint32_t spike;
+    int bitcount;
+    uint64_t mfm_bits;
+    uint32_t spike_bits;
+    uint64_t soft_bits;
+    uint32_t soft_next;     // of the cell after the newest
+};
+
+// fixed point tuning, see readloop_tune()
+static const int nscale = 20;
+static const int scale = 1 << nscale;
+static const int one = scale;
+static const int acc_size = 512;
+static const int iacc_size = acc_size * scale;
+static const int integ_max = 512 * scale;
+
+static int iKp, iKi, ialpha, ftw0, ispike;
+
+static void readloop_tune()
 {
-    uint32_t lastbit = 0;
-    int phase_delta = 0;
-    int phase_delta_filtered = 0;
-    int integ = 0;
-
-    int nscale = 20;
-    int scale = 1 << nscale;
-    int one = scale;
-    int iKp = (int)(Kp * scale);
-    int iKi = (int)(Ki * scale);
-    int ialpha = (int)(alpha * scale);
-
-    int integ_max = 512 * scale;
-
-    int acc_size = 512;
-    int ftw0 = acc_size / bitwidth * scale;
-    int ftw = 0;
-    int iacc_size = acc_size * scale;
-    int iacc = iacc_size / 2;
-
-    int bitcount = 0;
-    int rawcnt = 0;   // raw sample count for debugbuffa
-    uint32_t rawsample = 0;
+    iKp = (int)(Kp * scale);
+    iKi = (int)(Ki * scale);
+    ialpha = (int)(alpha * scale);
+    ftw0 = acc_size / bitwidth * scale;
 
-    //printf("%s, collecting debugbuf\n", __FUNCTION__);
-    readloop_state_t state = TS_RESYNC_SECTOR;
+    // phase spike threshold, off by default
+    ispike = phase_spike > 0 ? (int)(phase_spike * iacc_size) : iacc_size;
+}
 
-    for (; state != TS_TERMINATE;) {
-        uint32_t bit = sample_one_bit();
-        if (bit & RL_BREAK) {
-            break;
+static void dll_init(dll_t & d, readloop_callback_t cb, void * user)
+{
+    readloop_tune();
+    d = {};
+    d.cb = cb;
+    d.user = user;
+    d.state = TS_RESYNC_SECTOR;
+    d.iacc = iacc_size / 2;
+    d.soft_bits = ~0ull;
+    d.soft_next = READLOOP_SOFT_MAX;
+}
+
+// soft decision level of a transition margin to the sample point, in
+// eighths of a cell
+static inline uint32_t soft_level(int margin)
+{
+    static_assert(iacc_size == 1 << 29, "soft levels shift by 26");
+    return std::min<uint32_t>(margin >> 26, READLOOP_SOFT_MAX);
+}
+
+// nbits samples of word, msb first, through the loop and on to the
+// callback; false once it terminates
+static bool dll_feed(dll_t & d, uint32_t word, int nbits)
+{
+    // in locals while the word lasts
+    readloop_state_t state = d.state;
+    uint32_t lastbit = d.lastbit;
+    int phase_delta = d.phase_delta;
+    int phase_delta_filtered = d.phase_delta_filtered;
+    int integ = d.integ;
+    int iacc = d.iacc;
+    uint32_t spike = d.spike;
+    int bitcount = d.bitcount;
+    uint64_t bits = d.mfm_bits;
+    uint32_t spikes = d.spike_bits;
+    uint64_t soft = d.soft_bits;
+    uint32_t soft_next = d.soft_next;
+
+    // bit clock tick: sample the bit and feed the callback
+    auto tick = [&](uint32_t bit) {
+        bits = (bits << 1) | bit;   // sample bit
+        spikes = (spikes << 1) | spike;
+        spike = 0;
+        if (keep_soft) {
+            soft = (soft << 2) | soft_next;
+            soft_next = READLOOP_SOFT_MAX;
+        }
+
+        switch (state) {
+            case TS_RESYNC_SECTOR:
+            case TS_RESYNC_DATA:
+                spike_bits = spikes;
+                soft_bits = soft;
+                state = d.cb(state, bits, d.user);
+                if (state == TS_READ_SECTOR || state == TS_READ_DATA) {
+                    bitcount = 0;
+                }
+                break;
+            case TS_READ_SECTOR:
+            case TS_READ_DATA:
+                if (++bitcount == 32) {
+                    bitcount = 0;
+                    spike_bits = spikes;
+                    soft_bits = soft;
+                    state = d.cb(state, bits, d.user);
+                }
+                break;
+            case TS_TERMINATE:
+                break;
         }
+    };
 
-        if (debugbuf_index < debugbuf.size()) {
-            rawsample = (rawsample << 1) | bit;
-            if (++rawcnt == 8) {
-                rawcnt = 0;
-                debugbuf[debugbuf_index++] = 0xff & rawsample;
+    // input transitions, msb first, same bit order as the word
+    uint32_t flips = word ^ ((word >> 1) | (lastbit << (nbits - 1)));
+    bool done = false;
+
+    if (flips == 0) {
+        // no transitions: if the filter is at its fixed point then
+        // only the integrator moves, by the same amount every sample
+        int64_t tmp64 = (int64_t)phase_delta * ialpha;
+        tmp64 += (int64_t)phase_delta_filtered * (one - ialpha);
+        int dinteg = (int64_t)(phase_delta_filtered * iKi) >> nscale;
+        int integ_end = integ + nbits * dinteg;
+        int ftw_p = ftw0 + (((int64_t)phase_delta_filtered * iKp) >> nscale);
+        int ftw_first = ftw_p + integ + dinteg;
+        int ftw_last = ftw_p + integ_end;
+
+        if ((tmp64 >> nscale) == phase_delta_filtered
+                && integ_end <= integ_max && integ_end >= -integ_max
+                && std::min(ftw_first, ftw_last) >= 0
+                && std::max(ftw_first, ftw_last) < iacc_size) {
+            // ftw grows linearly from ftw_first to ftw_last
+            int64_t acc = iacc + (int64_t)nbits * (ftw_first + ftw_last) / 2;
+            int ticks = acc / iacc_size;
+            iacc = acc - (int64_t)ticks * iacc_size;
+            integ = integ_end;
+            for (; ticks > 0 && state != TS_TERMINATE; --ticks) {
+                tick(lastbit);
             }
+            done = true;
         }
+    }
+
+    for (int i = nbits - 1; !done && i >= 0 && state != TS_TERMINATE; --i) {
+        uint32_t bit = (word >> i) & 1;
 
-        if (bit != lastbit) {                   // input transition
+        if ((flips >> i) & 1) {                 // input transition
             phase_delta = iacc_size / 2 - iacc; // 180 deg off transition point
+            int dev = phase_delta - phase_delta_filtered;
+            if (std::abs(dev) > ispike) {
+                spike = 1;
+            }
+            if (keep_soft) {
+                // off towards the cell sampled last, or the next one
+                uint32_t level = soft_level(iacc_size / 2 - std::abs(dev));
+                if (dev > 0) {
+                    if (level < (soft & 3)) {
+                        soft = (soft & ~3ull) | level;
+                    }
+                }
+                else {
+                    soft_next = std::min(soft_next, level);
+                }
+            }
         }
 
         int64_t tmp64 = (int64_t)phase_delta * ialpha;
@@ -93,38 +222,123 @@ uint32_t readloop_delaylocked(readloop_callback_t cb, void * user)
         else if (integ < -integ_max) {
             integ = -integ_max;
         }
-        
-        ftw = ftw0 + (((int64_t)phase_delta_filtered * iKp) >> nscale) + integ;
+
+        int ftw = ftw0 + (((int64_t)phase_delta_filtered * iKp) >> nscale) + integ;
         lastbit = bit;
         iacc = iacc + ftw;
         if (iacc >= iacc_size) {
             iacc -= iacc_size;
-            mfm_bits = (mfm_bits << 1) | bit;   // sample bit
-
-            switch (state) {
-                case TS_RESYNC_SECTOR:
-                case TS_RESYNC_DATA:
-                    state = cb(state, mfm_bits, user);
-                    if (state == TS_READ_SECTOR || state == TS_READ_DATA) {
-                        bitcount = 0;
-                    }
-                    break;
-                case TS_READ_SECTOR:
-                case TS_READ_DATA:
-                    if (++bitcount == 32) {
-                        bitcount = 0;
-                        state = cb(state, mfm_bits, user);
-                    }
-                    break;
-                case TS_TERMINATE:
-                    break;
+            tick(bit);
+        }
+    }
+
+    d.state = state;
+    d.lastbit = lastbit;
+    d.phase_delta = phase_delta;
+    d.phase_delta_filtered = phase_delta_filtered;
+    d.integ = integ;
+    d.iacc = iacc;
+    d.spike = spike;
+    d.bitcount = bitcount;
+    d.mfm_bits = bits;
+    d.spike_bits = spikes;
+    d.soft_bits = soft;
+    d.soft_next = soft_next;
+
+    return state != TS_TERMINATE;
+}
+
+// delay-locked loop tracker with PI-tuning
+// borrows from https://github.com/carrotIndustries/redbook/ by Lukas K.
+//
+// samples come either one per call from sample_one_bit or packed 32 per
+// word from sample_word; a word without transitions is skipped in one go
+// once the loop filter has settled, e.g. in gaps and dropouts
+uint32_t readloop_delaylocked(readloop_callback_t cb, void * user)
+{
+    dll_t dll;
+    dll_init(dll, cb, user);
+
+    int rawcnt = 0;   // raw sample count for debugbuffa
+    uint32_t rawsample = 0;
+
+    //printf("%s, collecting debugbuf\n", __FUNCTION__);
+    for (;;) {
+        uint32_t word;
+        int nbits;
+        if (sample_word) {
+            if (!sample_word(&word)) {
+                break;
+            }
+            nbits = 32;
+
+            if (debugbuf_index + 4 <= debugbuf.size()) {
+                for (int i = 24; i >= 0; i -= 8) {
+                    debugbuf[debugbuf_index++] = 0xff & (word >> i);
+                }
+            }
+        }
+        else {
+            word = sample_one_bit();
+            if (word & RL_BREAK) {
+                break;
+            }
+            nbits = 1;
+
+            if (debugbuf_index < debugbuf.size()) {
+                rawsample = (rawsample << 1) | word;
+                if (++rawcnt == 8) {
+                    rawcnt = 0;
+                    debugbuf[debugbuf_index++] = 0xff & rawsample;
+                }
             }
         }
+
+        if (!dll_feed(dll, word, nbits)) {
+            break;
+        }
     }
 
     return 0;
 }
 
+// a loop per channel, a word of each in turn: the channels sample at the
+// same rate, each callback only sees its own; debugbuf has channel 0
+uint32_t readloop_delaylocked_channels(readloop_callback_t cb, void * const * users,
+        int channels)
+{
+    std::array<dll_t, READLOOP_CHANNELS_MAX> dll;
+    for (int ch = 0; ch < channels; ++ch) {
+        dll_init(dll[ch], cb, users[ch]);
+    }
+
+    for (;;) {
+        for (int ch = 0; ch < channels; ++ch) {
+            uint32_t word;
+            if (!sample_channel_word(ch, &word)) {
+                return 0;
+            }
+            if (ch == 0 && debugbuf_index + 4 <= debugbuf.size()) {
+                for (int i = 24; i >= 0; i -= 8) {
+                    debugbuf[debugbuf_index++] = 0xff & (word >> i);
+                }
+            }
+            if (!dll_feed(dll[ch], word, 32)) {
+                return 0;
+            }
+        }
+    }
+}
+
+uint32_t readloop_phase_spikes()
+{
+    return spike_bits;
+}
+
+uint64_t readloop_soft_bits()
+{
+    return keep_soft ? soft_bits : ~0ull;
+}
 
 void readloop_dump_debugbuf()
 {
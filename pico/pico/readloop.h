@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include "config.h"
 
 // read loop states
 enum readloop_state_t
@@ -30,12 +31,30 @@ typedef readloop_state_t (*readloop_callback_t)(readloop_state_t, uint32_t, void
 // 0x80000000 for loop termination
 typedef uint32_t (*readloop_bit_sampler_t)(void);
 
+// word sampler function: store next 32 samples, oldest in msb
+// return false for loop termination
+typedef bool (*readloop_word_sampler_t)(uint32_t *);
+
+// word sampler of a head channel, for readloop_delaylocked_channels()
+typedef bool (*readloop_channel_sampler_t)(int channel, uint32_t *);
+
+// a pio state machine pair each on pio0 and pio1, as many as are built
+constexpr int READLOOP_CHANNELS_MAX = TAPE_CHANNELS_MAX;
+static_assert(TAPE_CHANNELS >= 1 && TAPE_CHANNELS <= TAPE_CHANNELS_MAX
+        && TAPE_CHANNELS_MAX <= 4, "up to 4 head channels");
+
+// one of sampler or word_sampler, word_sampler wins if both are set
 struct readloop_params_t {
     int bitwidth;
     float Kp;
     float Ki;
     float alpha;
     readloop_bit_sampler_t sampler;
+    readloop_word_sampler_t word_sampler;
+    float phase_spike;  // transition this far off the filtered phase, in bit
+                        // cells, is a spike, see readloop_phase_spikes(); 0 = off
+    readloop_channel_sampler_t channel_sampler; // readloop_delaylocked_channels() only
+    bool soft;          // keep soft decisions, see readloop_soft_bits()
 };
 
 void readloop_setparams(readloop_params_t args);
@@ -44,4 +63,25 @@ uint32_t readloop_simple(readloop_callback_t cb, void * user);
 uint32_t readloop_naiive(readloop_callback_t cb, void * user);
 uint32_t readloop_delaylocked(readloop_callback_t cb, void * user);
 
+// a delay-locked loop for each of channels, all on this core: words come
+// from channel_sampler, channel n's callback gets users[n]
+uint32_t readloop_delaylocked_channels(readloop_callback_t cb, void * const * users,
+        int channels);
+
+// phase spikes of the last 32 bit cells, aligned with the bits passed to
+// the callback: a set bit means a transition just before that cell was
+// more than phase_spike off, valid while in the callback (of that channel)
+uint32_t readloop_phase_spikes();
+
+// soft decisions of the last 32 bit cells, 2 bits each, cell i of the
+// bits passed to the callback in bits 2i+1..2i: the worst transition next
+// to the cell against the filtered phase, READLOOP_SOFT_MAX = within 1/8 of
+// a cell, 0 = more than 3/8 off. The newest cell may still get worse from a
+// transition right after it. All READLOOP_SOFT_MAX unless params.soft,
+// valid while in the callback
+constexpr uint32_t READLOOP_SOFT_MAX = 3;
+uint64_t readloop_soft_bits();
+
+// raw samples of the last read, channel 0
+constexpr size_t READLOOP_DEBUGBUF_LEN = 100000;
 void readloop_dump_debugbuf();
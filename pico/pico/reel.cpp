@@ -0,0 +1,237 @@
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+#include "config.h"
+#include "sectors.h"
+#include "reel.h"
+
+constexpr uint32_t reel_magic = 0x4c454552;     // "REEL"
+
+struct reel_params_t {
+    uint32_t magic;
+    uint32_t fitted;
+    float p[3];             // pos = p[0] + p[1] * c + p[2] * c^2
+    float wind_rate[2];     // counts per second, [0] ff, [1] rew
+    float coast[2];         // counts past the stop request
+    float backlash[2];      // counter correction going to play
+};
+
+// one page is programmed, the whole flash sector is erased
+static union {
+    reel_params_t params;
+    uint8_t bytes[FLASH_PAGE_SIZE];
+} reel;
+
+static_assert(sizeof(reel_params_t) <= FLASH_PAGE_SIZE, "reel_params_t too big");
+static_assert(REEL_FLASH_OFFSET % FLASH_SECTOR_SIZE == 0,
+        "REEL_FLASH_OFFSET must be flash sector aligned");
+
+static bool dirty = false;
+
+// play time of one sector, they are written back to back
+constexpr float sector_ms = sector_words * 32 * 1000.0f / (2 * MOD_FREQ);
+
+// least squares sums in counter / 1000 to keep c^4 in range
+constexpr double fit_scale = 1e-3;
+static double sx[5];
+static double sxy[3];
+
+static int side(int dir)
+{
+    return dir > 0 ? 0 : 1;
+}
+
+// moving average, new values count a quarter
+static void learn(float & value, float observed)
+{
+    value += (observed - value) / 4;
+    dirty = true;
+}
+
+static void reel_defaults()
+{
+    memset(&reel, 0xff, sizeof(reel));
+    reel.params = reel_params_t{
+        .magic = reel_magic,
+        .fitted = 0,
+        .p = {0, 1.0f / REEL_COUNTS_PER_SECTOR, 0},
+        .wind_rate = {REEL_WIND_RATE, REEL_WIND_RATE},
+        .coast = {0, 0},
+        .backlash = {0, 0},
+    };
+}
+
+void reel_load()
+{
+    memcpy(&reel, (const uint8_t *)(XIP_BASE + REEL_FLASH_OFFSET), sizeof(reel));
+    if (reel.params.magic != reel_magic) {
+        reel_defaults();
+    }
+    dirty = false;
+}
+
+bool reel_save()
+{
+    if (!dirty) {
+        return false;
+    }
+
+    uint32_t irq = save_and_disable_interrupts();
+    flash_range_erase(REEL_FLASH_OFFSET, FLASH_SECTOR_SIZE);
+    flash_range_program(REEL_FLASH_OFFSET, reel.bytes, sizeof(reel));
+    restore_interrupts(irq);
+
+    dirty = false;
+    return true;
+}
+
+void reel_fit_begin()
+{
+    memset(sx, 0, sizeof(sx));
+    memset(sxy, 0, sizeof(sxy));
+}
+
+void reel_fit_add(int sector_num, int counter)
+{
+    double x = counter * fit_scale;
+    double xk = 1;
+    for (int k = 0; k < 5; ++k) {
+        sx[k] += xk;
+        if (k < 3) {
+            sxy[k] += sector_num * xk;
+        }
+        xk *= x;
+    }
+}
+
+static double det3(double a[3][3])
+{
+    return a[0][0] * (a[1][1] * a[2][2] - a[1][2] * a[2][1])
+         - a[0][1] * (a[1][0] * a[2][2] - a[1][2] * a[2][0])
+         + a[0][2] * (a[1][0] * a[2][1] - a[1][1] * a[2][0]);
+}
+
+bool reel_fit_end()
+{
+    if (sx[0] < REEL_FIT_MIN_SECTORS) {
+        return false;
+    }
+
+    // normal equations, solved by cramer's rule
+    double a[3][3];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) {
+            a[i][j] = sx[i + j];
+        }
+    }
+    double d = det3(a);
+    if (std::fabs(d) < 1e-12) {
+        return false;
+    }
+
+    double p[3];
+    for (int k = 0; k < 3; ++k) {
+        double ak[3][3];
+        memcpy(ak, a, sizeof(a));
+        for (int i = 0; i < 3; ++i) {
+            ak[i][k] = sxy[i];
+        }
+        p[k] = det3(ak) / d;
+    }
+
+    // the counter must move forward with the tape
+    if (p[1] <= 0 && p[2] <= 0) {
+        return false;
+    }
+
+    reel.params.p[0] = p[0];
+    reel.params.p[1] = p[1] * fit_scale;
+    reel.params.p[2] = p[2] * fit_scale * fit_scale;
+    reel.params.fitted = 1;
+    dirty = true;
+
+    return true;
+}
+
+bool reel_valid()
+{
+    return reel.params.fitted == 1;
+}
+
+float reel_position(int counter)
+{
+    const float * p = reel.params.p;
+    return p[0] + (p[1] + p[2] * counter) * counter;
+}
+
+int reel_counter(float position)
+{
+    const float * p = reel.params.p;
+    float dp = position - p[0];
+    float disc = p[1] * p[1] + 4 * p[2] * dp;
+    if (disc < 0) {
+        disc = 0;
+    }
+    // the quadratic root that is 0 at p0, stable for p2 near 0
+    float root = p[1] + sqrtf(disc);
+    return root > 0 ? lroundf(2 * dp / root) : 0;
+}
+
+reel_plan_t reel_plan(int counter, int target_counter)
+{
+    float from = reel_position(counter);
+    float to = reel_position(target_counter);
+
+    reel_plan_t plan = {0, counter, INT32_MAX};
+    if (to >= from) {
+        plan.ms = (to - from) * sector_ms;
+    }
+
+    int goal = reel_counter(to - SEEK_LEAD_SECTORS);
+    int dir = goal > counter ? 1 : -1;
+    int s = side(dir);
+    int stop = goal - dir * lroundf(reel.params.coast[s]);
+    if ((stop - counter) * dir <= 0) {
+        if (dir > 0) {
+            return plan;    // too close to bother
+        }
+        stop = counter - 1; // coasts further back than needed, still behind
+    }
+
+    float wind_ms = REEL_SWITCH_MS + std::abs(stop - counter) * 1000.0f
+        / reel.params.wind_rate[s] + SEEK_LEAD_SECTORS * sector_ms;
+    if (wind_ms < plan.ms) {
+        plan.wind = dir;
+        plan.counter = stop;
+        plan.ms = wind_ms;
+    }
+
+    return plan;
+}
+
+void reel_wind_observe(int dir, int counts, uint32_t ms, int coast)
+{
+    int s = side(dir);
+    // short winds are mostly spin-up
+    if (ms >= 500 && counts > 0) {
+        learn(reel.params.wind_rate[s], counts * 1000.0f / ms);
+    }
+    learn(reel.params.coast[s], coast);
+}
+
+int reel_backlash(int dir)
+{
+    return lroundf(reel.params.backlash[side(dir)]);
+}
+
+void reel_backlash_observe(int dir, int error)
+{
+    // error is what is left after the current correction
+    learn(reel.params.backlash[side(dir)],
+            reel.params.backlash[side(dir)] - error);
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+
+// tape position from the tacho counter
+//
+// the counter counts turns of the takeup reel, and every turn takes a bit
+// more tape than the one before as the reel gets fatter, so position is
+// quadratic in the counter: pos = p0 + p1 * c + p2 * c^2
+// position is in sectors, i.e. the sector number under the head
+//
+// llformat fits the model from the counter at every sector it writes;
+// wind speed, coasting after the wind stops and the counter error after
+// going back to play are learned as the tape is wound around
+// everything is kept in flash next to the sector index
+
+struct reel_plan_t {
+    int wind;       // +1 ff, -1 rew, 0 just play up to the sector
+    int counter;    // stop winding here, the reel coasts on to the target
+    int ms;         // estimated time until the sector is under the head
+};
+
+// load from flash, defaults from config.h if nothing is there
+void reel_load();
+
+// write to flash if anything changed, same rules as sector_index_save()
+bool reel_save();
+
+// llformat: feed the counter of every sector written, the fit replaces the
+// old model if there are enough sectors; false if it didn't
+void reel_fit_begin();
+void reel_fit_add(int sector_num, int counter);
+bool reel_fit_end();
+
+// true once fitted, the default model is only a rough straight line
+bool reel_valid();
+
+float reel_position(int counter);
+int reel_counter(float position);
+
+// how to get from counter to target_counter quickest: play through or
+// ff/rew, SEEK_LEAD_SECTORS short of the target
+reel_plan_t reel_plan(int counter, int target_counter);
+
+// a wind in dir went counts in ms after the mechanism was in ff/rew, then
+// the reel ran coast counts on after the stop was requested
+void reel_wind_observe(int dir, int counts, uint32_t ms, int coast);
+
+// the counter drifts when the reel changes direction: added to the counter
+// when the wheel goes from a wind in dir to play
+int reel_backlash(int dir);
+
+// the first sector found after a wind in dir was error counts off its index
+// entry, with reel_backlash(dir) already applied
+void reel_backlash_observe(int dir, int error);
@@ -0,0 +1,161 @@
+#include <cstdint>
+#include <array>
+
+#include "rll.h"
+
+// codewords and the data bits they stand for, both after a leading 1 that
+// tells their length
+struct codeword_t {
+    uint8_t data;
+    uint16_t code;
+};
+
+static constexpr std::array<codeword_t, 7> codewords = {{
+    { 0b110,    0b10100 },          // 10   -> 0100
+    { 0b111,    0b11000 },          // 11   -> 1000
+    { 0b1000,   0b1000100 },        // 000  -> 000100
+    { 0b1010,   0b1100100 },        // 010  -> 100100
+    { 0b1011,   0b1001000 },        // 011  -> 001000
+    { 0b10010,  0b100100100 },      // 0010 -> 00100100
+    { 0b10011,  0b100001000 },      // 0011 -> 00001000
+}};
+
+// [data bits so far] -> codeword, 0 while it's a prefix of a longer one
+static constexpr std::array<uint16_t, 32> encode_table = [] {
+    std::array<uint16_t, 32> t{};
+    for (const codeword_t & c : codewords) {
+        t[c.data] = c.code;
+    }
+    return t;
+}();
+
+// [code bits so far] -> data bits, 0 while it's a prefix of a longer
+// codeword, -1 if it's neither; codewords have an even length and so do
+// the prefixes that are looked up
+static constexpr std::array<int8_t, 512> decode_table = [] {
+    std::array<int8_t, 512> t{};
+    for (auto & d : t) {
+        d = -1;
+    }
+    for (const codeword_t & c : codewords) {
+        t[c.code] = c.data;
+        for (int code = c.code >> 2; code > 1; code >>= 2) {
+            t[code] = 0;
+        }
+    }
+    t[1] = 0;
+    return t;
+}();
+
+static inline int bit_length(uint32_t x)
+{
+    return 31 - __builtin_clz(x);
+}
+
+void rll27_encode_start(rll27_encoder_t & e, uint32_t prev)
+{
+    e.state = 1;
+    e.level = prev & 1;
+    e.cells = 0;
+    e.ncells = 0;
+}
+
+static inline void encode_bit(rll27_encoder_t & e, uint32_t bit)
+{
+    e.state = e.state << 1 | bit;
+    uint32_t code = encode_table[e.state];
+    if (!code) {
+        return;
+    }
+    e.state = 1;
+    int len = bit_length(code);
+    for (int i = len - 1; i >= 0; --i) {
+        e.level ^= (code >> i) & 1;
+        e.cells = e.cells << 1 | e.level;
+    }
+    e.ncells += len;
+}
+
+static inline size_t put_words(rll27_encoder_t & e, uint32_t * out)
+{
+    size_t n = 0;
+    while (e.ncells >= 32) {
+        e.ncells -= 32;
+        out[n++] = e.cells >> e.ncells;
+    }
+    return n;
+}
+
+size_t rll27_encode_word(rll27_encoder_t & e, uint16_t data, uint32_t * out)
+{
+    for (int i = 15; i >= 0; --i) {
+        encode_bit(e, (data >> i) & 1);
+    }
+    return put_words(e, out);
+}
+
+// every codeword ends in at least two zeros, a fill of 1000 after it keeps
+// reversals 3 to 8 cells apart
+size_t rll27_encode_flush(rll27_encoder_t & e, uint32_t * out)
+{
+    while (e.state != 1) {
+        encode_bit(e, 0);
+    }
+    size_t n = put_words(e, out);
+    for (int i = 0, fill = 32 - e.ncells; i < fill; ++i) {
+        e.level ^= (i & 3) == 0;
+        e.cells = e.cells << 1 | e.level;
+    }
+    e.ncells = 32;
+    return n + put_words(e, out + n);
+}
+
+void rll27_decode_words(const uint32_t * words, size_t count, size_t stride,
+        uint32_t prev, uint8_t * bytes, uint8_t * flags)
+{
+    uint32_t code = 1;      // of the open codeword, after a leading 1
+    uint32_t data = 0;      // decoded bits, the last in bit 0
+    uint32_t bad = 0;       // the same, set where no codeword was
+    size_t ndata = 0;
+    size_t out = 0;         // words put out
+
+    auto push = [&](uint32_t bits, int n, bool invalid) {
+        data = data << n | bits;
+        bad = bad << n | (invalid ? (1u << n) - 1 : 0);
+        ndata += n;
+        if (ndata < 16 * (out + 1)) {
+            return;
+        }
+        int extra = ndata - 16 * (out + 1);
+        uint32_t v = data >> extra;
+        uint32_t b = bad >> extra;
+        bytes[2 * out * stride] = v >> 8;
+        bytes[2 * out * stride + 1] = v;
+        if (flags) {
+            flags[out * stride] |= (b & 0xff00 ? 2 : 0) | (b & 0xff ? 1 : 0);
+        }
+        ++out;
+    };
+
+    uint32_t level = prev & 1;
+    for (size_t w = 0; w <= count && out < count; ++w) {
+        uint32_t word = words[w * stride];
+        uint32_t rev = word ^ ((word >> 1) | (level << 31));
+        level = word & 1;
+        for (int i = 30; i >= 0 && out < count; i -= 2) {
+            code = code << 2 | ((rev >> i) & 3);
+            int d = decode_table[code];
+            if (d == 0) {
+                continue;
+            }
+            // a codeword, or data bits as many as the cells that aren't one
+            int n = bit_length(code) / 2;
+            push(d > 0 ? d & ((1u << n) - 1) : 0, n, d < 0);
+            code = 1;
+        }
+    }
+    // a codeword cut short, or no flush word
+    while (out < count) {
+        push(0, 1, true);
+    }
+}
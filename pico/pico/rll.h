@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+// RLL(2,7), the IBM code as in codec/codec.py: data bits go in groups of
+// 2 to 4 to codewords twice as long, a 1 in a codeword is a reversal.
+// Reversals are at least 3 and at most 8 cells apart, against 2..4 for
+// mfm, so at the same shortest interval on tape the cells are 1.5 times
+// as fast and so is the data.
+//
+// Codewords are twice their data bits, the cells of data bit j are 2j and
+// 2j + 1 as with mfm and a word of 32 cells carries 16 data bits, but a
+// codeword may cross into the next word: the encoder is a word behind
+// while one is open and its flush puts out one more word than it took,
+// the decoder is given that word too.
+
+// 10 -> 0100, 11 -> 1000, 000 -> 000100, 010 -> 100100, 011 -> 001000,
+// 0010 -> 00100100, 0011 -> 00001000
+struct rll27_encoder_t {
+    uint8_t state;      // data bits of the open codeword, after a leading 1
+    uint32_t level;     // of the last cell
+    uint64_t cells;     // not out yet, the last in bit 0
+    int ncells;
+};
+
+// start after prev on tape, the sync: its last cell is the level
+void rll27_encode_start(rll27_encoder_t & e, uint32_t prev);
+
+// 16 data bits, msb first; puts out the words that are complete, returns
+// the number of them, 0 or 1
+size_t rll27_encode_word(rll27_encoder_t & e, uint16_t data, uint32_t * out);
+
+// close the open codeword with zeros and put out the rest, filled up with
+// a reversal every 4 cells; one more word than rll27_encode_word() took
+// in all, returns the number of them now, 1 or 2
+size_t rll27_encode_flush(rll27_encoder_t & e, uint32_t * out);
+
+// count words of data as the encoder put them out at words[i * stride],
+// prev the word before the first on tape (the sync) and the flush word
+// after the last; word i's data goes to bytes[2 * i * stride] and the byte
+// after. Bytes that come out of something that isn't a codeword are
+// flagged in flags[i * stride] if flags isn't 0, bit 1 the high byte, bit 0
+// the low byte, as mfm_word_violations()
+void rll27_decode_words(const uint32_t * words, size_t count, size_t stride,
+        uint32_t prev, uint8_t * bytes, uint8_t * flags);
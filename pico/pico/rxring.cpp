@@ -0,0 +1,175 @@
+#include <cstdint>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+#include "config.h"
+#include "readloop.h"
+#include "rxring.h"
+
+static_assert((RX_RING_WORDS & (RX_RING_WORDS - 1)) == 0,
+        "RX_RING_WORDS must be a power of two");
+
+constexpr int channels_max = READLOOP_CHANNELS_MAX;
+
+// a ring per head channel
+struct ring_t {
+    volatile uint32_t * words;
+    int dma_ch[2] = {-1, -1};
+    volatile uint32_t halves_written = 0;   // irq
+    uint32_t read_pos = 0;                  // reader
+};
+
+static volatile uint32_t ring_buf[RX_RING_WORDS];
+static ring_t rings[channels_max];
+static int nrings = 0;
+static uint32_t ring_words = RX_RING_WORDS;    // of each, a power of two
+static uint32_t half_words = RX_RING_WORDS / 2;
+static volatile bool running = false;
+static volatile uint32_t overruns = 0;
+
+static void rxring_irq()
+{
+    for (int r = 0; r < nrings; ++r) {
+        ring_t & ring = rings[r];
+        for (int i = 0; i < 2; ++i) {
+            if (dma_channel_get_irq1_status(ring.dma_ch[i])) {
+                dma_channel_acknowledge_irq1(ring.dma_ch[i]);
+                // count first: the finished channel reads 0 until it is
+                // chained again, so the write position never goes backwards
+                ++ring.halves_written;
+                dma_channel_set_write_addr(ring.dma_ch[i], &ring.words[i * half_words],
+                        false);
+                dma_channel_set_trans_count(ring.dma_ch[i], half_words, false);
+            }
+        }
+    }
+}
+
+// total words written since start
+static uint32_t write_pos(const ring_t & ring)
+{
+    uint32_t halves, left;
+    do {
+        halves = ring.halves_written;
+        left = dma_channel_hw_addr(ring.dma_ch[halves & 1])->transfer_count;
+    } while (halves != ring.halves_written);
+
+    return halves * half_words + (half_words - left);
+}
+
+void rxring_start(PIO pio, uint sm, int channel, int channels)
+{
+    // started twice it would claim dma channels again and leak the others
+    if (running && channel < nrings) {
+        return;
+    }
+    if (channel == 0) {
+        overruns = 0;
+        nrings = 0;
+        // a power of two each
+        ring_words = RX_RING_WORDS;
+        while (ring_words * channels > RX_RING_WORDS) {
+            ring_words /= 2;
+        }
+        half_words = ring_words / 2;
+        irq_set_exclusive_handler(DMA_IRQ_1, rxring_irq);
+    }
+
+    ring_t & ring = rings[channel];
+    ring.words = &ring_buf[channel * ring_words];
+    ring.halves_written = 0;
+    ring.read_pos = 0;
+
+    for (int i = 0; i < 2; ++i) {
+        ring.dma_ch[i] = dma_claim_unused_channel(true);
+    }
+    for (int i = 0; i < 2; ++i) {
+        dma_channel_config c = dma_channel_get_default_config(ring.dma_ch[i]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+        channel_config_set_chain_to(&c, ring.dma_ch[i ^ 1]);
+        dma_channel_configure(ring.dma_ch[i], &c, &ring.words[i * half_words],
+                &pio->rxf[sm], half_words, false);
+        dma_channel_set_irq1_enabled(ring.dma_ch[i], true);
+    }
+    nrings = channel + 1;
+    irq_set_enabled(DMA_IRQ_1, true);
+
+    running = true;
+    dma_channel_start(ring.dma_ch[0]);
+}
+
+void rxring_stop()
+{
+    if (!running) {
+        return;
+    }
+    running = false;
+
+    irq_set_enabled(DMA_IRQ_1, false);
+    for (int r = 0; r < nrings; ++r) {
+        ring_t & ring = rings[r];
+        // unchain first, an aborted channel must not start the other one
+        for (int i = 0; i < 2; ++i) {
+            dma_channel_config c = dma_get_channel_config(ring.dma_ch[i]);
+            channel_config_set_chain_to(&c, ring.dma_ch[i]);
+            dma_channel_set_config(ring.dma_ch[i], &c, false);
+        }
+        for (int i = 0; i < 2; ++i) {
+            dma_channel_abort(ring.dma_ch[i]);
+            dma_channel_set_irq1_enabled(ring.dma_ch[i], false);
+            dma_channel_acknowledge_irq1(ring.dma_ch[i]);
+            dma_channel_unclaim(ring.dma_ch[i]);
+        }
+    }
+    irq_remove_handler(DMA_IRQ_1, rxring_irq);
+}
+
+void rxring_flush()
+{
+    for (int r = 0; r < nrings; ++r) {
+        rings[r].read_pos = write_pos(rings[r]);
+    }
+}
+
+bool rxring_get_channel(int channel, uint32_t * word)
+{
+    ring_t & ring = rings[channel];
+    for (;;) {
+        if (!running) {
+            return false;
+        }
+        uint32_t pos = write_pos(ring);
+        if (pos - ring.read_pos >= ring_words) {
+            // lapped: the word at read_pos is overwritten, the oldest half is gone, carry on half a ring behind
+            ++overruns;
+            ring.read_pos = pos - half_words;
+        }
+        if (pos != ring.read_pos) {
+            break;
+        }
+        tight_loop_contents();
+    }
+
+    *word = ring.words[ring.read_pos++ & (ring_words - 1)];
+    return true;
+}
+
+bool rxring_get(uint32_t * word)
+{
+    return rxring_get_channel(0, word);
+}
+
+uint32_t rxring_level()
+{
+    return running ? write_pos(rings[0]) - rings[0].read_pos : 0;
+}
+
+uint32_t rxring_overruns()
+{
+    return overruns;
+}
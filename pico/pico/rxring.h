@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include "hardware/pio.h"
+
+// rx state machine drained by DMA into a ring buffer of RX_RING_WORDS
+// two channels chained to each other each fill one half of the ring,
+// the DMA irq re-arms the finished one and counts the halves written
+//
+// with several head channels (see TAPE_CHANNELS) each state machine has
+// its own ring, they share the RX_RING_WORDS
+
+// head channel 0 starts over, the ones after it are added; channels is
+// how many there will be. A channel that is already running is left alone,
+// rxring_stop() first to start over
+void rxring_start(PIO pio, uint sm, int channel = 0, int channels = 1);
+void rxring_stop();
+
+// skip everything written so far, e.g. before relaunching the reader
+void rxring_flush();
+
+// readloop_word_sampler_t: next word from the ring, waits for the DMA
+// false when the ring is stopped
+bool rxring_get(uint32_t * word);
+
+// readloop_channel_sampler_t, the same from the ring of a head channel
+bool rxring_get_channel(int channel, uint32_t * word);
+
+uint32_t rxring_level();        // words written and not read yet
+uint32_t rxring_overruns();     // times the reader was lapped and skipped ahead
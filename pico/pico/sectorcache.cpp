@@ -0,0 +1,114 @@
+#include <cstdint>
+#include <cstring>
+#include <array>
+
+#include "config.h"
+#include "sectors.h"
+#include "readloop.h"
+#include "writequeue.h"
+#include "sectorcache.h"
+
+// few enough entries to find things by looking at all of them
+struct cache_entry_t {
+    int sector_num;     // -1 = free
+    uint32_t used;      // lru stamp
+};
+
+static std::array<cache_entry_t, SECTOR_CACHE_SECTORS> entries;
+static uint8_t payloads[SECTOR_CACHE_SECTORS][sector_payload_sz];
+
+// the cache gets what the other big buffers leave of the budget
+constexpr size_t other_buffers_sz = READLOOP_DEBUGBUF_LEN
+    + RX_RING_WORDS * sizeof(uint32_t) + record_buffers_sz
+    + WRITE_QUEUE_SECTORS * sizeof(write_queue_entry_t)
+    + MSC_STAGE_SECTORS * (sector_user_data_sz + sector_payload_sz);
+static_assert(other_buffers_sz + sizeof(entries) + sizeof(payloads) <= RAM_BUFFERS_BUDGET,
+        "SECTOR_CACHE_SECTORS: no room in RAM_BUFFERS_BUDGET");
+
+static uint32_t stamp = 0;
+static sector_cache_stats_t stats;
+
+static struct cache_init {
+    cache_init() { sector_cache_clear(); }
+} init;
+
+static int find(int sector_num)
+{
+    if (sector_num < 0) {
+        return -1;
+    }
+    for (size_t i = 0; i < entries.size(); ++i) {
+        if (entries[i].sector_num == sector_num) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+void sector_cache_clear()
+{
+    for (auto & e : entries) {
+        e.sector_num = -1;
+        e.used = 0;
+    }
+    stats = {};
+}
+
+bool sector_cache_get(int sector_num, uint8_t * payload)
+{
+    int i = find(sector_num);
+    if (i < 0) {
+        ++stats.misses;
+        return false;
+    }
+
+    ++stats.hits;
+    entries[i].used = ++stamp;
+    memcpy(payload, payloads[i], sector_payload_sz);
+    return true;
+}
+
+bool sector_cache_contains(int sector_num)
+{
+    return find(sector_num) >= 0;
+}
+
+void sector_cache_put(int sector_num, const uint8_t * payload)
+{
+    int i = find(sector_num);
+    if (i < 0) {
+        // free slots have stamp 0 and go first
+        i = 0;
+        for (size_t n = 1; n < entries.size(); ++n) {
+            if (entries[n].used < entries[i].used) {
+                i = n;
+            }
+        }
+        if (entries[i].sector_num >= 0) {
+            ++stats.evictions;
+        }
+    }
+
+    entries[i].sector_num = sector_num;
+    entries[i].used = ++stamp;
+    memcpy(payloads[i], payload, sector_payload_sz);
+}
+
+void sector_cache_invalidate(int sector_num)
+{
+    int i = find(sector_num);
+    if (i >= 0) {
+        entries[i].sector_num = -1;
+        entries[i].used = 0;
+    }
+}
+
+sector_cache_stats_t sector_cache_stats()
+{
+    sector_cache_stats_t s = stats;
+    s.used = 0;
+    for (const auto & e : entries) {
+        s.used += e.sector_num >= 0;
+    }
+    return s;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+
+// decoded sector payloads in ram, least recently used goes first
+//
+// payloads are sector_payload_sz bytes as the reader decodes them:
+// FEC_BLOCKS_PER_SECTOR chunk_payload_t with their crc
+// the cache knows nothing about cassettes, llformat clears it and so
+// should anything that notices a different tape
+
+void sector_cache_clear();
+
+// copy the payload out if it is cached, it becomes the most recently used
+bool sector_cache_get(int sector_num, uint8_t * payload);
+
+bool sector_cache_contains(int sector_num);
+
+// add or replace, evicts the least recently used if full
+void sector_cache_put(int sector_num, const uint8_t * payload);
+
+// the sector on tape changed
+void sector_cache_invalidate(int sector_num);
+
+struct sector_cache_stats_t {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    int used;
+};
+
+sector_cache_stats_t sector_cache_stats();
@@ -0,0 +1,140 @@
+#include <cstdint>
+#include <cstring>
+#include "pico/stdlib.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+
+#include "config.h"
+#include "sectors.h"
+#include "sectorindex.h"
+
+constexpr uint16_t no_entry = 0xffff;   // erased flash
+constexpr uint32_t index_magic = 0x58444953;    // "SIDX"
+
+struct sector_index_image_t {
+    uint32_t magic;
+    uint32_t reserved;
+    uint16_t counter[sector_num_max + 1];
+};
+
+// flash is erased by sectors and programmed by pages
+constexpr size_t image_flash_size = (sizeof(sector_index_image_t)
+        + FLASH_SECTOR_SIZE - 1) / FLASH_SECTOR_SIZE * FLASH_SECTOR_SIZE;
+
+static_assert(SECTOR_INDEX_FLASH_OFFSET % FLASH_SECTOR_SIZE == 0,
+        "SECTOR_INDEX_FLASH_OFFSET must be flash sector aligned");
+static_assert(SECTOR_INDEX_FLASH_OFFSET + image_flash_size <= PICO_FLASH_SIZE_BYTES,
+        "sector index does not fit in flash");
+
+// padded to whole pages for flash_range_program
+static union {
+    sector_index_image_t image;
+    uint8_t bytes[image_flash_size];
+} table;
+
+static bool dirty = false;
+
+static int entry(int sector_num)
+{
+    return table.image.counter[sector_num];
+}
+
+void sector_index_clear()
+{
+    memset(&table, 0xff, sizeof(table));
+    table.image.magic = index_magic;
+    dirty = true;
+}
+
+void sector_index_load()
+{
+    const uint8_t * flash = (const uint8_t *)(XIP_BASE + SECTOR_INDEX_FLASH_OFFSET);
+    memcpy(&table, flash, sizeof(table));
+    if (table.image.magic != index_magic) {
+        sector_index_clear();
+    }
+    dirty = false;
+}
+
+bool sector_index_save()
+{
+    if (!dirty) {
+        return false;
+    }
+
+    uint32_t irq = save_and_disable_interrupts();
+    flash_range_erase(SECTOR_INDEX_FLASH_OFFSET, sizeof(table));
+    flash_range_program(SECTOR_INDEX_FLASH_OFFSET, table.bytes, sizeof(table));
+    restore_interrupts(irq);
+
+    dirty = false;
+    return true;
+}
+
+void sector_index_update(int sector_num, int counter)
+{
+    if (sector_num < 0 || sector_num > sector_num_max) {
+        return;
+    }
+
+    // the counter can go a little negative near BOT after a rewind
+    if (counter < 0) counter = 0;
+    if (counter >= no_entry) counter = no_entry - 1;
+
+    int old = entry(sector_num);
+    int value = old == no_entry ? counter : old + (counter - old) / 4;
+    if (value != old) {
+        table.image.counter[sector_num] = value;
+        dirty = true;
+    }
+}
+
+// nearest sector with an entry from sector_num going in dir, -1 if none
+static int nearest(int sector_num, int dir)
+{
+    for (int n = sector_num; n >= 0 && n <= sector_num_max; n += dir) {
+        if (entry(n) != no_entry) {
+            return n;
+        }
+    }
+    return -1;
+}
+
+bool sector_index_predict(int sector_num, int * counter)
+{
+    if (sector_num < 0 || sector_num > sector_num_max) {
+        return false;
+    }
+
+    if (entry(sector_num) != no_entry) {
+        *counter = entry(sector_num);
+        return true;
+    }
+
+    int lo = nearest(sector_num, -1);
+    int hi = nearest(sector_num, +1);
+    if (lo < 0 && hi >= 0) {
+        lo = hi;
+        hi = nearest(hi + 1, +1);
+    }
+    else if (hi < 0 && lo >= 0) {
+        hi = lo;
+        lo = nearest(lo - 1, -1);
+    }
+    if (lo < 0 || hi < 0) {
+        return false;
+    }
+
+    // straight line through both, the reel radius changes slowly enough
+    *counter = entry(lo) + (entry(hi) - entry(lo)) * (sector_num - lo) / (hi - lo);
+    return true;
+}
+
+int sector_index_count()
+{
+    int count = 0;
+    for (int n = 0; n <= sector_num_max; ++n) {
+        count += entry(n) != no_entry;
+    }
+    return count;
+}
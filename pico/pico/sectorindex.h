@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstdint>
+
+// sector number -> tacho counter, for winding to a sector instead of
+// reading the whole tape up to it
+//
+// llformat records where every sector starts, reads refine it; counter
+// values are only good if the counter is zeroed at BOT like llformat does
+// the table is kept in ram and saved to the last sectors of flash
+
+// load the table saved in flash, empty if there is none
+void sector_index_load();
+
+// write the table to flash if it changed since load, core1 must be stopped
+// (flash is not readable while it is programmed); false if nothing written
+bool sector_index_save();
+
+void sector_index_clear();
+
+// sector seen at counter: the first sighting is taken as is, later ones
+// pull the entry towards them
+void sector_index_update(int sector_num, int counter);
+
+// predicted counter at the start of sector_num, interpolated between known
+// sectors or extrapolated from the nearest two; false if fewer than two
+// sectors are known
+bool sector_index_predict(int sector_num, int * counter);
+
+// number of sectors with an entry
+int sector_index_count();
@@ -1,4 +1,5 @@
 #include <cstdint>
+#include <cstring>
 #include <array>
 #include <algorithm>
 #include <string>
@@ -7,58 +8,151 @@
 #include "sectors.h"
 #include "correct.h"
 #include "crc.h"
-#include "mfm.h"
+#include "modulation.h"
 
 #include "pico/multicore.h"
 
+// the static instance of a profile: tables in flash, nothing to set up or
+// free. the writer (core0) and the reader (core1) may share one, encode and
+// decode have separate scratch
+static correct_reed_solomon * fec_rs(uint8_t profile)
+{
+    static_assert(fec_block_length == 255 && fec_min_distance == 32
+            && fec_parity(FEC_LIGHT) == 16 && fec_parity(FEC_STRONG) == 64,
+            "static instances are (255, 223), (255, 239) and (255, 191) codes");
+    return profile == FEC_LIGHT ? correct_reed_solomon_ccsds_255_239()
+        : profile == FEC_STRONG ? correct_reed_solomon_ccsds_255_191()
+        : correct_reed_solomon_ccsds_255_223();
+}
+
+// the inner code of FEC_CONCAT: libcorrect's instances keep state while
+// coding, so writers and readers have one each. Made the first time a
+// FEC_CONCAT record comes by and run once, the decoder allocates its tables
+// on the first decode; the reader's is made on core1, malloc is under the
+// sdk's mutex with pico_multicore
+static correct_convolutional * fec_conv()
+{
+    correct_convolutional * conv = correct_convolutional_create(2, fec_inner_order,
+            correct_conv_r12_7_polynomial);
+    std::array<uint8_t, 4> warmup = {};
+    correct_convolutional_decode(conv, warmup.begin(), 8 * warmup.size(),
+            warmup.begin());
+    return conv;
+}
+
+static correct_convolutional * fec_conv_tx()
+{
+    static correct_convolutional * conv = fec_conv();
+    return conv;
+}
+
+static correct_convolutional * fec_conv_rx()
+{
+    static correct_convolutional * conv = fec_conv();
+    return conv;
+}
+
 // prepare sector for writing
 // returns number of bytes taken from data
 size_t
 SectorWriter::prepare(const uint8_t * data, size_t data_sz)
 {
-    size_t use_bytes;
-    for (size_t i = 0; i < txbuf.chunks.size(); ++i) {
-        use_bytes = std::min(payload_data_sz, data_sz);
-        auto & chunk = txbuf.chunks[i];
-        std::copy(data, data + use_bytes, chunk.rawbuf.begin());
-        if (use_bytes < payload_data_sz) {
-            std::fill(chunk.rawbuf.begin() + use_bytes,
-                    chunk.rawbuf.begin() + payload_data_sz, 0);
+    // the payload goes back to back into txbuf first: chunk_payload_t with
+    // their crc, or the whole record and a crc in the last two bytes
+    size_t payload_sz = record_payload_sz(format);
+    uint8_t * payload = txbuf.raw.begin();
+    size_t taken = 0;
+
+    if (sector_chunk_crc(format)) {
+        auto chunks = reinterpret_cast<chunk_payload_t *>(payload);
+        for (size_t i = 0; i < payload_sz / sizeof(chunk_payload_t); ++i) {
+            size_t use_bytes = std::min(payload_data_sz, data_sz);
+            std::copy(data, data + use_bytes, chunks[i].data);
+            std::fill(chunks[i].data + use_bytes, chunks[i].data + payload_data_sz, 0);
+            chunks[i].crc16 = calculate_crc(chunks[i].data, payload_data_sz);
+            data_sz -= use_bytes;
+            data += use_bytes;
+            taken += use_bytes;
         }
-        chunk.p.payload.crc16 = calculate_crc(chunk.p.payload.data, payload_data_sz);
+    }
+    else {
+        taken = std::min(payload_sz - 2, data_sz);
+        std::copy(data, data + taken, payload);
+        std::fill(payload + taken, payload + payload_sz - 2, 0);
+        uint16_t record_crc = calculate_crc(payload, payload_sz - 2);
+        payload[payload_sz - 2] = record_crc & 255;
+        payload[payload_sz - 1] = record_crc >> 8;
+    }
 
-        const uint8_t * as_bytes = reinterpret_cast<const uint8_t *>(&chunk);
-        correct_reed_solomon_encode(rs_tx, as_bytes, fec_message_sz,
-                chunk.rawbuf.begin());
+    // then each message moves to its full_chunk_t, the last one first so
+    // that nothing is overwritten before it has moved, and gets its parity
+    size_t msg_sz = sector_message_sz(format, profile);
+    size_t block_len = sector_block_len(format, profile);
+    std::fill(payload + payload_sz, payload + blocks * msg_sz, 0);
+    for (size_t n = blocks; n-- > 0; ) {
+        uint8_t * chunk = txbuf.chunks[n].rawbuf.begin();
+        memmove(chunk, payload + n * msg_sz, msg_sz);
+        correct_reed_solomon_encode(rs_tx, chunk, msg_sz, chunk);
+        std::fill(chunk + block_len, chunk + stride, 0);
+    }
 
-        data_sz -= use_bytes;
-        data += use_bytes;
+    // inner code: the blocks in tape order go to the top of txbuf, coded
+    // from there into the bottom
+    if (inner) {
+        size_t outer_sz = record_outer_sz(format, profile);
+        uint8_t * outer = txbuf.raw.end() - outer_sz;
+        for (size_t i = 0; i < outer_sz; ++i) {
+            outer[i] = tape_byte(i);
+        }
+        correct_convolutional_encode(conv_tx, outer, outer_sz, txbuf.raw.begin());
     }
 
-    return use_bytes;
+    return taken;
 }
 
 SectorWriter::SectorWriter(sector_data_t& txbuf) : txbuf(txbuf)
 {
-    rs_tx = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds,
-            1, 1, fec_min_distance);
+    set_format(SF_LINEAR, FEC_STANDARD);
 }
 
 SectorWriter::~SectorWriter()
 {
-    correct_reed_solomon_destroy(rs_tx);
+}
+
+void
+SectorWriter::set_format(uint8_t format, uint8_t profile)
+{
+    this->format = format;
+    this->profile = profile;
+    rs_tx = fec_rs(profile);
+    // operator[] runs for every byte, no divisions there
+    blocks = sector_blocks(format, profile);
+    stride = sector_block_stride(format, profile);
+    inner = fec_inner(format, profile);
+    if (inner) {
+        conv_tx = fec_conv_tx();
+    }
+}
+
+const uint8_t&
+SectorWriter::tape_byte(size_t i)
+{
+    if (format == SF_INTERLEAVED || format == SF_TRACK) {
+        return txbuf.chunks[i % blocks].rawbuf[i / blocks];
+    }
+    return txbuf.chunks[i / stride].rawbuf[i % stride];
 }
 
 const uint8_t&
 SectorWriter::operator[](size_t i)
 {
-    return txbuf.raw[i];
+    return inner ? txbuf.raw[i] : tape_byte(i);
 }
 
 size_t
 SectorWriter::size() const
 {
-    return txbuf.raw.size();
+    return record_data_sz(format, profile);
 }
 
 uint16_t calculate_crc(uint8_t * data, size_t len)
@@ -66,54 +160,249 @@ uint16_t calculate_crc(uint8_t * data, size_t len)
     return MODBUS_CRC16_v3(data, len);
 }
 
-SectorReader::SectorReader(sector_data_t& rxbuf, uint8_t * decoded_buf)
-    : rxbuf(rxbuf), decoded_buf(decoded_buf)
+std::array<uint32_t, rx_words_max> SectorReader::rxwords;
+std::array<uint8_t, rx_words_max> SectorReader::rxflags;
+std::array<uint8_t, rx_words_max> SectorReader::rxsoft;
+
+SectorReader::SectorReader(sector_data_t& rxbuf, uint8_t * decoded_buf, int channels,
+        uint8_t modulation)
+    : rxbuf(rxbuf), decoded_buf(decoded_buf), rxwords_count(sector_data_sz / 2),
+      rx(), channels(std::min(std::max(channels, 1), sector_channels_max)),
+      modulation(modulation < MOD_COUNT ? modulation : (uint8_t)MOD_MFM),
+      record_open(false), headers_only(false), channels_done(0)
 {
-    rs_rx = correct_reed_solomon_create(correct_rs_primitive_polynomial_ccsds,
-            1, 1, fec_min_distance);
+    rs_rx = fec_rs(FEC_STANDARD);
+    for (int ch = 0; ch < sector_channels_max; ++ch) {
+        rx[ch].reader = this;
+        rx[ch].channel = ch;
+        rx_users[ch] = &rx[ch];
+    }
 }
 
 SectorReader::~SectorReader()
 {
-    correct_reed_solomon_destroy(rs_rx);
 }
 
-// decodes and verifies data from rx_sector_buf
-int SectorReader::correct_sector_data()
+// the received words into bytes in tape order, each channel's words as
+// the stream they are on tape with its flush words after its last; erasure
+// hints go to flags if it isn't 0: clock violations, or what isn't a
+// codeword
+template <class M>
+void SectorReader::demodulate_record(uint8_t * dst, uint8_t * flags)
 {
-    // decode all blocks in sector
+    for (int ch = 0; ch < channels; ++ch) {
+        M::decode_words(rxwords.begin() + ch, rx[ch].rxwords_count - M::flush_words,
+                channels, rx[ch].rxsync, dst + 2 * ch, flags ? flags + ch : 0);
+    }
+}
 
-    int nerrors = 0;
+// the received words of an inner coded record are demodulated into the
+// top of rxbuf and decoded from there into the bottom, where the blocks
+// are in tape order as with the others
+template <class M>
+void SectorReader::inner_decode()
+{
+    size_t data_sz = record_data_sz(sector_format, sector_profile);
+    uint8_t * coded = rxbuf.raw.end() - data_sz;
+    demodulate_record<M>(coded, 0);
+    if (!conv_rx) {
+        conv_rx = fec_conv_rx();
+    }
+    correct_convolutional_decode(conv_rx, coded, 8 * data_sz, rxbuf.raw.begin());
+}
+
+// bring the blocks of a record from tape order each into its full_chunk_t,
+// rxwords is free by now and serves as the scratch copy
+void SectorReader::deinterleave()
+{
+    static_assert(sizeof(rxwords) >= sizeof(sector_data_t), "scratch too small");
+    size_t stride = sector_block_stride(sector_format, sector_profile);
+    if (sector_format == SF_LINEAR && stride == sizeof(full_chunk_t)) {
+        return;     // already there
+    }
 
-    uint8_t * dst = decoded_buf;
-    for (size_t n = 0; n < FEC_BLOCKS_PER_SECTOR; ++n) {
-        ssize_t decoded_sz = correct_reed_solomon_decode(rs_rx, 
-            /* encoded */         rxbuf.chunks[n].rawbuf.begin(),
-            /* encoded_length */  fec_block_length,
-            /* msg */             dst);
-        if (decoded_sz <= 0) {
-            std::copy_n(rxbuf.chunks[n].rawbuf.begin(), payload_data_sz, dst);
-            //printf("\n\n--- error ---\n");
-            ++nerrors;
+    uint8_t * tape = reinterpret_cast<uint8_t *>(rxwords.begin());
+    size_t blocks = sector_blocks(sector_format, sector_profile);
+    bool interleaved = sector_format != SF_LINEAR;
+    std::copy_n(rxbuf.raw.begin(), blocks * stride, tape);
+    for (size_t n = 0; n < blocks; ++n) {
+        auto & chunk = rxbuf.chunks[n].rawbuf;
+        for (size_t i = 0; i < stride; ++i) {
+            chunk[i] = tape[interleaved ? i * blocks + n : n * stride + i];
         }
-        else {
-            uint16_t crc = calculate_crc(dst, payload_data_sz);
-            if (crc != rxbuf.chunks[n].p.payload.crc16) {
-                //printf("\n\n--- crc error ---\n");
-                ++nerrors;
+    }
+}
+
+// positions of flagged bytes in fec block n, 0 if there are more than
+// the code can take, in which case plain decoding is the better bet
+size_t SectorReader::chunk_erasures(size_t n, uint8_t * dst)
+{
+    size_t parity = fec_parity(sector_profile);
+    size_t block_len = sector_block_len(sector_format, sector_profile);
+    size_t blocks = sector_blocks(sector_format, sector_profile);
+    size_t stride = sector_block_stride(sector_format, sector_profile);
+    bool interleaved = sector_format != SF_LINEAR;
+    size_t count = 0;
+    for (size_t i = 0; i < block_len; ++i) {
+        // as sector_byte_pos(), without the divisions
+        size_t pos = interleaved ? i * blocks + n : n * stride + i;
+        if (rxflags[pos / 2] & (2 >> (pos & 1))) {
+            if (count == parity) {
+                return 0;
             }
+            dst[count++] = i;
         }
+    }
+    return count;
+}
 
-        dst += sizeof(chunk_payload_t);
+// the least reliable bytes of fec block n, up to count of them: flagged
+// ones first, then by soft confidence up to soft_level, in block order
+// within a level
+size_t SectorReader::soft_erasures(size_t n, uint8_t * dst, size_t count,
+        int soft_level)
+{
+    size_t block_len = sector_block_len(sector_format, sector_profile);
+    size_t blocks = sector_blocks(sector_format, sector_profile);
+    size_t stride = sector_block_stride(sector_format, sector_profile);
+    bool interleaved = sector_format != SF_LINEAR;
+    size_t found = 0;
+    for (int level = -1; level <= soft_level && found < count; ++level) {
+        for (size_t i = 0; i < block_len && found < count; ++i) {
+            size_t pos = interleaved ? i * blocks + n : n * stride + i;
+            int confidence = rxflags[pos / 2] & (2 >> (pos & 1))
+                ? -1 : (rxsoft[pos / 2] >> (pos & 1 ? 0 : 4)) & 0xf;
+            if (confidence == level) {
+                dst[found++] = i;
+            }
+        }
     }
+    return found;
+}
 
-    return nerrors;
+// block n into its place in decoded_buf, with the erasure hints if there
+// are any; false if it can't be decoded, the message as received is left
+// there then
+bool SectorReader::decode_block(size_t n, bool hints)
+{
+    size_t msg_sz = sector_message_sz(sector_format, sector_profile);
+    size_t block_len = sector_block_len(sector_format, sector_profile);
+    const uint8_t * block = rxbuf.chunks[n].rawbuf.begin();
+    uint8_t * dst = decoded_buf + n * msg_sz;
+
+    hinted &= ~(1u << n);
+    softened &= ~(1u << n);
+    std::array<uint8_t, fec_parity_max> erasure_pos;
+    size_t nerasures = 0;
+    if (hints) {
+        nerasures = chunk_erasures(n, erasure_pos.begin());
+        if (nerasures) {
+            erasures += nerasures;
+            if (correct_reed_solomon_decode_with_erasures(rs_rx, block, block_len,
+                        erasure_pos.begin(), nerasures, dst) > 0) {
+                hinted |= 1u << n;
+                return true;
+            }
+        }
+    }
+    // no hints, or too many
+    if (correct_reed_solomon_decode(rs_rx, block, block_len, dst) > 0) {
+        return true;
+    }
+    // neither: erase the least reliable bytes by the dll's soft decisions,
+    // flagged ones and those sampled closest to a transition; half the
+    // parity at most, with all of it erased any garbage decodes, the rest
+    // finds and corrects errors among the other bytes. Then fewer of them
+    size_t parity = fec_parity(sector_profile);
+    for (size_t max = parity / 2; hints && DLL_SOFT && max >= parity / 8; max /= 2) {
+        size_t count = soft_erasures(n, erasure_pos.begin(), max, READLOOP_SOFT_MAX - 1);
+        if (!count || count == nerasures) {
+            break;
+        }
+        nerasures = count;
+        erasures += count;
+        if (correct_reed_solomon_decode_with_erasures(rs_rx, block, block_len,
+                    erasure_pos.begin(), count, dst) > 0) {
+            hinted |= 1u << n;
+            softened |= 1u << n;
+            return true;
+        }
+    }
+    std::copy_n(block, msg_sz, dst);
+    return false;
+}
+
+// decodes and verifies data from rx_sector_buf: the payload goes back to
+// back into decoded_buf; returns the number of blocks that can't be decoded
+// and of crcs that don't check out, 0 if the record is good
+int SectorReader::correct_sector_data()
+{
+    if (sector_format >= SF_COUNT) {
+        return FEC_BLOCKS_PER_SECTOR;
+    }
+
+    // erasure hints are of tape words, flagged as they were demodulated;
+    // the inner code's decoder has used up what they could tell
+    rs_rx = fec_rs(sector_profile);
+    bool hints = RS_ERASURES && !fec_inner(sector_format, sector_profile);
+    deinterleave();
+
+    // decode all blocks in the record
+    size_t blocks = sector_blocks(sector_format, sector_profile);
+    static_assert(FEC_BLOCKS_MAX <= 32, "block masks are 32 bits");
+    uint32_t failed = 0;
+    hinted = 0;
+    softened = 0;
+    for (size_t n = 0; n < blocks; ++n) {
+        if (!decode_block(n, hints)) {
+            failed |= 1u << n;
+        }
+    }
+
+    // the crcs: of every chunk_payload_t, or of the record in its last two
+    // bytes; where one doesn't check out, the blocks under it that took
+    // erasure hints are decoded again without, the hints may have been wrong
+    bool chunk_crc = sector_chunk_crc(sector_format);
+    size_t payload_sz = record_payload_sz(sector_format);
+    size_t crc_len = chunk_crc ? sizeof(chunk_payload_t) : payload_sz;
+    size_t msg_sz = sector_message_sz(sector_format, sector_profile);
+    int nerrors = 0;
+    for (size_t from = 0; from < payload_sz; from += crc_len) {
+        uint8_t * piece = decoded_buf + from;
+        size_t len = crc_len - 2;
+        auto crc_ok = [&]() {
+            return calculate_crc(piece, len) == (piece[len] | piece[len + 1] << 8);
+        };
+        if (crc_ok()) {
+            continue;
+        }
+        uint32_t under = 0;
+        for (size_t n = from / msg_sz; n <= (from + crc_len - 1) / msg_sz; ++n) {
+            under |= 1u << n;
+        }
+        if (hinted & under) {
+            for (size_t n = 0; n < blocks; ++n) {
+                if (hinted & under & (1u << n) && !decode_block(n, false)) {
+                    failed |= 1u << n;
+                }
+            }
+            if (crc_ok()) {
+                continue;
+            }
+        }
+        ++nerrors;
+    }
+
+    erasure_blocks += __builtin_popcount(hinted);
+    soft_blocks += __builtin_popcount(hinted & softened);
+    return nerrors + __builtin_popcount(failed);
 }
 
 // Boyer-Moore majority vote
 int
-SectorReader::pick_sector_num()
+SectorReader::pick_sector_num(const channel_rx_t & c)
 {
+    const auto & sector_nums = c.sector_nums;
     int votes = 0, candidate = -1;
 
     for (size_t i = 0; i < sector_nums.size(); ++i) {
@@ -143,23 +432,54 @@ SectorReader::pick_sector_num()
     return -1;
 }
 
-// sector reader callback (core1)
+// the first channel through a header starts a record, the others join it
+// with theirs; one that's still open is lost
+void SectorReader::start_record(channel_rx_t & c, int header)
+{
+    if (record_open && c.sector_number == sector_number
+            && !(channels_done & (1u << c.channel))) {
+        return;
+    }
+    if (record_open && channels_done) {
+        multicore_fifo_push_blocking(MSG_SECTOR_READ_ERROR + sector_number);
+    }
+
+    sector_number = c.sector_number;
+    sector_format = header < 0 ? SF_COUNT
+        : (header >> sector_num_bits) & ((1 << sector_format_bits) - 1);
+    sector_profile = header < 0 ? FEC_STANDARD
+        : header >> (sector_num_bits + sector_format_bits);
+    if (!record_built(sector_format, sector_profile)) {
+        sector_format = SF_COUNT;
+        sector_profile = FEC_STANDARD;
+    }
+    rxwords_count = record_data_sz(sector_format, sector_profile) / 2;
+    record_open = true;
+    channels_done = 0;
+
+    // for (size_t i = 0; i < c.sector_nums.size(); ++i) {
+    //     printf("X %04x", c.sector_nums[i]);
+    // }
+    // putchar('\n');
+
+    multicore_fifo_push_blocking(MSG_SECTOR_FOUND + sector_number);
+}
+
+static_assert(sizeof(sector_data_t) % 2 == 0, "sector data is read in words");
+
+// sector reader callback of a channel (core1), the modulations decode
+// in either polarity
+template <class M>
 readloop_state_t
-SectorReader::readloop_callback(readloop_state_t state, uint32_t bits)
+SectorReader::channel_state(channel_rx_t & c, readloop_state_t state, uint32_t bits)
 {
     switch (state) {
         // seek sector start
         case TS_RESYNC_SECTOR:
             {
-                sector_nums_index = 0;
-                if (bits == SYNC_SECTOR) {
-                    inverted = 0x0;
-                    prev_level = 1;
-                    return TS_READ_SECTOR;
-                }
-                else if (~bits == SYNC_SECTOR) {
-                    inverted = 0xffffffff;
-                    prev_level = 0;
+                c.sector_nums_index = 0;
+                c.rxsync = bits;
+                if (bits == M::sync_sector || ~bits == M::sync_sector) {
                     return TS_READ_SECTOR;
                 }
             }
@@ -167,34 +487,39 @@ SectorReader::readloop_callback(readloop_state_t state, uint32_t bits)
         // read sector number
         case TS_READ_SECTOR:
             {
-                uint8_t c1, c2;
-                demodulate(bits ^ inverted, &c1, &c2, &prev_level);
-                sector_nums[sector_nums_index] = (c1 << 8) | c2;
-                if (++sector_nums_index == 3) {
-                    sector_number = pick_sector_num();
-
-                    // for (size_t i = 0; i < sector_nums.size(); ++i) {
-                    //     printf("X %04x", sector_nums[i]);
-                    // }
-                    // putchar('\n');
-
-                    multicore_fifo_push_blocking(MSG_SECTOR_FOUND + sector_number);
-                    return TS_RESYNC_DATA;
+                static_assert(M::flush_words <= modulation_flush_max, "header words");
+                c.header_words[c.sector_nums_index] = bits;
+                if (++c.sector_nums_index < SECTOR_NUM_REPEATS + M::flush_words) {
+                    break;
+                }
+                std::array<uint8_t, SECTOR_NUM_REPEATS * 2> b;
+                M::decode_words(c.header_words.begin(), SECTOR_NUM_REPEATS, 1,
+                        c.rxsync, b.begin(), 0);
+                for (size_t i = 0; i < c.sector_nums.size(); ++i) {
+                    c.sector_nums[i] = (b[2 * i] << 8) | b[2 * i + 1];
                 }
+                int header = pick_sector_num(c);
+                c.sector_number = header < 0 ? -1 : header & sector_num_max;
+                start_record(c, header);
+                if (headers_only) {
+                    return TS_RESYNC_SECTOR;
+                }
+                c.rxwords_count = sector_channel_words(rxwords_count, channels, c.channel)
+                    + M::flush_words;
+                c.resync_bits = 0;
+                return TS_RESYNC_DATA;
             }
-            break;
         // seek data / sector payload start
         case TS_RESYNC_DATA:
             {
-                rxbuf_index = 0;
-                if (bits  == SYNC_DATA) {
-                    inverted = 0x0;
-                    prev_level = 1;
-                    return TS_READ_DATA;
+                // until a whole word is in, the header and the leader
+                // together can look like SYNC_DATA (0x4001 does)
+                if (++c.resync_bits < 32) {
+                    break;
                 }
-                else if (~bits == SYNC_DATA) {
-                    inverted = 0xffffffff;
-                    prev_level = 0;
+                c.rxwords_index = 0;
+                c.rxsync = bits;
+                if (bits == M::sync_data || ~bits == M::sync_data) {
                     return TS_READ_DATA;
                 }
             }
@@ -202,28 +527,47 @@ SectorReader::readloop_callback(readloop_state_t state, uint32_t bits)
         // read the meat of the sector
         case TS_READ_DATA:
             {
-                uint8_t c1, c2;
-                demodulate(bits ^ inverted, &c1, &c2, &prev_level);
-                rxbuf.raw[rxbuf_index++] = c1;
-                if (rxbuf_index < rxbuf.raw.size()) {
-                    rxbuf.raw[rxbuf_index++] = c2;
+                // word k of channel ch is word k * channels + ch of the record
+                size_t i = c.rxwords_index++ * channels + c.channel;
+                uint32_t spikes = readloop_phase_spikes();
+                rxflags[i] = (spikes >> 16 ? 2 : 0) | (spikes & 0xffff ? 1 : 0);
+                if (DLL_SOFT) {
+                    rxsoft[i] = M::soft_confidence(readloop_soft_bits());
                 }
-                if (rxbuf_index < rxbuf.raw.size()) {
+                rxwords[i] = bits;
+                if (c.rxwords_index < c.rxwords_count) {
                     return TS_READ_DATA;
                 }
+
+                // the last channel in decodes
+                if (!record_open || c.sector_number != sector_number) {
+                    return TS_RESYNC_SECTOR;
+                }
+                channels_done |= 1u << c.channel;
+                if (channels_done != (1u << channels) - 1) {
+                    return TS_RESYNC_SECTOR;
+                }
+                record_open = false;
+
+                if (fec_inner(sector_format, sector_profile)) {
+                    inner_decode<M>();
+                }
                 else {
+                    demodulate_record<M>(rxbuf.raw.begin(),
+                            RS_ERASURES ? rxflags.begin() : 0);
+                }
 #if LOOPBACK_TEST
-                    fuckup_sector_data();
+                fuckup_sector_data();
 #endif
-                    int nerrors = correct_sector_data();
-                    if (nerrors == 0) {
-                        multicore_fifo_push_blocking(MSG_SECTOR_READ_DONE + sector_number);
-                    }
-                    else {
-                        multicore_fifo_push_blocking(MSG_SECTOR_READ_ERROR + sector_number);
-                    }
-                    return TS_RESYNC_SECTOR;  // seek next sector
+                int nerrors = correct_sector_data();
+                record_format = sector_format;
+                if (nerrors == 0) {
+                    multicore_fifo_push_blocking(MSG_SECTOR_READ_DONE + sector_number);
+                }
+                else {
+                    multicore_fifo_push_blocking(MSG_SECTOR_READ_ERROR + sector_number);
                 }
+                return TS_RESYNC_SECTOR;  // seek next sector
             }
             break;
         default:
@@ -232,10 +576,35 @@ SectorReader::readloop_callback(readloop_state_t state, uint32_t bits)
     return state;
 }
 
+// sector reader callback of a single channel (core1)
+template <class M>
 readloop_state_t
-SectorReader::readloop_callback_s(readloop_state_t state, uint32_t bits,
+SectorReader::readloop_callback_m(readloop_state_t state, uint32_t bits,
         void * instance)
 {
-    return reinterpret_cast<SectorReader *>(instance)->
-        readloop_callback(state, bits);
+    SectorReader * reader = reinterpret_cast<SectorReader *>(instance);
+    return reader->channel_state<M>(reader->rx[0], state, bits);
+}
+
+template <class M>
+readloop_state_t
+SectorReader::channel_callback_m(readloop_state_t state, uint32_t bits,
+        void * channel)
+{
+    channel_rx_t * c = reinterpret_cast<channel_rx_t *>(channel);
+    return c->reader->channel_state<M>(*c, state, bits);
+}
+
+readloop_callback_t SectorReader::readloop_callback() const
+{
+    return with_modulation(modulation, [](auto m) -> readloop_callback_t {
+        return readloop_callback_m<decltype(m)>;
+    });
+}
+
+readloop_callback_t SectorReader::channel_callback() const
+{
+    return with_modulation(modulation, [](auto m) -> readloop_callback_t {
+        return channel_callback_m<decltype(m)>;
+    });
 }
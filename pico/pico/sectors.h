@@ -3,10 +3,12 @@
 #include <cstdint>
 #include <string>
 #include <array>
+#include <algorithm>
 
 #include "config.h"
 #include "correct.h"
 #include "readloop.h"
+#include "modulation.h"
 
 // error correction
 constexpr size_t fec_block_length = 255;    // libcorrect requirement
@@ -35,33 +37,331 @@ union full_chunk_t {
     std::array<uint8_t, fec_block_length + 1> rawbuf;
 } __attribute__((packed));
 
-// 256 * 4 = 1024
-union sector_data_t {
-    std::array<full_chunk_t, FEC_BLOCKS_PER_SECTOR> chunks;
-    std::array<uint8_t, sizeof(full_chunk_t) * FEC_BLOCKS_PER_SECTOR> raw;
-} __attribute__((packed));
-
 // 892: 4x chunk_payload_t (with crc16 inline)
 constexpr size_t sector_payload_sz = sizeof(chunk_payload_t) * FEC_BLOCKS_PER_SECTOR;
 
 constexpr size_t sector_user_data_sz = payload_data_sz * FEC_BLOCKS_PER_SECTOR;
 
+// bytes on tape of a sector with the standard profile
+constexpr size_t sector_data_sz = sizeof(full_chunk_t) * FEC_BLOCKS_PER_SECTOR;
+
+// a track record has no crc per block: 5129 bytes of fec messages hold the
+// track, zeros and a crc16 of everything before it in the last two bytes
+constexpr size_t track_payload_sz = fec_message_sz * FEC_BLOCKS_PER_TRACK;
+constexpr size_t track_user_data_sz = 5 * 1024;
+static_assert(track_user_data_sz + 2 <= track_payload_sz, "track doesn't fit");
+
+// how the fec blocks of a sector are laid out on tape
+enum sector_format_t : uint8_t {
+    SF_LINEAR = 0,      // blocks back to back, as on tapes from before formats
+    SF_INTERLEAVED,     // byte i of block n at i * sector_blocks() + n,
+                        // a burst is spread over all blocks
+    SF_TRACK,           // interleaved FEC_BLOCKS_PER_TRACK blocks, one per
+                        // emulated disk track: fewer headers and gaps
+    SF_COUNT
+};
+
+constexpr const char * sector_format_name(uint8_t format)
+{
+    return format == SF_LINEAR ? "linear"
+        : format == SF_INTERLEAVED ? "interleaved"
+        : format == SF_TRACK ? "track" : "unknown";
+}
+
+// fec strength, chosen per sector by llformat and kept in the header: the
+// payload of a record is the same with every profile, a stronger one cuts
+// it into more and shorter blocks and takes more tape
+enum fec_profile_t : uint8_t {
+    FEC_STANDARD = 0,   // (255, 223), as on tapes from before profiles
+    FEC_LIGHT,          // (255, 239): healthy tape, shorter sectors
+    FEC_STRONG,         // (255, 191): the ends of the tape, worn spots
+    FEC_CONCAT,         // (255, 223) outer, rate 1/2 convolutional inner code,
+                        // see fec_inner()
+    FEC_PROFILE_COUNT
+};
+
+constexpr const char * fec_profile_name(uint8_t profile)
+{
+    return profile == FEC_STANDARD ? "rs(255,223)"
+        : profile == FEC_LIGHT ? "rs(255,239)"
+        : profile == FEC_STRONG ? "rs(255,191)"
+        : profile == FEC_CONCAT ? "rs(255,223)+conv(2,7)" : "unknown";
+}
+
+// parity bytes of a block, the errors it can fix are half that
+constexpr size_t fec_parity(uint8_t profile)
+{
+    return profile == FEC_LIGHT ? 16 : profile == FEC_STRONG ? 64 : fec_min_distance;
+}
+
+constexpr size_t fec_parity_max = 64;
+
+// decoded payload of a record
+constexpr size_t record_payload_sz(uint8_t format)
+{
+    return format == SF_TRACK ? track_payload_sz : sector_payload_sz;
+}
+
+// as few blocks as the code allows, all of the same length: the payload
+// is cut into sector_message_sz pieces, zeros after the end
+constexpr size_t sector_blocks(uint8_t format, uint8_t profile = FEC_STANDARD)
+{
+    size_t k = fec_block_length - fec_parity(profile);
+    return (record_payload_sz(format) + k - 1) / k;
+}
+
+constexpr size_t sector_message_sz(uint8_t format, uint8_t profile)
+{
+    size_t blocks = sector_blocks(format, profile);
+    return (record_payload_sz(format) + blocks - 1) / blocks;
+}
+
+// a shortened code when the message is less than the code takes
+constexpr size_t sector_block_len(uint8_t format, uint8_t profile)
+{
+    return sector_message_sz(format, profile) + fec_parity(profile);
+}
+
+// bytes of a block on tape, padded to an even length: 256 with the
+// standard profile, as ever
+constexpr size_t sector_block_stride(uint8_t format, uint8_t profile)
+{
+    return (sector_block_len(format, profile) + 1) & ~size_t(1);
+}
+
+// the inner code of FEC_CONCAT between the blocks in tape order and the
+// modulator, libcorrect's rate 1/2 order 7 code with its tail flushed.
+// Sectors only: a track record twice the size wouldn't fit the buffers,
+// those are plain (255, 223)
+constexpr size_t fec_inner_order = 7;
+
+constexpr bool fec_inner(uint8_t format, uint8_t profile)
+{
+    return profile == FEC_CONCAT && format != SF_TRACK;
+}
+
+constexpr size_t fec_inner_sz(size_t outer_sz)
+{
+    return 2 * (8 * outer_sz + fec_inner_order + 1) / 8;
+}
+
+// bytes of the blocks in tape order
+constexpr size_t record_outer_sz(uint8_t format, uint8_t profile)
+{
+    return sector_blocks(format, profile) * sector_block_stride(format, profile);
+}
+
+// bytes on tape of a record
+constexpr size_t record_data_sz(uint8_t format, uint8_t profile)
+{
+    return fec_inner(format, profile)
+        ? fec_inner_sz(record_outer_sz(format, profile))
+        : record_outer_sz(format, profile);
+}
+
+static_assert(sector_blocks(SF_LINEAR) == FEC_BLOCKS_PER_SECTOR
+        && sector_blocks(SF_TRACK) == FEC_BLOCKS_PER_TRACK
+        && sector_message_sz(SF_LINEAR, FEC_STANDARD) == sizeof(chunk_payload_t)
+        && sector_message_sz(SF_TRACK, FEC_STANDARD) == fec_message_sz
+        && record_data_sz(SF_LINEAR, FEC_STANDARD) == sector_data_sz,
+        "the standard profile is the layout from before profiles");
+
+// chunk_payload_t with its crc16, or a crc of the whole record at the end
+constexpr bool sector_chunk_crc(uint8_t format)
+{
+    return format != SF_TRACK;
+}
+
+// sector header word, written SECTOR_NUM_REPEATS times after SYNC_SECTOR:
+// bits 15..14 fec profile, 13..12 sector format, 11..0 sector number;
+// old tapes have format 0 or 1 in 15..12, which is the standard profile
+constexpr int sector_num_bits = 12;
+constexpr int sector_format_bits = 2;
+constexpr uint16_t sector_num_max = (1 << sector_num_bits) - 1;
+
+static_assert(SF_COUNT <= (1 << sector_format_bits)
+        && FEC_PROFILE_COUNT <= (1 << (16 - sector_num_bits - sector_format_bits)),
+        "sector header bits");
+
+constexpr uint16_t sector_header(uint8_t format, uint8_t profile, uint16_t sector_num)
+{
+    return (profile << (sector_num_bits + sector_format_bits))
+        | (format << sector_num_bits) | (sector_num & sector_num_max);
+}
+
+// position in the sector byte stream of byte i of fec block n
+constexpr size_t sector_byte_pos(uint8_t format, uint8_t profile, size_t n, size_t i)
+{
+    return format == SF_INTERLEAVED || format == SF_TRACK
+        ? i * sector_blocks(format, profile) + n
+        : n * sector_block_stride(format, profile) + i;
+}
+
+// records the buffers have room for, see RECORD_FORMATS and
+// RECORD_PROFILES in config.h: the others are read as bad records and
+// can't be chosen for writing
+constexpr bool record_format_built(uint8_t format)
+{
+    return format < SF_COUNT && (RECORD_FORMATS >> format & 1);
+}
+
+constexpr bool fec_profile_built(uint8_t profile)
+{
+    return profile < FEC_PROFILE_COUNT && (RECORD_PROFILES >> profile & 1);
+}
+
+constexpr bool record_built(uint8_t format, uint8_t profile)
+{
+    return record_format_built(format) && fec_profile_built(profile);
+}
+
+static_assert(record_built(SF_LINEAR, FEC_STANDARD)
+        && record_built(SECTOR_FORMAT, FEC_PROFILE)
+        && record_built(SECTOR_FORMAT, FEC_EDGE_PROFILE),
+        "old tapes and what llformat writes must be readable");
+
+// the next one after format or profile that is built, round and round
+constexpr uint8_t next_record_format(uint8_t format)
+{
+    do {
+        format = (format + 1) % SF_COUNT;
+    } while (!record_format_built(format));
+    return format;
+}
+
+constexpr uint8_t next_fec_profile(uint8_t profile)
+{
+    do {
+        profile = (profile + 1) % FEC_PROFILE_COUNT;
+    } while (!fec_profile_built(profile));
+    return profile;
+}
+
+// the most of everything over the formats and profiles that are built
+constexpr size_t record_max(size_t (*f)(uint8_t, uint8_t))
+{
+    size_t m = 0;
+    for (uint8_t format = 0; format < SF_COUNT; ++format) {
+        for (uint8_t profile = 0; profile < FEC_PROFILE_COUNT; ++profile) {
+            if (record_built(format, profile)) {
+                m = std::max(m, f(format, profile));
+            }
+        }
+    }
+    return m;
+}
+
+constexpr size_t record_payload_padded(uint8_t format, uint8_t profile)
+{
+    return sector_blocks(format, profile) * sector_message_sz(format, profile);
+}
+
+constexpr size_t FEC_BLOCKS_MAX = record_max(sector_blocks);
+
+// a block in each full_chunk_t, or an inner coded record and its blocks
+// in tape order side by side, the one is coded into the other
+constexpr size_t record_buf_sz(uint8_t format, uint8_t profile)
+{
+    return fec_inner(format, profile)
+        ? record_data_sz(format, profile) + 2 + record_outer_sz(format, profile)
+        : sizeof(full_chunk_t) * sector_blocks(format, profile);
+}
+
+// 256 * 4 = 1024 in a standard sector, buffers have room for the longest
+// record that is built
+union sector_data_t {
+    std::array<full_chunk_t, FEC_BLOCKS_MAX> chunks;
+    std::array<uint8_t, record_max(record_buf_sz)> raw;
+} __attribute__((packed));
+
+// bytes on tape of the longest record
+constexpr size_t record_data_max = record_max(record_data_sz);
+static_assert(record_data_max <= sizeof(sector_data_t), "record doesn't fit");
+
+// decoded payload of the longest record, with the zeros after the end
+constexpr size_t record_payload_max = record_max(record_payload_padded);
+
+// tx fifo words of a rendered sector, see Bitstream::render_sector()
+// data part: LEADER, SYNC_DATA, 2 bytes per word, trailer
+constexpr size_t sector_data_words = DATA_LEADER_LEN + 1 + sector_data_sz / 2
+    + SECTOR_TRAILER_LEN;
+// whole sector: LEADER, SYNC_SECTOR, sector numbers, data part
+constexpr size_t sector_words = SECTOR_LEADER_LEN + 1 + SECTOR_NUM_REPEATS
+    + sector_data_words;
+
+// room for the longest record, with flush words after the header and the
+// data, see modulation.h
+constexpr size_t record_words_max = sector_words + (record_data_max - sector_data_sz) / 2
+    + 2 * modulation_flush_max;
+
+// a record on several head channels: data word w goes to channel
+// w % channels, each channel has its own leader, syncs and header so that
+// its loop locks on its own, and all of them take the same time
+constexpr int sector_channels_max = READLOOP_CHANNELS_MAX;
+
+// data words of channel ch out of data_words
+constexpr size_t sector_channel_words(size_t data_words, int channels, int ch)
+{
+    return (data_words + channels - 1 - ch) / channels;
+}
+
+// tx fifo words of a channel, room for the longest record; rendered
+// channels follow each other this far apart
+constexpr size_t channel_words_max(int channels)
+{
+    return record_words_max - record_data_max / 2
+        + sector_channel_words(record_data_max / 2, channels, 0);
+}
+
+constexpr size_t striped_words_max()
+{
+    size_t m = 0;
+    for (int channels = 1; channels <= sector_channels_max; ++channels) {
+        m = std::max(m, channels * channel_words_max(channels));
+    }
+    return m;
+}
+
+typedef std::array<uint32_t, striped_words_max()> sector_words_t;
+
+// data words of the longest record as the reader takes them in, each
+// channel with its flush words
+constexpr size_t rx_words_max = record_data_max / 2
+    + sector_channels_max * modulation_flush_max;
+
+// sector_buf, decoded_buf and the double buffered tx_words of bitstream.cpp
+// and SectorReader's rxwords, rxflags and rxsoft
+constexpr size_t record_buffers_sz = sizeof(sector_data_t) + record_payload_max
+    + 2 * sizeof(sector_words_t) + rx_words_max * (sizeof(uint32_t) + 2);
+
 uint16_t calculate_crc(uint8_t * data, size_t len);
 
 // singletonize or make it a proper class
 class SectorWriter {
 private:
-    // reed-solomon instances for writing and reading
+    // reed-solomon instance of the profile
     correct_reed_solomon * rs_tx = 0;
+    correct_convolutional * conv_tx = 0;
     
     // sector buffer without fec bytes
     sector_data_t& txbuf;
+    uint8_t format = SF_LINEAR;
+    uint8_t profile = FEC_STANDARD;
+    size_t blocks, stride;  // of format and profile
+    bool inner;             // fec_inner(), txbuf.raw holds the tape bytes
+
+    const uint8_t& tape_byte(size_t);   // of the blocks, before the inner code
 public:
     SectorWriter(sector_data_t& txbuf);
     ~SectorWriter();
 
+    // set_format() first, it decides how many blocks there are
     size_t prepare(const uint8_t * data, size_t data_sz);
 
+    // layout of the bytes that operator[] gives out, in tape order, and
+    // the fec profile of the blocks
+    void set_format(uint8_t format, uint8_t profile);
+
     const uint8_t& operator[](size_t);
     size_t size() const;
     //uint16_t crc16() const;
@@ -70,25 +370,102 @@ public:
 class SectorReader {
 private:
     sector_data_t& rxbuf;
-    uint8_t * decoded_buf; // should have sector_payload_sz bytes
+    uint8_t * decoded_buf; // should have record_payload_max bytes
 
     correct_reed_solomon * rs_rx = 0;
-    size_t rxbuf_index;
-    uint8_t prev_level;
-    uint32_t inverted = 0;
+    correct_convolutional * conv_rx = 0;   // on the first FEC_CONCAT record
+
+    // raw data words as they come, demodulated in one go into rxbuf;
+    // static, there is one reader at a time and a record doesn't fit on
+    // a stack
+    static std::array<uint32_t, rx_words_max> rxwords;
 
-    std::array<uint16_t, 3> sector_nums;
-    size_t sector_nums_index;
+    // erasure hints per data word, bit 1 high byte, bit 0 low byte:
+    // dll phase spikes while reading, clock violations after
+    static std::array<uint8_t, rx_words_max> rxflags;
+    // byte confidences per data word from the dll's soft decisions, as
+    // soft_confidence()
+    static std::array<uint8_t, rx_words_max> rxsoft;
+    size_t rxwords_count;   // of this record's format and profile
+    uint32_t hinted;        // blocks that took erasure hints
+    uint32_t softened;      // of them, soft decisions
 
-    int pick_sector_num();
+    // a head channel: each finds its own syncs and header and reads its
+    // share of the data words, see sector_channel_words()
+    struct channel_rx_t {
+        SectorReader * reader;
+        int channel;
+        uint32_t rxsync;    // the sync word before its header or data
+
+        // all repeats are consumed before seeking data sync: the header
+        // word of sector 4 modulates into SYNC_DATA; decoded when all
+        // words are in, with the flush words
+        std::array<uint16_t, SECTOR_NUM_REPEATS> sector_nums;
+        size_t sector_nums_index;
+        std::array<uint32_t, SECTOR_NUM_REPEATS + modulation_flush_max> header_words;
+        size_t resync_bits;     // seeking data sync
+        int sector_number;
+        size_t rxwords_index;   // of its own words
+        size_t rxwords_count;
+    };
+    std::array<channel_rx_t, sector_channels_max> rx;
+    std::array<void *, sector_channels_max> rx_users;
+    int channels;
+    uint8_t modulation;     // modulation_t, the same for all records
+    bool record_open;       // a header came by, not all channels have the data
+    bool headers_only;      // see set_headers_only()
+    uint32_t channels_done;
+
+    int pick_sector_num(const channel_rx_t & c);
+    void start_record(channel_rx_t & c, int header);
+    template <class M> void demodulate_record(uint8_t * dst, uint8_t * flags);
+    template <class M> void inner_decode();
+    void deinterleave();
+    size_t chunk_erasures(size_t n, uint8_t * erasures);
+    size_t soft_erasures(size_t n, uint8_t * erasures, size_t count, int soft_level);
+    bool decode_block(size_t n, bool hints);
+    template <class M> readloop_state_t channel_state(channel_rx_t & c,
+            readloop_state_t state, uint32_t bits);
+    template <class M> static readloop_state_t readloop_callback_m(
+            readloop_state_t state, uint32_t bits, void * instance);
+    template <class M> static readloop_state_t channel_callback_m(
+            readloop_state_t state, uint32_t bits, void * channel);
 public:
     int sector_number;
+    uint8_t sector_format;  // sector_format_t from the header
+    uint8_t sector_profile; // fec_profile_t from the header
+    uint8_t record_format;  // sector_format of the last READ_DONE/ERROR, the next
+                            // header may already be in sector_format
 
-    SectorReader(sector_data_t& rxbuf, uint8_t * decoded_buf);
+    // since construction: bytes flagged and fec blocks decoded with erasures,
+    // of them on soft decisions
+    uint32_t erasures = 0;
+    uint32_t erasure_blocks = 0;
+    uint32_t soft_blocks = 0;
+
+    // channels and modulation as the record was written with, see
+    // Bitstream::set_channels() and set_modulation()
+    SectorReader(sector_data_t& rxbuf, uint8_t * decoded_buf, int channels = 1,
+            uint8_t modulation = MOD_MFM);
     ~SectorReader();
 
+    int get_channels() const { return channels; }
+    uint8_t get_modulation() const { return modulation; }
+
+    // before the read loop starts (again): a record that was open is gone
+    void restart() { record_open = false; channels_done = 0; }
+
+    // only MSG_SECTOR_FOUND, data parts are skipped: rxbuf and decoded_buf
+    // are left alone for the writer while a write pass looks for sectors
+    void set_headers_only(bool on) { headers_only = on; }
+
     int correct_sector_data();
-    readloop_state_t readloop_callback(readloop_state_t state, uint32_t bits);
-    static readloop_state_t readloop_callback_s(readloop_state_t state, 
-            uint32_t bits, void * instance);
+
+    // readloop_delaylocked() with readloop_callback() and this, or
+    // readloop_delaylocked_channels() with channel_callback(), channel n
+    // gets channel_users()[n]; the callbacks are of the modulation, the
+    // read loop calls them without looking at it again
+    readloop_callback_t readloop_callback() const;
+    readloop_callback_t channel_callback() const;
+    void * const * channel_users() const { return rx_users.begin(); }
 };
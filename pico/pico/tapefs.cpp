@@ -0,0 +1,484 @@
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+
+#include "config.h"
+#include "sectors.h"
+#include "tapefs.h"
+#include "util.h"
+
+constexpr uint32_t tapefs_magic = 0x53465054;  // "TPFS"
+
+// file bytes in a sector
+constexpr size_t data_per_sector = sector_user_data_sz - sizeof(tapefs_header_t);
+
+// checkpoint: info, then every file packed as name, size, nextents, extents
+struct checkpoint_info_t {
+    uint16_t head;      // log head after the checkpoint
+    uint16_t sectors;   // of the file system
+    uint16_t nfiles;
+    uint16_t reserved;
+} __attribute__((packed));
+
+constexpr size_t packed_file_max = tapefs_name_len + 4 + 1
+    + TAPEFS_MAX_EXTENTS * sizeof(tapefs_extent_t);
+constexpr size_t table_max = sizeof(checkpoint_info_t) + TAPEFS_MAX_FILES * packed_file_max;
+
+// a full checkpoint, also the size of the mirror at BOT and where the log starts
+constexpr int checkpoint_sectors_max = (table_max + data_per_sector - 1) / data_per_sector;
+
+static_assert(checkpoint_sectors_max < 256, "part is uint8_t");
+
+static tapefs_file_t files[TAPEFS_MAX_FILES];
+static int nfiles;
+static bool mounted;
+static bool changed;        // since the last checkpoint
+static uint32_t volume;
+static uint32_t gen;        // of the last checkpoint
+static int head;
+static int disk_sectors;
+
+static uint8_t table[checkpoint_sectors_max * data_per_sector];
+static uint8_t sector[sector_user_data_sz];
+
+static tapefs_header_t * sector_header()
+{
+    return reinterpret_cast<tapefs_header_t *>(sector);
+}
+
+static uint8_t * sector_data()
+{
+    return sector + sizeof(tapefs_header_t);
+}
+
+// user data of sector_num into sector
+static bool read_data(Bitstream & bstream, int sector_num, int read_ahead)
+{
+    static uint8_t payload[sector_payload_sz];
+    if (!bstream.read_sector(sector_num, payload, read_ahead)) {
+        return false;
+    }
+    const chunk_payload_t * chunks = reinterpret_cast<const chunk_payload_t *>(payload);
+    for (size_t i = 0; i < FEC_BLOCKS_PER_SECTOR; ++i) {
+        memcpy(sector + i * payload_data_sz, chunks[i].data, payload_data_sz);
+    }
+    const tapefs_header_t * h = sector_header();
+    return h->magic == tapefs_magic && (volume == 0 || h->volume == volume);
+}
+
+static void set_header(uint8_t kind, uint32_t sector_gen, int part, int parts)
+{
+    *sector_header() = tapefs_header_t{tapefs_magic, volume, sector_gen, kind,
+        (uint8_t)part, (uint8_t)parts, 0};
+}
+
+// queue sector at the log head
+static void append_sector(Bitstream & bstream)
+{
+    bstream.queue_write(head++, sector, sector_user_data_sz);
+}
+
+// the table for a checkpoint after which the log head is at ckpt_head
+static size_t pack_table(int ckpt_head)
+{
+    checkpoint_info_t info = {(uint16_t)ckpt_head, (uint16_t)disk_sectors,
+        (uint16_t)nfiles, 0};
+    memcpy(table, &info, sizeof(info));
+    size_t len = sizeof(checkpoint_info_t);
+    for (int i = 0; i < nfiles; ++i) {
+        const tapefs_file_t & f = files[i];
+        memcpy(table + len, f.name, tapefs_name_len);
+        memcpy(table + len + tapefs_name_len, &f.size, 4);
+        table[len + tapefs_name_len + 4] = f.nextents;
+        len += tapefs_name_len + 4 + 1;
+        memcpy(table + len, f.extents, f.nextents * sizeof(tapefs_extent_t));
+        len += f.nextents * sizeof(tapefs_extent_t);
+    }
+    return len;
+}
+
+static bool unpack_table(size_t len)
+{
+    static tapefs_file_t unpacked[TAPEFS_MAX_FILES];
+    checkpoint_info_t info;
+    memcpy(&info, table, sizeof(info));
+    if (info.nfiles > TAPEFS_MAX_FILES || info.head > info.sectors) {
+        return false;
+    }
+
+    size_t pos = sizeof(info);
+    for (int i = 0; i < info.nfiles; ++i) {
+        tapefs_file_t & f = unpacked[i];
+        if (pos + tapefs_name_len + 5 > len) {
+            return false;
+        }
+        memcpy(f.name, table + pos, tapefs_name_len);
+        memcpy(&f.size, table + pos + tapefs_name_len, 4);
+        f.nextents = table[pos + tapefs_name_len + 4];
+        pos += tapefs_name_len + 4 + 1;
+        if (f.nextents > TAPEFS_MAX_EXTENTS
+                || pos + f.nextents * sizeof(tapefs_extent_t) > len) {
+            return false;
+        }
+        memcpy(f.extents, table + pos, f.nextents * sizeof(tapefs_extent_t));
+        pos += f.nextents * sizeof(tapefs_extent_t);
+        f.name[tapefs_name_len - 1] = 0;
+    }
+
+    std::copy(unpacked, unpacked + info.nfiles, files);
+    nfiles = info.nfiles;
+    head = info.head;
+    disk_sectors = info.sectors;
+    return true;
+}
+
+// checkpoint in sectors first.. with expected_gen, 0 for any
+static bool load_checkpoint(Bitstream & bstream, int first, uint32_t expected_gen)
+{
+    int parts = 1;
+    uint32_t ckpt_gen = 0;
+    for (int part = 0; part < parts; ++part) {
+        if (!read_data(bstream, first + part, parts - part - 1)) {
+            return false;
+        }
+        const tapefs_header_t * h = sector_header();
+        if (part == 0) {
+            if (h->parts == 0 || h->parts > checkpoint_sectors_max) {
+                return false;
+            }
+            parts = h->parts;
+            ckpt_gen = h->gen;
+            volume = h->volume;
+        }
+        if (h->kind != TAPEFS_CHECKPOINT || h->part != part || h->parts != parts
+                || h->gen != ckpt_gen || (expected_gen && h->gen != expected_gen)) {
+            return false;
+        }
+        memcpy(table + part * data_per_sector, sector_data(), data_per_sector);
+    }
+    if (!unpack_table(parts * data_per_sector)) {
+        return false;
+    }
+    gen = ckpt_gen;
+    return true;
+}
+
+// the table in the sectors from first on, queued
+static void write_checkpoint(Bitstream & bstream, int first, size_t len)
+{
+    int parts = (len + data_per_sector - 1) / data_per_sector;
+    for (int part = 0; part < parts; ++part) {
+        set_header(TAPEFS_CHECKPOINT, gen, part, parts);
+        memcpy(sector_data(), table + part * data_per_sector, data_per_sector);
+        bstream.queue_write(first + part, sector, sector_user_data_sz);
+    }
+}
+
+static void checkpoint(Bitstream & bstream)
+{
+    size_t len = pack_table(head);
+    int parts = (len + data_per_sector - 1) / data_per_sector;
+    pack_table(head + parts);
+    ++gen;
+    write_checkpoint(bstream, head, len);
+    head += parts;
+    changed = false;
+}
+
+bool tapefs_format(Bitstream & bstream, int sectors)
+{
+    if (sectors < 2 * checkpoint_sectors_max + 1) {
+        return false;
+    }
+    volume = time_us_32() | 1;  // 0 is "any" in read_data()
+    gen = 0;
+    head = checkpoint_sectors_max;
+    disk_sectors = std::min(sectors, sector_num_max + 1);
+    nfiles = 0;
+    mounted = true;
+    changed = true;
+    return tapefs_unmount(bstream) && tapefs_mount(bstream);
+}
+
+bool tapefs_mount(Bitstream & bstream)
+{
+    mounted = false;
+    volume = 0;
+    if (!load_checkpoint(bstream, 0, 0)) {
+        warning_println("tapefs: no file system");
+        return false;
+    }
+
+    // roll forward over checkpoints written since the mirror, data after
+    // the last one is not in any table and will be overwritten
+    int rolled = 0;
+    for (int pos = head; pos < disk_sectors; ) {
+        if (!read_data(bstream, pos, SECTOR_READ_AHEAD)) {
+            break;
+        }
+        const tapefs_header_t * h = sector_header();
+        if (h->gen != gen + 1) {
+            break;
+        }
+        if (h->kind == TAPEFS_DATA) {
+            ++pos;
+        }
+        else if (h->kind == TAPEFS_CHECKPOINT && h->part == 0
+                && load_checkpoint(bstream, pos, gen + 1)) {
+            pos = head;
+            ++rolled;
+        }
+        else {
+            break;
+        }
+    }
+
+    mounted = true;
+    changed = false;
+    info_println("tapefs: %d files, gen %d, %d checkpoints after the mirror, "
+            "%d sectors free", nfiles, (int)gen, rolled, tapefs_free_sectors());
+    return true;
+}
+
+bool tapefs_mounted()
+{
+    return mounted;
+}
+
+bool tapefs_sync(Bitstream & bstream)
+{
+    if (!mounted) {
+        return false;
+    }
+    if (changed) {
+        checkpoint(bstream);
+    }
+    bstream.flush_writes();
+    return write_queue_size() == 0;
+}
+
+bool tapefs_unmount(Bitstream & bstream)
+{
+    if (!mounted) {
+        return false;
+    }
+    if (changed) {
+        checkpoint(bstream);
+    }
+    // the same table again at BOT, the write queue sorts it in front
+    write_checkpoint(bstream, 0, pack_table(head));
+    bstream.flush_writes();
+    mounted = false;
+    return write_queue_size() == 0;
+}
+
+static tapefs_file_t * find(const char * name)
+{
+    for (int i = 0; i < nfiles; ++i) {
+        if (strncmp(files[i].name, name, tapefs_name_len) == 0) {
+            return &files[i];
+        }
+    }
+    return 0;
+}
+
+// sector of the file's n-th data sector, -1 past the end; sectors left in
+// the extent after it in *run
+static int file_sector(const tapefs_file_t * f, size_t n, int * run)
+{
+    for (int i = 0; i < f->nextents; ++i) {
+        if (n < f->extents[i].count) {
+            *run = f->extents[i].count - n - 1;
+            return f->extents[i].first + n;
+        }
+        n -= f->extents[i].count;
+    }
+    return -1;
+}
+
+size_t tapefs_extend(tapefs_file_t * f, int * head, size_t count, bool tail)
+{
+    int at = *head;
+    tapefs_extent_t last = f->nextents ? f->extents[f->nextents - 1] : tapefs_extent_t{};
+    if (tail) {
+        // the old tail is garbage; right behind the head nothing came after
+        // it, not even a checkpoint, so no table has it and it's rewritten
+        // in place (or replaced in the write queue)
+        --last.count;
+        if (last.first + last.count == at - 1) {
+            --at;
+        }
+    }
+    bool merge = f->nextents && (last.count == 0 || last.first + last.count == at);
+    if (!merge && f->nextents == TAPEFS_MAX_EXTENTS) {
+        // out of extents: the file moves to the head, all of it but the
+        // tail is copied there and the new sectors follow in one extent
+        size_t copies = f->size / data_per_sector;
+        f->nextents = 1;
+        f->extents[0] = tapefs_extent_t{(uint16_t)*head, (uint16_t)(copies + count)};
+        *head += copies;
+        return copies;
+    }
+
+    // new extent, or the last one shortened by the tail and grown at the head
+    if (f->nextents) {
+        f->extents[f->nextents - 1] = last;
+    }
+    if (merge) {
+        --f->nextents;
+        if (last.count == 0) {
+            last.first = at;
+        }
+    }
+    else {
+        last = tapefs_extent_t{(uint16_t)at, 0};
+    }
+    last.count += count;
+    f->extents[f->nextents++] = last;
+    *head = at;
+    return 0;
+}
+
+bool tapefs_append(Bitstream & bstream, const char * name, const uint8_t * data,
+        size_t size)
+{
+    if (!mounted || strlen(name) >= tapefs_name_len) {
+        return false;
+    }
+    tapefs_file_t * f = find(name);
+    if (!f) {
+        if (nfiles == TAPEFS_MAX_FILES) {
+            return false;
+        }
+        f = &files[nfiles];
+        *f = tapefs_file_t{};
+        strncpy(f->name, name, tapefs_name_len - 1);
+    }
+
+    // a partly filled last sector is read and goes to the head again with
+    // the new data after it
+    size_t tail = f->size % data_per_sector;
+    size_t count = (tail + size + data_per_sector - 1) / data_per_sector;
+    tapefs_file_t grown = *f;
+    int at = head;
+    size_t copies = tapefs_extend(&grown, &at, count, tail != 0);
+    if (at + (int)count + checkpoint_sectors_max > disk_sectors) {
+        warning_println("tapefs: tape full");
+        return false;
+    }
+    if (copies) {
+        info_println("tapefs: %s out of extents, copying %d sectors", name, (int)copies);
+    }
+    for (size_t n = 0; n < copies; ++n) {
+        int run;
+        if (!read_data(bstream, file_sector(f, n, &run),
+                    std::min<int>({run, (int)(copies - n - 1), SECTOR_CACHE_SECTORS - 1}))
+                || sector_header()->kind != TAPEFS_DATA) {
+            return false;
+        }
+        set_header(TAPEFS_DATA, gen + 1, 0, 0);
+        append_sector(bstream);
+    }
+    if (tail) {
+        int run;
+        if (!read_data(bstream, file_sector(f, f->size / data_per_sector, &run), 0)) {
+            return false;
+        }
+    }
+    if (f == &files[nfiles]) {
+        ++nfiles;
+    }
+    *f = grown;
+    head = at;
+
+    size_t fill = tail;
+    for (size_t i = 0; i < count; ++i) {
+        size_t n = std::min(size, data_per_sector - fill);
+        memcpy(sector_data() + fill, data, n);
+        memset(sector_data() + fill + n, 0, data_per_sector - fill - n);
+        set_header(TAPEFS_DATA, gen + 1, 0, 0);
+        append_sector(bstream);
+        data += n;
+        size -= n;
+        f->size += n;
+        fill = 0;
+    }
+    changed = true;
+    return true;
+}
+
+bool tapefs_write(Bitstream & bstream, const char * name, const uint8_t * data,
+        size_t size)
+{
+    tapefs_file_t * f = find(name);
+    tapefs_file_t old = f ? *f : tapefs_file_t{};
+    if (f) {
+        f->size = 0;
+        f->nextents = 0;
+    }
+    if (!tapefs_append(bstream, name, data, size)) {
+        if (f) {
+            *f = old;
+        }
+        return false;
+    }
+    return true;
+}
+
+int tapefs_read(Bitstream & bstream, const char * name, size_t offset,
+        uint8_t * buf, size_t size)
+{
+    const tapefs_file_t * f = mounted ? find(name) : 0;
+    if (!f) {
+        return -1;
+    }
+    if (offset >= f->size) {
+        return 0;
+    }
+    size = std::min<size_t>(size, f->size - offset);
+
+    size_t done = 0;
+    while (done < size) {
+        size_t n = offset / data_per_sector;
+        size_t from = offset % data_per_sector;
+        size_t len = std::min(size - done, data_per_sector - from);
+        size_t left = (size - done - len + data_per_sector - 1) / data_per_sector;
+
+        // read-ahead over the rest of the extent, as far as the read goes
+        int run;
+        int sector_num = file_sector(f, n, &run);
+        if (sector_num < 0 || !read_data(bstream, sector_num,
+                    std::min<int>({run, (int)left, SECTOR_CACHE_SECTORS - 1}))
+                || sector_header()->kind != TAPEFS_DATA) {
+            return -1;
+        }
+        memcpy(buf + done, sector_data() + from, len);
+        done += len;
+        offset += len;
+    }
+    return done;
+}
+
+bool tapefs_remove(const char * name)
+{
+    tapefs_file_t * f = mounted ? find(name) : 0;
+    if (!f) {
+        return false;
+    }
+    std::copy(f + 1, files + nfiles, f);
+    --nfiles;
+    changed = true;
+    return true;
+}
+
+const tapefs_file_t * tapefs_file(int i)
+{
+    return mounted && i >= 0 && i < nfiles ? &files[i] : 0;
+}
+
+int tapefs_free_sectors()
+{
+    return mounted ? std::max(0, disk_sectors - head - checkpoint_sectors_max) : 0;
+}
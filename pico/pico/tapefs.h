@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "bitstream.h"
+
+// log-structured file system
+//
+// sectors are only ever written at the log head, which moves towards EOT:
+// file data, then at sync a checkpoint with the whole file table (names,
+// sizes, extents); a write is a sequential run that the write queue puts
+// on tape in one pass, nothing is rewritten in place but a file's partly
+// filled last sector right behind the head, which no checkpoint has seen
+// the latest checkpoint is mirrored to the first sectors at unmount, mount
+// reads the mirror and rolls forward over checkpoints written after it
+//
+// every sector starts with a tapefs_header_t; data written after the last
+// checkpoint is lost if there is no sync, space of replaced files is not
+// reclaimed: when the log reaches the end of the tape, format again
+// a tape is either this or the usb mass storage disk, not both
+
+#ifndef TAPEFS_MAX_FILES
+#define TAPEFS_MAX_FILES    32
+#endif
+#ifndef TAPEFS_MAX_EXTENTS
+#define TAPEFS_MAX_EXTENTS  8
+#endif
+
+constexpr size_t tapefs_name_len = 16;      // with the terminating 0
+
+enum tapefs_kind_t : uint8_t {
+    TAPEFS_DATA = 1,
+    TAPEFS_CHECKPOINT,
+};
+
+// at the start of every sector; gen is that of the checkpoint that covers
+// the sector, data sectors are one ahead of the checkpoint before them
+struct tapefs_header_t {
+    uint32_t magic;     // "TPFS"
+    uint32_t volume;    // random at format, stale sectors of an old one don't count
+    uint32_t gen;
+    uint8_t kind;
+    uint8_t part;       // checkpoints: part of parts
+    uint8_t parts;
+    uint8_t reserved;
+} __attribute__((packed));
+
+struct tapefs_extent_t {
+    uint16_t first;
+    uint16_t count;
+};
+
+struct tapefs_file_t {
+    char name[tapefs_name_len];
+    uint32_t size;
+    uint8_t nextents;
+    tapefs_extent_t extents[TAPEFS_MAX_EXTENTS];
+};
+
+// empty file system on sectors 0..sectors-1, written at once
+bool tapefs_format(Bitstream & bstream, int sectors);
+
+// read the mirror and the checkpoints after it; false if there's no file
+// system on the tape
+bool tapefs_mount(Bitstream & bstream);
+bool tapefs_mounted();
+
+// checkpoint at the log head, then everything queued goes on tape
+bool tapefs_sync(Bitstream & bstream);
+
+// sync and mirror the checkpoint at BOT
+bool tapefs_unmount(Bitstream & bstream);
+
+// create or replace a file / add to its end; false if the tape or the file
+// table are full. A file out of extents is copied to the log head first
+bool tapefs_write(Bitstream & bstream, const char * name, const uint8_t * data,
+        size_t size);
+bool tapefs_append(Bitstream & bstream, const char * name, const uint8_t * data,
+        size_t size);
+
+// the extents of f after count sectors go at *head, the first of them its
+// partly filled last sector if tail; *head steps back if that sector is
+// right behind it. If it takes an extent more than TAPEFS_MAX_EXTENTS the
+// file moves to *head in one extent: returns how many of its sectors are
+// to be copied there first, *head is past them (tapefs_append() does this,
+// the host checks it)
+size_t tapefs_extend(tapefs_file_t * f, int * head, size_t count, bool tail);
+
+// bytes read from offset, -1 if there's no such file or the tape fails
+int tapefs_read(Bitstream & bstream, const char * name, size_t offset,
+        uint8_t * buf, size_t size);
+
+bool tapefs_remove(const char * name);
+
+// i-th file, 0 past the last
+const tapefs_file_t * tapefs_file(int i);
+
+// sectors left between the log head and the end
+int tapefs_free_sectors();
@@ -3,6 +3,8 @@
  */
 
 #include <stdio.h>
+#include <cstring>
+#include <algorithm>
 #include "pico/stdlib.h"
 #include "hardware/gpio.h"
 #include "hardware/pwm.h"
@@ -14,6 +16,12 @@
 #include "mainloop.h"
 #include "tacho.h"
 #include "bitstream.h"
+#include "sectorindex.h"
+#include "reel.h"
+#include "sectorcache.h"
+#include "usbmsc.h"
+#include "tapefs.h"
+#include "bench.h"
 #include "util.h"
 
 #define ML_NO_REQUEST   0
@@ -39,6 +47,24 @@ int last_motor_status = -1;
 
 int slice_num;
 
+const char * get_plaintext();
+size_t get_plaintext_size();
+
+// number typed on the console, -1 if none
+int read_number()
+{
+    int n = -1;
+    for (int c; (c = getchar()) != '\r' && c != '\n'; ) {
+        if (c < '0' || c > '9') {
+            return -1;
+        }
+        putchar(c);
+        n = (n < 0 ? 0 : n * 10) + c - '0';
+    }
+    putchar('\n');
+    return n;
+}
+
 void freq_sweep()
 {
     gpio_set_function(GPIO_WRHEAD, GPIO_FUNC_PWM);
@@ -83,10 +109,26 @@ void freq_stop()
     gpio_set_function(GPIO_WRHEAD, GPIO_FUNC_NULL);
 }
 
+// the keys of the main loop and what llformat and the reads go by
+static void print_help()
+{
+    info_println("\nHelp: m=motor, p=play, f=ff, r=rew, space=stop, z=solenoid, 0=zero counter");
+    info_println("  s=freq sweep, 4 8 1 2 3=square wave at 4/8/10/20/30 kHz");
+    info_println("  F=llformat, i=format, e=fec, c=head channels, M=modulation");
+    info_println("  l=sector scan, g=seek, v=read sector, t=read track, W=write text to track,"
+            " w=test write");
+    info_println("  k=tapefs format, d=tapefs listing, a=append alice.txt, u=tapefs unmount,"
+            " B=modulation bench");
+    info_println("  format %s, fec %s, %d head channel%s, %s", sector_format_name(bstream.get_format()),
+            fec_profile_name(bstream.get_profile()), bstream.get_channels(),
+            bstream.get_channels() > 1 ? "s" : "", modulation_name(bstream.get_modulation()));
+}
+
 int main() {
     stdio_init_all();
 
     printf("tapeshnik\n");
+    print_help();
 
     debounce_init();
     //wheel_init(GPIO_MOTOR_CONTROL, GPIO_SOLENOID_CONTROL, GPIO_MODE_ENTRY);
@@ -95,6 +137,12 @@ int main() {
 
     wheel.init();
 
+    sector_index_load();
+    reel_load();
+    printf("sector index: %d sectors, reel model %s\n", sector_index_count(),
+            reel_valid() ? "fitted" : "default");
+    usb_msc_init(sector_index_count());
+
     //gpio_disable_pulls(GPIO_RDHEAD);
     //gpio_pull_up(GPIO_RDHEAD);
     //gpio_set_dir(GPIO_RDHEAD, /* out */ true);
@@ -110,6 +158,8 @@ int main() {
                 c = mainloop_request;
             }
         }
+        usb_msc_task(bstream);
+
         switch (c) {
             case 'z': solenoid.pulse_ms(50);
                       break;
@@ -148,14 +198,96 @@ int main() {
             //case 'e': bstream.test_sector_rewrite();
             //          break;
             case 'F': bstream.llformat();
+                      usb_msc_init(sector_index_count());
+                      break;
+            case 'i': bstream.set_format(next_record_format(bstream.get_format()));
+                      printf("llformat: %s\n", sector_format_name(bstream.get_format()));
+                      break;
+            case 'e': bstream.set_profile(next_fec_profile(bstream.get_profile()));
+                      printf("llformat: fec %s\n", fec_profile_name(bstream.get_profile()));
+                      break;
+            case 'c': bstream.set_channels(bstream.get_channels() % sector_channels_max + 1);
+                      printf("head channels: %d\n", bstream.get_channels());
+                      break;
+            case 'M': bstream.set_modulation((bstream.get_modulation() + 1) % MOD_COUNT);
+                      printf("modulation: %s\n", modulation_name(bstream.get_modulation()));
                       break;
             case 'l': bstream.sector_scan(65535);
                       break;
+            case 'v': {
+                          printf("read sector: ");
+                          int n = read_number();
+                          static uint8_t payload[sector_payload_sz];
+                          if (n >= 0 && bstream.read_sector(n, payload)) {
+                              const chunk_payload_t * chunks =
+                                  reinterpret_cast<const chunk_payload_t *>(payload);
+                              for (size_t i = 0; i < FEC_BLOCKS_PER_SECTOR; ++i) {
+                                  fwrite(chunks[i].data, 1, payload_data_sz, stdout);
+                              }
+                              putchar('\n');
+                          }
+                          sector_cache_stats_t st = sector_cache_stats();
+                          info_println("cache: %d sectors, %d hits, %d misses",
+                                  st.used, (int)st.hits, (int)st.misses);
+                      }
+                      break;
+            case 't': {
+                          printf("read track: ");
+                          int n = read_number();
+                          static uint8_t track[track_user_data_sz];
+                          if (n >= 0 && bstream.read_track(n, track)) {
+                              fwrite(track, 1, track_user_data_sz, stdout);
+                              putchar('\n');
+                          }
+                      }
+                      break;
+            case 'W': {
+                          printf("write text to track: ");
+                          int n = read_number();
+                          static uint8_t track[track_user_data_sz];
+                          memcpy(track, get_plaintext(), std::min(get_plaintext_size(),
+                                      track_user_data_sz));
+                          if (n >= 0) {
+                              bstream.write_track(n, track);
+                          }
+                      }
+                      break;
+            case 'g': {
+                          printf("seek to sector: ");
+                          int n = read_number();
+                          if (n >= 0) {
+                              bstream.seek(n);
+                          }
+                      }
+                      break;
             case 'w': bstream.test_write();
                       break;
+            case 'k': if (tapefs_format(bstream, sector_index_count())) {
+                          info_println("tapefs: %d sectors free", tapefs_free_sectors());
+                      }
+                      break;
+            case 'd': if (tapefs_mounted() || tapefs_mount(bstream)) {
+                          for (int i = 0; const tapefs_file_t * f = tapefs_file(i); ++i) {
+                              printf("%-16s %8u bytes %d extents\n", f->name,
+                                      (unsigned)f->size, f->nextents);
+                          }
+                          printf("%d sectors free\n", tapefs_free_sectors());
+                      }
+                      break;
+            case 'a': if (tapefs_mounted() || tapefs_mount(bstream)) {
+                          tapefs_append(bstream, "alice.txt",
+                                  reinterpret_cast<const uint8_t *>(get_plaintext()),
+                                  get_plaintext_size());
+                          tapefs_sync(bstream);
+                      }
+                      break;
+            case 'u': tapefs_unmount(bstream);
+                      break;
+            case 'B': bench_modulation();
+                      break;
             case 10:
             case 13:
-                      info_println("\nHelp: m=motor, p=play, f=ff, r=rew, space=stop, 0=zero counter");
+                      print_help();
                       break;
         }
 
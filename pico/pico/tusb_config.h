@@ -0,0 +1,21 @@
+#pragma once
+
+// tinyusb device: cdc 0 is the stdio console, cdc 1 the mass storage stats,
+// then mass storage; descriptors in usb_descriptors.c, see usbmsc.h
+
+#define CFG_TUSB_RHPORT0_MODE   OPT_MODE_DEVICE
+#define CFG_TUSB_OS             OPT_OS_PICO
+
+#define CFG_TUD_ENDPOINT0_SIZE  64
+
+#define CFG_TUD_CDC             2
+#define CFG_TUD_MSC             1
+#define CFG_TUD_HID             0
+#define CFG_TUD_MIDI            0
+#define CFG_TUD_VENDOR          0
+
+#define CFG_TUD_CDC_RX_BUFSIZE  256
+#define CFG_TUD_CDC_TX_BUFSIZE  256
+
+// usbmsc.cpp splits one callback over at most two sectors
+#define CFG_TUD_MSC_EP_BUFSIZE  512
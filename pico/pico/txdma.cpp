@@ -0,0 +1,94 @@
+#include <cstdint>
+#include <algorithm>
+#include "pico/stdlib.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+
+#include "readloop.h"
+#include "txdma.h"
+
+constexpr int channels_max = READLOOP_CHANNELS_MAX;
+
+// a head channel's dma channel, -1 until claimed
+struct tx_t {
+    int dma_ch = -1;
+    dma_channel_config config;
+};
+
+static tx_t tx[channels_max];
+static int ninit = 0;
+static uint32_t fill_word;
+
+void txdma_init(PIO pio, uint sm, int channel)
+{
+    if (tx[channel].dma_ch >= 0) {
+        return;
+    }
+    int ch = dma_claim_unused_channel(true);
+    tx[channel].dma_ch = ch;
+    tx[channel].config = dma_channel_get_default_config(ch);
+    channel_config_set_transfer_data_size(&tx[channel].config, DMA_SIZE_32);
+    channel_config_set_write_increment(&tx[channel].config, false);
+    channel_config_set_dreq(&tx[channel].config, pio_get_dreq(pio, sm, true));
+    dma_channel_configure(ch, &tx[channel].config, &pio->txf[sm], 0, 0, false);
+    ninit = std::max(ninit, channel + 1);
+}
+
+void txdma_deinit()
+{
+    for (int i = 0; i < ninit; ++i) {
+        if (tx[i].dma_ch < 0) {
+            continue;
+        }
+        dma_channel_abort(tx[i].dma_ch);
+        dma_channel_unclaim(tx[i].dma_ch);
+        tx[i].dma_ch = -1;
+    }
+    ninit = 0;
+}
+
+static void start(const uint32_t * words, size_t count, int channels, size_t stride,
+        bool increment)
+{
+    txdma_wait();
+    uint32_t mask = 0;
+    for (int i = 0; i < channels; ++i) {
+        channel_config_set_read_increment(&tx[i].config, increment);
+        dma_channel_set_config(tx[i].dma_ch, &tx[i].config, false);
+        dma_channel_set_trans_count(tx[i].dma_ch, count, false);
+        dma_channel_set_read_addr(tx[i].dma_ch, words + i * stride, false);
+        mask |= 1u << tx[i].dma_ch;
+    }
+    dma_start_channel_mask(mask);
+}
+
+void txdma_write(const uint32_t * words, size_t count, int channels, size_t stride)
+{
+    start(words, count, channels, stride, true);
+}
+
+void txdma_fill(uint32_t word, size_t count, int channels)
+{
+    txdma_wait();
+    fill_word = word;
+    start(&fill_word, count, channels, 0, false);
+}
+
+void txdma_wait()
+{
+    for (int i = 0; i < ninit; ++i) {
+        if (tx[i].dma_ch >= 0) {
+            dma_channel_wait_for_finish_blocking(tx[i].dma_ch);
+        }
+    }
+}
+
+bool txdma_busy()
+{
+    for (int i = 0; i < ninit; ++i) {
+        if (tx[i].dma_ch >= 0 && dma_channel_is_busy(tx[i].dma_ch)) {
+            return true;
+        }
+    }
+    return false;
+}
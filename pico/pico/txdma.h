@@ -0,0 +1,26 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include "hardware/pio.h"
+
+// tx state machine fed by DMA from word buffers, so that the cpu can
+// prepare the next buffer while the current one is going out
+//
+// with several head channels (see TAPE_CHANNELS) each state machine has
+// its own dma channel, they are started together
+
+void txdma_init(PIO pio, uint sm, int channel = 0);
+void txdma_deinit();
+
+// send count words on each of channels: channel n's are at words +
+// n * stride; waits for the previous transfer first, words must stay
+// untouched until txdma_wait()
+void txdma_write(const uint32_t * words, size_t count, int channels = 1,
+        size_t stride = 0);
+
+// send the same word count times on each of channels
+void txdma_fill(uint32_t word, size_t count, int channels = 1);
+
+void txdma_wait();
+bool txdma_busy();
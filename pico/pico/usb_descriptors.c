@@ -0,0 +1,119 @@
+// usb descriptors: console cdc, stats cdc, mass storage
+// cdc 0 has to come first, that's the one stdio_usb writes to
+
+#include "tusb.h"
+#include "pico/unique_id.h"
+
+#define USB_VID     0x2E8A      // raspberry pi
+#define USB_PID     0x000A      // as plain stdio_usb; windows remembers the interfaces
+                                // per vid:pid, change it if windows gets confused
+#define USB_BCD     0x0200
+
+enum {
+    ITF_NUM_CDC = 0,
+    ITF_NUM_CDC_DATA,
+    ITF_NUM_CDC_STATS,
+    ITF_NUM_CDC_STATS_DATA,
+    ITF_NUM_MSC,
+    ITF_NUM_TOTAL
+};
+
+#define EPNUM_CDC_NOTIF         0x81
+#define EPNUM_CDC_OUT           0x02
+#define EPNUM_CDC_IN            0x82
+#define EPNUM_CDC_STATS_NOTIF   0x83
+#define EPNUM_CDC_STATS_OUT     0x04
+#define EPNUM_CDC_STATS_IN      0x84
+#define EPNUM_MSC_OUT           0x05
+#define EPNUM_MSC_IN            0x85
+
+enum {
+    STRID_LANGID = 0,
+    STRID_MANUFACTURER,
+    STRID_PRODUCT,
+    STRID_SERIAL,
+    STRID_CDC,
+    STRID_CDC_STATS,
+    STRID_MSC,
+};
+
+static const tusb_desc_device_t desc_device = {
+    .bLength            = sizeof(tusb_desc_device_t),
+    .bDescriptorType    = TUSB_DESC_DEVICE,
+    .bcdUSB             = USB_BCD,
+    // interface association: several cdc interfaces
+    .bDeviceClass       = TUSB_CLASS_MISC,
+    .bDeviceSubClass    = MISC_SUBCLASS_COMMON,
+    .bDeviceProtocol    = MISC_PROTOCOL_IAD,
+    .bMaxPacketSize0    = CFG_TUD_ENDPOINT0_SIZE,
+    .idVendor           = USB_VID,
+    .idProduct          = USB_PID,
+    .bcdDevice          = 0x0100,
+    .iManufacturer      = STRID_MANUFACTURER,
+    .iProduct           = STRID_PRODUCT,
+    .iSerialNumber      = STRID_SERIAL,
+    .bNumConfigurations = 1,
+};
+
+const uint8_t * tud_descriptor_device_cb(void)
+{
+    return (const uint8_t *)&desc_device;
+}
+
+#define CONFIG_TOTAL_LEN (TUD_CONFIG_DESC_LEN + 2 * TUD_CDC_DESC_LEN + TUD_MSC_DESC_LEN)
+
+static const uint8_t desc_configuration[] = {
+    TUD_CONFIG_DESCRIPTOR(1, ITF_NUM_TOTAL, 0, CONFIG_TOTAL_LEN, 0, 250),
+    TUD_CDC_DESCRIPTOR(ITF_NUM_CDC, STRID_CDC, EPNUM_CDC_NOTIF, 8,
+            EPNUM_CDC_OUT, EPNUM_CDC_IN, 64),
+    TUD_CDC_DESCRIPTOR(ITF_NUM_CDC_STATS, STRID_CDC_STATS, EPNUM_CDC_STATS_NOTIF, 8,
+            EPNUM_CDC_STATS_OUT, EPNUM_CDC_STATS_IN, 64),
+    TUD_MSC_DESCRIPTOR(ITF_NUM_MSC, STRID_MSC, EPNUM_MSC_OUT, EPNUM_MSC_IN, 64),
+};
+
+const uint8_t * tud_descriptor_configuration_cb(uint8_t index)
+{
+    (void)index;
+    return desc_configuration;
+}
+
+static const char * const strings[] = {
+    [STRID_MANUFACTURER] = "svofski",
+    [STRID_PRODUCT]      = "Tapeshnik",
+    [STRID_CDC]          = "Tapeshnik console",
+    [STRID_CDC_STATS]    = "Tapeshnik msc stats",
+    [STRID_MSC]          = "Tapeshnik tape",
+};
+
+static uint16_t desc_str[32];
+
+const uint16_t * tud_descriptor_string_cb(uint8_t index, uint16_t langid)
+{
+    (void)langid;
+    char serial[2 * PICO_UNIQUE_BOARD_ID_SIZE_BYTES + 1];
+    const char * str;
+    size_t len;
+
+    if (index == STRID_LANGID) {
+        desc_str[1] = 0x0409;   // english
+        len = 1;
+    }
+    else {
+        if (index == STRID_SERIAL) {
+            pico_get_unique_board_id_string(serial, sizeof(serial));
+            str = serial;
+        }
+        else if (index < sizeof(strings) / sizeof(strings[0]) && strings[index]) {
+            str = strings[index];
+        }
+        else {
+            return 0;
+        }
+        for (len = 0; str[len] && len < 31; ++len) {
+            desc_str[1 + len] = str[len];
+        }
+    }
+
+    desc_str[0] = (TUSB_DESC_STRING << 8) | (2 * len + 2);
+    return desc_str;
+}
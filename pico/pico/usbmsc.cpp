@@ -0,0 +1,486 @@
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <algorithm>
+
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+#include "tusb.h"
+
+#include "config.h"
+#include "sectors.h"
+#include "iosched.h"
+#include "usbmsc.h"
+#include "util.h"
+
+constexpr uint32_t block_sz = 512;
+constexpr uint8_t cdc_stats = 1;
+
+// a callback moves at most CFG_TUD_MSC_EP_BUFSIZE bytes, that's two sectors
+constexpr int max_pieces = CFG_TUD_MSC_EP_BUFSIZE / sector_user_data_sz + 2;
+
+static_assert(MSC_STAGE_SECTORS >= max_pieces, "a callback needs all its sectors staged");
+
+enum stage_state_t : uint8_t {
+    STAGE_FREE = 0,
+    STAGE_PARTIAL,      // written lo..hi, the rest isn't read and may never need to be
+    STAGE_LOADING,      // main loop is to read it, lo..hi written meanwhile win
+    STAGE_VALID,
+    STAGE_ERROR,        // unreadable, the host is told; written ones are read again
+};
+
+struct stage_t {
+    int sector_num;
+    uint8_t state;
+    bool dirty;
+    uint16_t lo, hi;    // written bytes while not VALID
+    uint32_t used;      // lru stamp
+    uint8_t data[sector_user_data_sz];
+};
+
+// shared by the usb irq and the main loop; the main loop only looks at it
+// with interrupts off, the irq is never interrupted by the main loop
+static stage_t stages[MSC_STAGE_SECTORS];
+static uint32_t stamp;
+static int disk_sectors;
+static volatile bool media_changed;
+static volatile bool flush_wanted;
+static volatile uint32_t last_write_ms;
+
+// since the last report, [0] reads [1] writes
+struct msc_stats_t {
+    uint32_t requests[2];
+    uint32_t bytes[2];
+    uint32_t busy[2];           // asked to call again
+    uint64_t latency_sum_us[2]; // first time asked until served
+    uint32_t latency_max_us[2];
+};
+
+static msc_stats_t stats;
+static uint64_t pending_pos[2] = {~0ull, ~0ull};
+static uint64_t pending_since[2];
+static uint32_t report_ms;
+
+// a byte range of the disk cut at sector boundaries
+struct piece_t {
+    int sector_num;
+    uint16_t from, to;  // bytes of the sector
+    uint32_t buf_off;
+};
+
+static int split(uint64_t pos, uint32_t size, piece_t * pieces)
+{
+    int n = 0;
+    for (uint32_t off = 0; off < size; ++n) {
+        int sector_num = (pos + off) / sector_user_data_sz;
+        uint16_t from = (pos + off) % sector_user_data_sz;
+        uint16_t to = std::min<uint64_t>(sector_user_data_sz, from + size - off);
+        pieces[n] = piece_t{sector_num, from, to, off};
+        off += to - from;
+    }
+    return n;
+}
+
+static int find(int sector_num)
+{
+    for (int i = 0; i < MSC_STAGE_SECTORS; ++i) {
+        if (stages[i].state != STAGE_FREE && stages[i].sector_num == sector_num) {
+            stages[i].used = ++stamp;
+            return i;
+        }
+    }
+    return -1;
+}
+
+// free or least recently used clean stage, -1 if all are busy or dirty
+static int alloc(int sector_num, uint8_t state)
+{
+    int best = -1;
+    for (int i = 0; i < MSC_STAGE_SECTORS; ++i) {
+        const stage_t & s = stages[i];
+        if (s.state == STAGE_FREE) {
+            best = i;
+            break;
+        }
+        if (s.state == STAGE_VALID && !s.dirty && (best < 0 || s.used < stages[best].used)) {
+            best = i;
+        }
+    }
+    if (best >= 0) {
+        stages[best].sector_num = sector_num;
+        stages[best].state = state;
+        stages[best].dirty = false;
+        stages[best].lo = stages[best].hi = 0;
+        stages[best].used = ++stamp;
+    }
+    return best;
+}
+
+static uint64_t now_us()
+{
+    return to_us_since_boot(get_absolute_time());
+}
+
+// nothing taken, tinyusb calls again with the same request
+static int32_t busy(int rw, uint64_t pos)
+{
+    if (pending_pos[rw] != pos) {
+        pending_pos[rw] = pos;
+        pending_since[rw] = now_us();
+    }
+    ++stats.busy[rw];
+    return 0;
+}
+
+// a stage that couldn't be read: the request fails, one with host writes
+// in it is read again, a clean one is let go
+static int32_t unreadable(int rw, stage_t & s)
+{
+    s.state = s.dirty ? STAGE_LOADING : STAGE_FREE;
+    pending_pos[rw] = ~0ull;
+    tud_msc_set_sense(0, SCSI_SENSE_MEDIUM_ERROR, 0x11, 0x00);     // unrecovered read error
+    return -1;
+}
+
+static void served(int rw, uint64_t pos, uint32_t size)
+{
+    uint32_t latency = 0;
+    if (pending_pos[rw] == pos) {
+        latency = now_us() - pending_since[rw];
+        pending_pos[rw] = ~0ull;
+    }
+    ++stats.requests[rw];
+    stats.bytes[rw] += size;
+    stats.latency_sum_us[rw] += latency;
+    stats.latency_max_us[rw] = std::max(stats.latency_max_us[rw], latency);
+}
+
+void tud_msc_inquiry_cb(uint8_t lun, uint8_t vendor_id[8], uint8_t product_id[16],
+        uint8_t product_rev[4])
+{
+    memcpy(vendor_id, "svofski ", 8);
+    memcpy(product_id, "Tapeshnik tape  ", 16);
+    memcpy(product_rev, "1.0 ", 4);
+}
+
+bool tud_msc_test_unit_ready_cb(uint8_t lun)
+{
+    if (media_changed) {
+        media_changed = false;
+        tud_msc_set_sense(lun, SCSI_SENSE_UNIT_ATTENTION, 0x28, 0x00);
+        return false;
+    }
+    if (disk_sectors == 0) {
+        tud_msc_set_sense(lun, SCSI_SENSE_NOT_READY, 0x3a, 0x00);  // no medium
+        return false;
+    }
+    return true;
+}
+
+void tud_msc_capacity_cb(uint8_t lun, uint32_t * block_count, uint16_t * block_size)
+{
+    *block_count = (uint64_t)disk_sectors * sector_user_data_sz / block_sz;
+    *block_size = block_sz;
+}
+
+bool tud_msc_start_stop_cb(uint8_t lun, uint8_t power_condition, bool start,
+        bool load_eject)
+{
+    if (load_eject && !start) {
+        flush_wanted = true;
+    }
+    return true;
+}
+
+int32_t tud_msc_read10_cb(uint8_t lun, uint32_t lba, uint32_t offset, void * buffer,
+        uint32_t bufsize)
+{
+    uint64_t pos = (uint64_t)lba * block_sz + offset;
+    piece_t pieces[max_pieces];
+    int n = split(pos, bufsize, pieces);
+
+    // ask for everything missing at once, the scheduler reads it in one run
+    bool ready = true;
+    for (int i = 0; i < n; ++i) {
+        int s = find(pieces[i].sector_num);
+        if (s < 0) {
+            s = alloc(pieces[i].sector_num, STAGE_LOADING);
+            flush_wanted |= s < 0;
+        }
+        else if (stages[s].state == STAGE_PARTIAL) {
+            stages[s].state = STAGE_LOADING;
+        }
+        else if (stages[s].state == STAGE_ERROR) {
+            return unreadable(0, stages[s]);
+        }
+        if (s < 0 || stages[s].state != STAGE_VALID) {
+            ready = false;
+        }
+    }
+    if (!ready) {
+        return busy(0, pos);
+    }
+
+    for (int i = 0; i < n; ++i) {
+        const piece_t & p = pieces[i];
+        const stage_t & s = stages[find(p.sector_num)];
+        memcpy((uint8_t *)buffer + p.buf_off, s.data + p.from, p.to - p.from);
+    }
+    served(0, pos, bufsize);
+    return bufsize;
+}
+
+int32_t tud_msc_write10_cb(uint8_t lun, uint32_t lba, uint32_t offset, uint8_t * buffer,
+        uint32_t bufsize)
+{
+    uint64_t pos = (uint64_t)lba * block_sz + offset;
+    piece_t pieces[max_pieces];
+    int n = split(pos, bufsize, pieces);
+    last_write_ms = to_ms_since_boot(get_absolute_time());
+
+    // a sector that isn't loaded takes writes as long as they make one
+    // contiguous range, a sequential write fills it without reading it
+    bool ready = true;
+    for (int i = 0; i < n; ++i) {
+        const piece_t & p = pieces[i];
+        int s = find(p.sector_num);
+        if (s < 0) {
+            s = alloc(p.sector_num, STAGE_PARTIAL);
+        }
+        if (s < 0) {
+            flush_wanted = true;    // all staged sectors are dirty
+            ready = false;
+            continue;
+        }
+        stage_t & st = stages[s];
+        if (st.state == STAGE_ERROR && st.dirty) {
+            return unreadable(1, st);
+        }
+        if (st.state == STAGE_ERROR) {
+            st.state = STAGE_PARTIAL;
+            st.lo = st.hi = 0;
+        }
+        if ((st.state == STAGE_PARTIAL || st.state == STAGE_LOADING)
+                && st.lo != st.hi && (p.from > st.hi || p.to < st.lo)) {
+            st.state = STAGE_LOADING;
+            ready = false;
+        }
+    }
+    if (!ready) {
+        return busy(1, pos);
+    }
+
+    for (int i = 0; i < n; ++i) {
+        const piece_t & p = pieces[i];
+        stage_t & s = stages[find(p.sector_num)];
+        memcpy(s.data + p.from, buffer + p.buf_off, p.to - p.from);
+        s.dirty = true;
+        if (s.state != STAGE_VALID) {
+            s.lo = s.lo == s.hi ? p.from : std::min(s.lo, p.from);
+            s.hi = std::max(s.hi, p.to);
+            if (s.lo == 0 && s.hi == sector_user_data_sz) {
+                s.state = STAGE_VALID;
+            }
+        }
+    }
+    served(1, pos, bufsize);
+    return bufsize;
+}
+
+int32_t tud_msc_scsi_cb(uint8_t lun, const uint8_t scsi_cmd[16], void * buffer,
+        uint16_t bufsize)
+{
+    switch (scsi_cmd[0]) {
+        case SCSI_CMD_PREVENT_ALLOW_MEDIUM_REMOVAL:
+            return 0;
+        case 0x35:  // synchronize cache (10)
+            flush_wanted = true;
+            return 0;
+        default:
+            tud_msc_set_sense(lun, SCSI_SENSE_ILLEGAL_REQUEST, 0x20, 0x00);
+            return -1;
+    }
+}
+
+void usb_msc_init(int sectors)
+{
+    uint32_t irq = save_and_disable_interrupts();
+    for (stage_t & s : stages) {
+        s.state = STAGE_FREE;
+    }
+    media_changed = disk_sectors != sectors;
+    disk_sectors = std::min(sectors, sector_num_max + 1);
+    restore_interrupts(irq);
+}
+
+// the reader leaves the buffer alone when it fails, which a zeroed buffer
+// shows as bad crcs
+static bool payload_ok(uint8_t * payload)
+{
+    chunk_payload_t * chunks = reinterpret_cast<chunk_payload_t *>(payload);
+    for (size_t i = 0; i < FEC_BLOCKS_PER_SECTOR; ++i) {
+        if (chunks[i].crc16 != calculate_crc(chunks[i].data, payload_data_sz)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// read everything LOADING
+static void load(Bitstream & bstream)
+{
+    static uint8_t payloads[MSC_STAGE_SECTORS][sector_payload_sz];
+    int sector_nums[MSC_STAGE_SECTORS];
+    IoScheduler sched({IOSCHED_COALESCE_GAP, IOSCHED_MAX_RUN, IOSCHED_MAX_WAIT});
+
+    uint32_t irq = save_and_disable_interrupts();
+    for (int i = 0; i < MSC_STAGE_SECTORS; ++i) {
+        sector_nums[i] = stages[i].state == STAGE_LOADING ? stages[i].sector_num : -1;
+    }
+    restore_interrupts(irq);
+
+    for (int i = 0; i < MSC_STAGE_SECTORS; ++i) {
+        if (sector_nums[i] >= 0) {
+            memset(payloads[i], 0, sector_payload_sz);
+            sched.submit(io_request_t{sector_nums[i], IO_READ, (uint32_t)i, payloads[i], 0});
+        }
+    }
+    if (sched.pending() == 0) {
+        return;
+    }
+    bstream.serve(sched);
+
+    for (int i = 0; i < MSC_STAGE_SECTORS; ++i) {
+        if (sector_nums[i] < 0) {
+            continue;
+        }
+        const chunk_payload_t * chunks = reinterpret_cast<const chunk_payload_t *>(payloads[i]);
+        bool ok = payload_ok(payloads[i]);
+
+        irq = save_and_disable_interrupts();
+        stage_t & s = stages[i];
+        if (s.state == STAGE_LOADING && s.sector_num == sector_nums[i]) {
+            // tape data around what the host wrote meanwhile; an unreadable
+            // sector keeps only the writes and is not written back, the
+            // rest of it is other blocks of the disk
+            for (size_t pos = 0; ok && pos < sector_user_data_sz; ++pos) {
+                if (pos < s.lo || pos >= s.hi) {
+                    s.data[pos] = chunks[pos / payload_data_sz].data[pos % payload_data_sz];
+                }
+            }
+            s.state = ok ? STAGE_VALID : STAGE_ERROR;
+        }
+        restore_interrupts(irq);
+
+        if (!ok) {
+            warning_println("msc: sector %d unreadable", sector_nums[i]);
+        }
+    }
+}
+
+// everything dirty to the write queue and onto tape; partially written
+// sectors are read first, unreadable ones again
+static void write_back(Bitstream & bstream)
+{
+    static uint8_t data[sector_user_data_sz];
+    flush_wanted = false;
+
+    uint32_t irq = save_and_disable_interrupts();
+    for (stage_t & s : stages) {
+        if (s.state == STAGE_PARTIAL || (s.state == STAGE_ERROR && s.dirty)) {
+            s.state = STAGE_LOADING;
+        }
+    }
+    restore_interrupts(irq);
+    load(bstream);
+
+    int queued = 0;
+    for (stage_t & s : stages) {
+        irq = save_and_disable_interrupts();
+        int sector_num = -1;
+        if (s.state == STAGE_VALID && s.dirty) {
+            memcpy(data, s.data, sector_user_data_sz);
+            s.dirty = false;
+            sector_num = s.sector_num;
+        }
+        restore_interrupts(irq);
+
+        if (sector_num >= 0 && bstream.queue_write(sector_num, data, sector_user_data_sz)) {
+            ++queued;
+        }
+        else if (sector_num >= 0) {
+            // stuck write queue, next time
+            irq = save_and_disable_interrupts();
+            s.dirty |= s.sector_num == sector_num;
+            restore_interrupts(irq);
+        }
+    }
+    if (queued) {
+        bstream.flush_writes();
+    }
+}
+
+static void report()
+{
+    uint32_t ms = to_ms_since_boot(get_absolute_time());
+    if (ms - report_ms < MSC_REPORT_MS) {
+        return;
+    }
+    uint32_t elapsed = ms - report_ms;
+    report_ms = ms;
+
+    uint32_t irq = save_and_disable_interrupts();
+    msc_stats_t st = stats;
+    stats = {};
+    int staged = 0, dirty = 0;
+    for (const stage_t & s : stages) {
+        staged += s.state != STAGE_FREE;
+        dirty += s.dirty;
+    }
+    restore_interrupts(irq);
+
+    if (st.requests[0] + st.requests[1] + st.busy[0] + st.busy[1] == 0) {
+        return;
+    }
+
+    char line[160];
+    int len = 0;
+    for (int rw = 0; rw < 2; ++rw) {
+        uint32_t avg = st.requests[rw] ? st.latency_sum_us[rw] / st.requests[rw] : 0;
+        len += snprintf(line + len, sizeof(line) - len,
+                "%s %lu req %lu B/s lat %lu/%lu ms busy %lu, ", rw ? "wr" : "rd",
+                (unsigned long)st.requests[rw],
+                (unsigned long)((uint64_t)st.bytes[rw] * 1000 / elapsed),
+                (unsigned long)(avg / 1000), (unsigned long)(st.latency_max_us[rw] / 1000),
+                (unsigned long)st.busy[rw]);
+    }
+    snprintf(line + len, sizeof(line) - len, "staged %d dirty %d\r\n", staged, dirty);
+
+    // tud_task() runs in an irq on this core
+    irq = save_and_disable_interrupts();
+    if (tud_cdc_n_connected(cdc_stats)) {
+        tud_cdc_n_write_str(cdc_stats, line);
+        tud_cdc_n_write_flush(cdc_stats);
+    }
+    restore_interrupts(irq);
+}
+
+void usb_msc_task(Bitstream & bstream)
+{
+    load(bstream);
+
+    bool dirty = false;
+    uint32_t irq = save_and_disable_interrupts();
+    for (const stage_t & s : stages) {
+        // unreadable ones wait for the host to ask for them or to sync
+        dirty |= (s.dirty && s.state != STAGE_ERROR) || s.state == STAGE_PARTIAL;
+    }
+    restore_interrupts(irq);
+
+    uint32_t idle_ms = to_ms_since_boot(get_absolute_time()) - last_write_ms;
+    if (flush_wanted || (dirty && idle_ms >= MSC_WRITEBACK_MS)) {
+        write_back(bstream);
+    }
+
+    report();
+}
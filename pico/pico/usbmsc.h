@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include "bitstream.h"
+
+// usb mass storage on top of the sector layer
+//
+// the disk is the user data of sectors 0..n-1 back to back, 512-byte blocks
+// cut across sector boundaries: block b is bytes b*512.. of that stream
+// the usb callbacks run in the usb irq and never touch the tape, they only
+// see MSC_STAGE_SECTORS sectors staged in ram; for anything else the
+// callback takes nothing and tinyusb calls it again, a seek is longer than
+// the host would wait for "not ready"
+// usb_msc_task() in the main loop loads what the host asked for through
+// the request scheduler and writes back what it changed
+//
+// the second cdc interface reports throughput and per-request latency
+
+// sectors: the disk size, usually sector_index_count()
+void usb_msc_init(int sectors);
+
+// load, write back and report; call often from the main loop
+void usb_msc_task(Bitstream & bstream);
@@ -3,6 +3,7 @@
 #include "wheel.h"
 #include "debounce.h"
 #include "tacho.h"
+#include "reel.h"
 #include "config.h"
 
 enum tape_error_t {
@@ -148,6 +149,7 @@ int Wheel::play()
 
     autostop_alarm_stop();
 
+    wheel_position_t from = this->wheel_position;
     if (this->wheel_position != WP_STOP) {
         this->stop();
         this->motor.motor_on(); // cancel motor_stop_later
@@ -162,6 +164,11 @@ int Wheel::play()
     sleep_ms(425);  // half-turn +
     this->wheel_position = WP_PLAY;
 
+    // the counter slips when the reel turns around after ff/rew
+    if (from == WP_FF || from == WP_REW) {
+        tacho_set_counter(tacho_get_counter() + reel_backlash(from == WP_FF ? 1 : -1));
+    }
+
     autostop_alarm_start(AUTOSTOP_SLOW);
     //tacho_set_dir(+1);
 
@@ -0,0 +1,91 @@
+#include <cstdint>
+#include <cstring>
+#include <algorithm>
+#include <array>
+
+#include "config.h"
+#include "writequeue.h"
+
+static std::array<write_queue_entry_t, WRITE_QUEUE_SECTORS> entries;
+
+// slots of the queued entries sorted by sector number, the entries
+// themselves stay where they are
+static std::array<uint8_t, WRITE_QUEUE_SECTORS> order;
+static int count = 0;
+
+static_assert(WRITE_QUEUE_SECTORS <= 256, "order is uint8_t");
+
+// position in order of the first entry >= sector_num
+static int lower_bound(int sector_num)
+{
+    int i = 0;
+    while (i < count && entries[order[i]].sector_num < sector_num) {
+        ++i;
+    }
+    return i;
+}
+
+bool write_queue_put(int sector_num, const uint8_t * data, size_t data_sz)
+{
+    int pos = lower_bound(sector_num);
+    int slot;
+    if (pos < count && entries[order[pos]].sector_num == sector_num) {
+        slot = order[pos];
+    }
+    else {
+        if (count == WRITE_QUEUE_SECTORS) {
+            return false;
+        }
+        // a free slot is one that order doesn't mention
+        for (slot = 0; std::find(order.begin(), order.begin() + count, slot)
+                != order.begin() + count; ++slot) {
+        }
+        std::copy_backward(order.begin() + pos, order.begin() + count,
+                order.begin() + count + 1);
+        order[pos] = slot;
+        ++count;
+    }
+
+    write_queue_entry_t & e = entries[slot];
+    e.sector_num = sector_num;
+    e.data_sz = std::min(data_sz, sizeof(e.data));
+    memcpy(e.data, data, e.data_sz);
+
+    return true;
+}
+
+int write_queue_size()
+{
+    return count;
+}
+
+bool write_queue_full()
+{
+    return count == WRITE_QUEUE_SECTORS;
+}
+
+const write_queue_entry_t * write_queue_at(int i)
+{
+    return i >= 0 && i < count ? &entries[order[i]] : 0;
+}
+
+const write_queue_entry_t * write_queue_next(int sector_num)
+{
+    return write_queue_at(lower_bound(sector_num));
+}
+
+const write_queue_entry_t * write_queue_find(int sector_num)
+{
+    const write_queue_entry_t * e = write_queue_next(sector_num);
+    return e && e->sector_num == sector_num ? e : 0;
+}
+
+void write_queue_remove(int sector_num)
+{
+    int pos = lower_bound(sector_num);
+    if (pos < count && entries[order[pos]].sector_num == sector_num) {
+        std::copy(order.begin() + pos + 1, order.begin() + count,
+                order.begin() + pos);
+        --count;
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+
+#include "sectors.h"
+
+// sectors waiting to be written, in sector number order, so that one pass
+// over the tape can write them all; see Bitstream::flush_writes()
+
+struct write_queue_entry_t {
+    int sector_num;
+    size_t data_sz;
+    uint8_t data[sector_user_data_sz];
+};
+
+// queue data for sector_num, replacing what was queued for it before;
+// data_sz is cut to sector_user_data_sz; false if the queue is full
+bool write_queue_put(int sector_num, const uint8_t * data, size_t data_sz);
+
+int write_queue_size();
+bool write_queue_full();
+
+// i-th entry in sector number order
+const write_queue_entry_t * write_queue_at(int i);
+
+// first entry with sector number >= sector_num, 0 if none
+const write_queue_entry_t * write_queue_next(int sector_num);
+
+const write_queue_entry_t * write_queue_find(int sector_num);
+
+void write_queue_remove(int sector_num);